@@ -0,0 +1,37 @@
+local luaProfiler = TalkAction("/luaprofiler")
+
+function luaProfiler.onSay(player, words, param)
+	-- create log
+	logCommand(player, words, param)
+
+	local split = param:split(",")
+	local action = split[1] and split[1]:trim()
+	if action == "start" then
+		local instructions = tonumber(split[2]) or 1000
+		if not Game.startLuaProfiler(instructions) then
+			player:sendTextMessage(MESSAGE_ADMINISTRADOR, "The Lua profiler is already running.")
+			return true
+		end
+		player:sendTextMessage(MESSAGE_ADMINISTRADOR, "Lua profiler started, sampling every " .. instructions .. " instructions.")
+	elseif action == "stop" then
+		if not Game.stopLuaProfiler() then
+			player:sendTextMessage(MESSAGE_ADMINISTRADOR, "The Lua profiler is not running.")
+			return true
+		end
+		player:sendTextMessage(MESSAGE_ADMINISTRADOR, "Lua profiler stopped.")
+	elseif action == "dump" then
+		local file = split[2] and split[2]:trim() or "lua_profile.folded"
+		if not Game.dumpLuaProfile(file) then
+			player:sendTextMessage(MESSAGE_ADMINISTRADOR, "Could not write the Lua profile to " .. file .. ".")
+			return true
+		end
+		player:sendTextMessage(MESSAGE_ADMINISTRADOR, "Lua profile written to " .. file .. " and " .. file .. ".calls.")
+	else
+		player:sendTextMessage(MESSAGE_ADMINISTRADOR, "Usage: /luaprofiler start[, instructions], /luaprofiler stop or /luaprofiler dump[, file].")
+	end
+	return true
+end
+
+luaProfiler:separator(" ")
+luaProfiler:groupType("god")
+luaProfiler:register()
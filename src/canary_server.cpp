@@ -19,7 +19,10 @@
 #include "game/zones/zone.hpp"
 #include "game/scheduling/dispatcher.hpp"
 #include "game/scheduling/events_scheduler.hpp"
+#include "game/highscores/highscore_index.hpp"
 #include "io/iomarket.hpp"
+#include "items/items_snapshot.hpp"
+#include "lib/thread/stage_graph.hpp"
 #include "lib/thread/thread_pool.hpp"
 #include "lua/creature/events.hpp"
 #include "lua/modules/modules.hpp"
@@ -36,11 +39,13 @@
 CanaryServer::CanaryServer(
 	Logger &logger,
 	RSA &rsa,
-	ServiceManager &serviceManager
+	ServiceManager &serviceManager,
+	ThreadPool &threadPool
 ) :
 	logger(logger),
 	rsa(rsa),
 	serviceManager(serviceManager),
+	threadPool(threadPool),
 	loaderUniqueLock(loaderLock) {
 	logInfos();
 	toggleForceCloseButton();
@@ -65,9 +70,8 @@ int CanaryServer::run() {
 
 				rsa.start();
 				initializeDatabase();
-				loadModules();
 				setWorldType();
-				loadMaps();
+				loadModules();
 
 				logger.info("Initializing gamestate...");
 				g_game().setGameState(GAME_STATE_INIT);
@@ -75,8 +79,9 @@ int CanaryServer::run() {
 				setupHousesRent();
 				g_game().transferHouseItemsToDepot();
 
-				IOMarket::checkExpiredOffers();
-				IOMarket::getInstance().updateStatistics();
+				g_ioMarket().loadOffers();
+				g_ioMarket().checkExpiredOffers();
+				g_ioMarket().updateStatistics();
 
 				logger.info("Loaded all modules, server starting up...");
 
@@ -147,9 +152,17 @@ void CanaryServer::setWorldType() {
 	logger.debug("World type set as {}", asUpperCaseString(worldType));
 }
 
-void CanaryServer::loadMaps() const {
+void CanaryServer::loadMainMapFile() const {
+	try {
+		g_game().loadMainMapFile(g_configManager().getString(MAP_NAME));
+	} catch (const std::exception &err) {
+		throw FailedToInitializeCanary(err.what());
+	}
+}
+
+void CanaryServer::loadMapData() const {
 	try {
-		g_game().loadMainMap(g_configManager().getString(MAP_NAME));
+		g_game().loadMainMapData();
 
 		// If "mapCustomEnabled" is true on config.lua, then load the custom map
 		if (g_configManager().getBoolean(TOGGLE_MAP_CUSTOM)) {
@@ -275,6 +288,11 @@ void CanaryServer::loadConfigLua() {
 
 	modulesLoadHelper(g_configManager().load(), g_configManager().getConfigFileLua());
 
+	if (g_configManager().getBoolean(LOG_ASYNC)) {
+		const bool dropOnOverflow = asLowerCaseString(g_configManager().getString(LOG_OVERFLOW_POLICY)) != "block";
+		logger.setAsync(static_cast<size_t>(std::max(1, g_configManager().getNumber(LOG_QUEUE_SIZE))), dropOnOverflow);
+	}
+
 #ifdef _WIN32
 	const std::string &defaultPriority = g_configManager().getString(DEFAULT_PRIORITY);
 	if (strcasecmp(defaultPriority.c_str(), "high") == 0) {
@@ -321,44 +339,121 @@ void CanaryServer::loadModules() {
 		));
 	}
 
-	logger.debug("Initializing lua environment...");
-	if (!g_luaEnvironment().getLuaState()) {
-		g_luaEnvironment().initState();
-	}
+	constexpr auto Pool = StageGraph::Affinity::Pool;
+	// Everything touching the lua state runs on this thread, one stage at a time
+	constexpr auto Main = StageGraph::Affinity::Caller;
 
 	auto coreFolder = g_configManager().getString(CORE_DIRECTORY);
-	// Load items dependencies
-	modulesLoadHelper((g_game().loadAppearanceProtobuf(coreFolder + "/items/appearances.dat") == ERROR_NONE), "appearances.dat");
-	modulesLoadHelper(Item::items.loadFromXml(), "items.xml");
-
 	auto datapackFolder = g_configManager().getString(DATA_DIRECTORY);
-	logger.debug("Loading core scripts on folder: {}/", coreFolder);
+	StageGraph stages(threadPool, logger);
+
+	stages.add("lua environment", Main, {}, [this] {
+		logger.debug("Initializing lua environment...");
+		if (!g_luaEnvironment().getLuaState()) {
+			g_luaEnvironment().initState();
+		}
+	});
+
+	// Load items dependencies, from the items snapshot when it still matches them
+	const bool useItemsSnapshot = g_configManager().getBoolean(ITEMS_SNAPSHOT);
+	ItemsSnapshot itemsSnapshot(coreFolder + "/items");
+	stages.add("appearances.dat", Pool, {}, [this, coreFolder, useItemsSnapshot, &itemsSnapshot] {
+		if (useItemsSnapshot && itemsSnapshot.load()) {
+			logger.debug("Loaded item types from the items snapshot");
+			return;
+		}
+		modulesLoadHelper((g_game().loadAppearanceProtobuf(coreFolder + "/items/appearances.dat") == ERROR_NONE), "appearances.dat");
+	});
+	stages.add("items.xml", Pool, { "appearances.dat" }, [this, useItemsSnapshot, &itemsSnapshot] {
+		if (itemsSnapshot.isLoaded()) {
+			return;
+		}
+		modulesLoadHelper(Item::items.loadFromXml(), "items.xml");
+		if (useItemsSnapshot) {
+			itemsSnapshot.save();
+		}
+	});
+
+	// The map file only needs the item types, it parses alongside the scripts below.
+	// It keeps away from the zones, their positions are handed over by "map data"
+	stages.add("main map file", Pool, { "items.xml" }, [this] {
+		loadMainMapFile();
+	});
+
 	// Load first core Lua libs
-	modulesLoadHelper((g_luaEnvironment().loadFile(coreFolder + "/core.lua", "core.lua") == 0), "core.lua");
-	modulesLoadHelper(g_scripts().loadScripts(coreFolder + "/scripts", false, false), "/data/scripts");
-
-	// Second XML scripts
-	modulesLoadHelper(g_vocations().loadFromXml(), "XML/vocations.xml");
-	modulesLoadHelper(g_eventsScheduler().loadScheduleEventFromXml(), "XML/events.xml");
-	modulesLoadHelper(Outfits::getInstance().loadFromXml(), "XML/outfits.xml");
-	modulesLoadHelper(Familiars::getInstance().loadFromXml(), "XML/familiars.xml");
-	modulesLoadHelper(g_imbuements().loadFromXml(), "XML/imbuements.xml");
-	modulesLoadHelper(g_storages().loadFromXML(), "XML/storages.xml");
-	modulesLoadHelper(g_modules().loadFromXml(), "modules/modules.xml");
-	modulesLoadHelper(g_events().loadFromXml(), "events/events.xml");
-	modulesLoadHelper((g_npcs().load(true, false)), "npclib");
-
-	logger.debug("Loading datapack scripts on folder: {}/", datapackName);
-	modulesLoadHelper(g_scripts().loadScripts(datapackFolder + "/scripts/lib", true, false), datapackFolder + "/scripts/libs");
+	stages.add("core.lua", Main, { "lua environment", "items.xml" }, [this, coreFolder] {
+		logger.debug("Loading core scripts on folder: {}/", coreFolder);
+		modulesLoadHelper((g_luaEnvironment().loadFile(coreFolder + "/core.lua", "core.lua") == 0), "core.lua");
+	});
+	stages.add("/data/scripts", Main, { "core.lua" }, [this, coreFolder] {
+		modulesLoadHelper(g_scripts().loadScripts(coreFolder + "/scripts", false, false), "/data/scripts");
+	});
+
+	// Second XML files, these only fill their own containers
+	stages.add("XML/vocations.xml", Pool, {}, [this] {
+		modulesLoadHelper(g_vocations().loadFromXml(), "XML/vocations.xml");
+	});
+	// Outfits are checked against the looktypes registered by the appearances
+	stages.add("XML/outfits.xml", Pool, { "appearances.dat" }, [this] {
+		modulesLoadHelper(Outfits::getInstance().loadFromXml(), "XML/outfits.xml");
+	});
+	stages.add("XML/familiars.xml", Pool, {}, [this] {
+		modulesLoadHelper(Familiars::getInstance().loadFromXml(), "XML/familiars.xml");
+	});
+	stages.add("XML/imbuements.xml", Pool, {}, [this] {
+		modulesLoadHelper(g_imbuements().loadFromXml(), "XML/imbuements.xml");
+	});
+	stages.add("XML/storages.xml", Pool, {}, [this] {
+		modulesLoadHelper(g_storages().loadFromXML(), "XML/storages.xml");
+	});
+
+	// XML files loading scripts
+	stages.add("XML/events.xml", Main, { "/data/scripts" }, [this] {
+		modulesLoadHelper(g_eventsScheduler().loadScheduleEventFromXml(), "XML/events.xml");
+	});
+	stages.add("modules/modules.xml", Main, { "/data/scripts" }, [this] {
+		modulesLoadHelper(g_modules().loadFromXml(), "modules/modules.xml");
+	});
+	stages.add("events/events.xml", Main, { "/data/scripts" }, [this] {
+		modulesLoadHelper(g_events().loadFromXml(), "events/events.xml");
+	});
+	stages.add("npclib", Main, { "/data/scripts" }, [this] {
+		modulesLoadHelper((g_npcs().load(true, false)), "npclib");
+	});
+
+	// Datapack scripts may use anything loaded by the core
+	const std::string datapackLibs = datapackFolder + "/scripts/libs";
+	stages.add(datapackLibs, Main, { "XML/vocations.xml", "XML/outfits.xml", "XML/familiars.xml", "XML/imbuements.xml", "XML/storages.xml", "XML/events.xml", "modules/modules.xml", "events/events.xml", "npclib" }, [this, datapackName, datapackFolder, datapackLibs] {
+		logger.debug("Loading datapack scripts on folder: {}/", datapackName);
+		modulesLoadHelper(g_scripts().loadScripts(datapackFolder + "/scripts/lib", true, false), datapackLibs);
+	});
 	// Load scripts
-	modulesLoadHelper(g_scripts().loadScripts(datapackFolder + "/scripts", false, false), datapackFolder + "/scripts");
+	stages.add(datapackFolder + "/scripts", Main, { datapackLibs }, [this, datapackFolder] {
+		modulesLoadHelper(g_scripts().loadScripts(datapackFolder + "/scripts", false, false), datapackFolder + "/scripts");
+	});
 	// Load monsters
-	modulesLoadHelper(g_scripts().loadScripts(datapackFolder + "/monster", false, false), datapackFolder + "/monster");
-	modulesLoadHelper((g_npcs().load(false, true)), "npc");
-
-	g_game().loadBoostedCreature();
-	g_ioBosstiary().loadBoostedBoss();
-	g_ioprey().initializeTaskHuntOptions();
+	stages.add(datapackFolder + "/monster", Main, { datapackFolder + "/scripts" }, [this, datapackFolder] {
+		modulesLoadHelper(g_scripts().loadScripts(datapackFolder + "/monster", false, false), datapackFolder + "/monster");
+	});
+	stages.add("npc", Main, { datapackFolder + "/monster" }, [this] {
+		modulesLoadHelper((g_npcs().load(false, true)), "npc");
+	});
+	stages.add("boosted creatures", Main, { "npc" }, [] {
+		g_game().loadBoostedCreature();
+		g_ioBosstiary().loadBoostedBoss();
+		g_ioprey().initializeTaskHuntOptions();
+	});
+
+	stages.add("highscore index", Pool, { "XML/vocations.xml" }, [this] {
+		modulesLoadHelper(g_highscoreIndex().load(), "highscore index");
+	});
+
+	// Zones, spawns and houses need everything else
+	stages.add("map data", Main, { "main map file", "boosted creatures" }, [this] {
+		loadMapData();
+	});
+
+	stages.run();
 }
 
 void CanaryServer::modulesLoadHelper(bool loaded, std::string moduleName) {
@@ -13,6 +13,7 @@
 #include "server/server.hpp"
 
 class Logger;
+class ThreadPool;
 
 class FailedToInitializeCanary : public std::exception {
 private:
@@ -34,7 +35,8 @@ public:
 	explicit CanaryServer(
 		Logger &logger,
 		RSA &rsa,
-		ServiceManager &serviceManager
+		ServiceManager &serviceManager,
+		ThreadPool &threadPool
 	);
 
 	int run();
@@ -43,6 +45,7 @@ private:
 	RSA &rsa;
 	Logger &logger;
 	ServiceManager &serviceManager;
+	ThreadPool &threadPool;
 
 	std::mutex loaderLock;
 	std::condition_variable loaderSignal;
@@ -65,7 +68,8 @@ private:
 	void initializeDatabase();
 	void loadModules();
 	void setWorldType();
-	void loadMaps() const;
+	void loadMainMapFile() const;
+	void loadMapData() const;
 	void setupHousesRent();
 	void modulesLoadHelper(bool loaded, std::string moduleName);
 };
@@ -93,6 +93,12 @@ enum booleanConfig_t {
 
 	TOGGLE_RECEIVE_REWARD,
 
+	ITEMS_SNAPSHOT,
+
+	METRICS_ENABLED,
+	LUA_USERDATA_CACHE,
+	LOG_ASYNC,
+
 	LAST_BOOLEAN_CONFIG
 };
 
@@ -128,6 +134,9 @@ enum stringConfig_t {
 	FORGE_FIENDISH_INTERVAL_TIME,
 	TIBIADROME_CONCOCTION_TICK_TYPE,
 	M_CONST,
+	METRICS_HOST,
+	METRICS_FILE,
+	LOG_OVERFLOW_POLICY,
 
 	LAST_STRING_CONFIG
 };
@@ -259,6 +268,10 @@ enum integerConfig_t {
 	REWARD_CHEST_MAX_COLLECT_ITEMS,
 	DISCORD_WEBHOOK_DELAY_MS,
 
+	METRICS_PORT,
+	METRICS_INTERVAL,
+	LOG_QUEUE_SIZE,
+
 	LAST_INTEGER_CONFIG
 };
 
@@ -92,12 +92,16 @@ bool ConfigManager::load() {
 #ifndef DEBUG_LOG
 	g_logger().setLevel(getGlobalString(L, "logLevel", "info"));
 #endif
+	g_logger().setRateLimit(std::max(0, getGlobalNumber(L, "logRateLimit", 100)));
 
 	// Parse config
 	// Info that must be loaded one time (unless we reset the modules involved)
 	if (!loaded) {
 		boolean[BIND_ONLY_GLOBAL_ADDRESS] = getGlobalBoolean(L, "bindOnlyGlobalAddress", false);
 		boolean[OPTIMIZE_DATABASE] = getGlobalBoolean(L, "startupDatabaseOptimization", true);
+		boolean[LOG_ASYNC] = getGlobalBoolean(L, "logAsync", true);
+		integer[LOG_QUEUE_SIZE] = getGlobalNumber(L, "logQueueSize", 8192);
+		string[LOG_OVERFLOW_POLICY] = getGlobalString(L, "logOverflowPolicy", "drop");
 		boolean[TOGGLE_MAP_CUSTOM] = getGlobalBoolean(L, "toggleMapCustom", true);
 
 		string[IP] = getGlobalString(L, "ip", "127.0.0.1");
@@ -394,6 +398,16 @@ bool ConfigManager::load() {
 
 	boolean[TOGGLE_RECEIVE_REWARD] = getGlobalBoolean(L, "toggleReceiveReward", false);
 
+	boolean[ITEMS_SNAPSHOT] = getGlobalBoolean(L, "itemsSnapshot", false);
+
+	boolean[METRICS_ENABLED] = getGlobalBoolean(L, "metricsEnabled", false);
+	string[METRICS_HOST] = getGlobalString(L, "metricsHost", "127.0.0.1");
+	integer[METRICS_PORT] = getGlobalNumber(L, "metricsPort", 9464);
+	string[METRICS_FILE] = getGlobalString(L, "metricsFile", "");
+	integer[METRICS_INTERVAL] = getGlobalNumber(L, "metricsIntervalMs", 5000);
+
+	boolean[LUA_USERDATA_CACHE] = getGlobalBoolean(L, "luaUserdataCache", true);
+
 	loaded = true;
 	lua_close(L);
 	return true;
@@ -27,7 +27,7 @@ int32_t Combat::getLevelFormula(std::shared_ptr<Player> player, const std::share
 
 	uint32_t magicLevelSkill = player->getMagicLevel();
 	// Wheel of destiny - Runic Mastery
-	if (player->wheel()->getInstant("Runic Mastery") && wheelSpell && damage.instantSpellName.empty() && normal_random(0, 100) <= 25) {
+	if (player->wheel()->getInstant(WheelInstant_t::RUNIC_MASTERY) && wheelSpell && damage.instantSpellName.empty() && normal_random(0, 100) <= 25) {
 		const auto conjuringSpell = g_spells().getInstantSpellByName(damage.runeSpellName);
 		if (conjuringSpell && conjuringSpell != wheelSpell) {
 			uint32_t castResult = conjuringSpell->canCast(player) ? 20 : 10;
@@ -1392,7 +1392,7 @@ uint32_t ValueCallback::getMagicLevelSkill(std::shared_ptr<Player> player, const
 
 	uint32_t magicLevelSkill = player->getMagicLevel();
 	// Wheel of destiny
-	if (player && player->wheel()->getInstant("Runic Mastery") && damage.instantSpellName.empty()) {
+	if (player && player->wheel()->getInstant(WheelInstant_t::RUNIC_MASTERY) && damage.instantSpellName.empty()) {
 		const std::shared_ptr<Spell> spell = g_spells().getRuneSpellByName(damage.runeSpellName);
 		// Rune conjuring spell have the same name as the rune item spell.
 		const std::shared_ptr<InstantSpell> conjuringSpell = g_spells().getInstantSpellByName(damage.runeSpellName);
@@ -1424,8 +1424,7 @@ void ValueCallback::getMinMaxValues(std::shared_ptr<Player> player, CombatDamage
 
 	scriptInterface->pushFunction(scriptId);
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	int16_t elementAttack = 0; // To calculate elemental damage after executing spell script and get real damage.
 	int32_t attackValue = 7; // default start attack value
@@ -1543,8 +1542,7 @@ void TileCallback::onTileCombat(std::shared_ptr<Creature> creature, std::shared_
 
 	scriptInterface->pushFunction(scriptId);
 	if (creature) {
-		LuaScriptInterface::pushUserdata<Creature>(L, creature);
-		LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+		LuaScriptInterface::pushCreature(L, creature);
 	} else {
 		lua_pushnil(L);
 	}
@@ -1575,15 +1573,13 @@ void TargetCallback::onTargetCombat(std::shared_ptr<Creature> creature, std::sha
 	scriptInterface->pushFunction(scriptId);
 
 	if (creature) {
-		LuaScriptInterface::pushUserdata<Creature>(L, creature);
-		LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+		LuaScriptInterface::pushCreature(L, creature);
 	} else {
 		lua_pushnil(L);
 	}
 
 	if (target) {
-		LuaScriptInterface::pushUserdata<Creature>(L, target);
-		LuaScriptInterface::setCreatureMetatable(L, -1, target);
+		LuaScriptInterface::pushCreature(L, target);
 	} else {
 		lua_pushnil(L);
 	}
@@ -1623,8 +1619,7 @@ void ChainCallback::onChainCombat(std::shared_ptr<Creature> creature, uint8_t &m
 	scriptInterface->pushFunction(scriptId);
 
 	if (creature) {
-		LuaScriptInterface::pushUserdata<Creature>(L, creature);
-		LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+		LuaScriptInterface::pushCreature(L, creature);
 	} else {
 		lua_pushnil(L);
 	}
@@ -1665,15 +1660,13 @@ bool ChainPickerCallback::onChainCombat(std::shared_ptr<Creature> creature, std:
 	scriptInterface->pushFunction(scriptId);
 
 	if (creature) {
-		LuaScriptInterface::pushUserdata<Creature>(L, creature);
-		LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+		LuaScriptInterface::pushCreature(L, creature);
 	} else {
 		lua_pushnil(L);
 	}
 
 	if (target) {
-		LuaScriptInterface::pushUserdata<Creature>(L, target);
-		LuaScriptInterface::setCreatureMetatable(L, -1, target);
+		LuaScriptInterface::pushCreature(L, target);
 	} else {
 		lua_pushnil(L);
 	}
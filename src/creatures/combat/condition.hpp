@@ -284,6 +284,9 @@ public:
 		return forceUpdate;
 	}
 	int32_t getTotalDamage() const;
+	const std::list<IntervalInfo> &getDamageList() const {
+		return damageList;
+	}
 
 	// serialization
 	void serialize(PropWriteStream &propWriteStream) override;
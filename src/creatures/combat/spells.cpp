@@ -349,8 +349,7 @@ bool CombatSpell::executeCastSpell(std::shared_ptr<Creature> creature, const Lua
 
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Creature>(L, creature);
-	LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+	LuaScriptInterface::pushCreature(L, creature);
 
 	LuaScriptInterface::pushVariant(L, var);
 
@@ -893,8 +892,7 @@ bool InstantSpell::executeCastSpell(std::shared_ptr<Creature> creature, const Lu
 
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Creature>(L, creature);
-	LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+	LuaScriptInterface::pushCreature(L, creature);
 
 	LuaScriptInterface::pushVariant(L, var);
 
@@ -1037,8 +1035,7 @@ bool RuneSpell::executeCastSpell(std::shared_ptr<Creature> creature, const LuaVa
 
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Creature>(L, creature);
-	LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+	LuaScriptInterface::pushCreature(L, creature);
 
 	LuaScriptInterface::pushVariant(L, var);
 
@@ -111,6 +111,9 @@ private:
 	std::string getScriptTypeName() const override {
 		return "onCastSpell";
 	}
+	std::string getEventKind() const override {
+		return "spell";
+	}
 
 	std::shared_ptr<Combat> m_combat;
 
@@ -436,6 +439,9 @@ private:
 	[[nodiscard]] std::string getScriptTypeName() const override {
 		return "onCastSpell";
 	}
+	[[nodiscard]] std::string getEventKind() const override {
+		return "spell";
+	}
 
 	bool needDirection = false;
 	bool hasParam = false;
@@ -487,6 +493,9 @@ private:
 	[[nodiscard]] std::string getScriptTypeName() const override {
 		return "onCastSpell";
 	}
+	[[nodiscard]] std::string getEventKind() const override {
+		return "spell";
+	}
 
 	bool internalCastSpell(std::shared_ptr<Creature> creature, const LuaVariant &var, bool isHotkey);
 
@@ -0,0 +1,155 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2022 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+/**
+ * Hands out the ids of one kind of creature from the range [firstId, lastId] and
+ * resolves them back to the creature. The low bits of an id pick a slot, the high
+ * bits hold the generation of that slot, bumped whenever the slot is freed. Lookups
+ * are an index and a generation check, and the creatures themselves are kept in a
+ * contiguous vector for iteration.
+ *
+ * Freed slots are reused oldest first, and a slot whose generations run out is never
+ * reused, so an id is not handed out twice before the range is exhausted.
+ */
+template <typename T>
+class CreatureIdSlab {
+public:
+	CreatureIdSlab(uint32_t firstId, uint32_t lastId, uint8_t indexBits) :
+		firstId(firstId),
+		indexBits(indexBits),
+		maxSlots(1U << indexBits),
+		maxGenerations(static_cast<uint32_t>((static_cast<uint64_t>(lastId) - firstId + 1) >> indexBits)) { }
+
+	// Takes a free slot for a creature not added yet, 0 once every id is in use
+	uint32_t reserve() {
+		uint32_t index;
+		if (!freeSlots.empty()) {
+			index = freeSlots.front();
+			freeSlots.pop_front();
+		} else if (slots.size() < maxSlots) {
+			index = static_cast<uint32_t>(slots.size());
+			slots.emplace_back();
+		} else {
+			return 0;
+		}
+
+		Slot &slot = slots[index];
+		slot.position = RESERVED;
+		return firstId + (slot.generation << indexBits) + index;
+	}
+
+	// Whether the id is reserved or added, and not released since
+	bool contains(uint32_t id) const {
+		const Slot* slot = getSlot(id);
+		return slot && slot->position != FREE;
+	}
+
+	// The id must come from reserve()
+	bool add(uint32_t id, std::shared_ptr<T> creature) {
+		Slot* slot = getSlot(id);
+		if (!slot || slot->position != RESERVED) {
+			return false;
+		}
+
+		slot->position = static_cast<uint32_t>(creatures.size());
+		creatures.emplace_back(std::move(creature));
+		creatureIds.emplace_back(id);
+		return true;
+	}
+
+	std::shared_ptr<T> find(uint32_t id) const {
+		const Slot* slot = getSlot(id);
+		if (!slot || slot->position >= creatures.size()) {
+			return nullptr;
+		}
+		return creatures[slot->position];
+	}
+
+	// Frees the slot of the id, whether its creature was added or only reserved
+	bool release(uint32_t id) {
+		Slot* slot = getSlot(id);
+		if (!slot || slot->position == FREE) {
+			return false;
+		}
+
+		if (const uint32_t position = slot->position; position != RESERVED) {
+			// The last creature takes the place of the released one
+			if (position + 1 != creatures.size()) {
+				creatures[position] = std::move(creatures.back());
+				creatureIds[position] = creatureIds.back();
+				getSlot(creatureIds[position])->position = position;
+			}
+			creatures.pop_back();
+			creatureIds.pop_back();
+		}
+
+		slot->position = FREE;
+		if (++slot->generation < maxGenerations) {
+			freeSlots.emplace_back(getIndex(id));
+		}
+		return true;
+	}
+
+	// Added creatures, in no particular order
+	const std::vector<std::shared_ptr<T>> &values() const {
+		return creatures;
+	}
+
+	size_t size() const {
+		return creatures.size();
+	}
+
+	bool empty() const {
+		return creatures.empty();
+	}
+
+private:
+	static constexpr uint32_t FREE = std::numeric_limits<uint32_t>::max();
+	static constexpr uint32_t RESERVED = FREE - 1;
+
+	struct Slot {
+		uint32_t generation = 0;
+		// Position of the creature in creatures, or FREE/RESERVED
+		uint32_t position = FREE;
+	};
+
+	uint32_t getIndex(uint32_t id) const {
+		return (id - firstId) & (maxSlots - 1);
+	}
+
+	const Slot* getSlot(uint32_t id) const {
+		if (id < firstId) {
+			return nullptr;
+		}
+
+		const uint32_t index = getIndex(id);
+		if (index >= slots.size() || slots[index].generation != (id - firstId) >> indexBits) {
+			return nullptr;
+		}
+		return &slots[index];
+	}
+
+	Slot* getSlot(uint32_t id) {
+		return const_cast<Slot*>(std::as_const(*this).getSlot(id));
+	}
+
+	const uint32_t firstId;
+	const uint8_t indexBits;
+	const uint32_t maxSlots;
+	const uint32_t maxGenerations;
+
+	std::vector<Slot> slots;
+	std::deque<uint32_t> freeSlots;
+
+	std::vector<std::shared_ptr<T>> creatures;
+	// Id of the creature at the same position, to fix its slot when it is moved
+	std::vector<uint32_t> creatureIds;
+};
@@ -21,7 +21,17 @@
 int32_t Monster::despawnRange;
 int32_t Monster::despawnRadius;
 
-uint32_t Monster::monsterAutoID = 0x50000001;
+uint32_t Monster::getFirstID() {
+	return 0x50000001;
+}
+uint32_t Monster::getLastID() {
+	return 0x7FFFFFFF;
+}
+
+void Monster::setID() {
+	// A monster placed again after its removal does not keep an id that may be in use by now
+	id = g_game().reserveMonsterId(id);
+}
 
 std::shared_ptr<Monster> Monster::createMonster(const std::string &name) {
 	const auto mType = g_monsters().getMonsterType(name);
@@ -118,11 +128,9 @@ void Monster::onCreatureAppear(std::shared_ptr<Creature> creature, bool isLogin)
 		lua_State* L = scriptInterface->getLuaState();
 		scriptInterface->pushFunction(mType->info.creatureAppearEvent);
 
-		LuaScriptInterface::pushUserdata<Monster>(L, getMonster());
-		LuaScriptInterface::setMetatable(L, -1, "Monster");
+		LuaScriptInterface::pushUserdata<Monster>(L, getMonster(), "Monster");
 
-		LuaScriptInterface::pushUserdata<Creature>(L, creature);
-		LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+		LuaScriptInterface::pushCreature(L, creature);
 
 		if (scriptInterface->callFunction(2)) {
 			return;
@@ -156,11 +164,9 @@ void Monster::onRemoveCreature(std::shared_ptr<Creature> creature, bool isLogout
 		lua_State* L = scriptInterface->getLuaState();
 		scriptInterface->pushFunction(mType->info.creatureDisappearEvent);
 
-		LuaScriptInterface::pushUserdata<Monster>(L, getMonster());
-		LuaScriptInterface::setMetatable(L, -1, "Monster");
+		LuaScriptInterface::pushUserdata<Monster>(L, getMonster(), "Monster");
 
-		LuaScriptInterface::pushUserdata<Creature>(L, creature);
-		LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+		LuaScriptInterface::pushCreature(L, creature);
 
 		if (scriptInterface->callFunction(2)) {
 			return;
@@ -169,7 +175,8 @@ void Monster::onRemoveCreature(std::shared_ptr<Creature> creature, bool isLogout
 
 	if (creature.get() == this) {
 		if (spawnMonster) {
-			spawnMonster->startSpawnMonsterCheck();
+			// Game::removeCreature only flags the monster as removed after this notification
+			spawnMonster->startSpawnMonsterCheck(getMonster());
 		}
 
 		setIdle(true);
@@ -197,11 +204,9 @@ void Monster::onCreatureMove(std::shared_ptr<Creature> creature, std::shared_ptr
 		lua_State* L = scriptInterface->getLuaState();
 		scriptInterface->pushFunction(mType->info.creatureMoveEvent);
 
-		LuaScriptInterface::pushUserdata<Monster>(L, getMonster());
-		LuaScriptInterface::setMetatable(L, -1, "Monster");
+		LuaScriptInterface::pushUserdata<Monster>(L, getMonster(), "Monster");
 
-		LuaScriptInterface::pushUserdata<Creature>(L, creature);
-		LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+		LuaScriptInterface::pushCreature(L, creature);
 
 		LuaScriptInterface::pushPosition(L, oldPos);
 		LuaScriptInterface::pushPosition(L, newPos);
@@ -276,11 +281,9 @@ void Monster::onCreatureSay(std::shared_ptr<Creature> creature, SpeakClasses typ
 		lua_State* L = scriptInterface->getLuaState();
 		scriptInterface->pushFunction(mType->info.creatureSayEvent);
 
-		LuaScriptInterface::pushUserdata<Monster>(L, getMonster());
-		LuaScriptInterface::setMetatable(L, -1, "Monster");
+		LuaScriptInterface::pushUserdata<Monster>(L, getMonster(), "Monster");
 
-		LuaScriptInterface::pushUserdata<Creature>(L, creature);
-		LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+		LuaScriptInterface::pushCreature(L, creature);
 
 		lua_pushnumber(L, type);
 		LuaScriptInterface::pushString(L, text);
@@ -630,7 +633,7 @@ BlockType_t Monster::blockHit(std::shared_ptr<Creature> attacker, CombatType_t c
 
 		// Wheel of destiny
 		std::shared_ptr<Player> player = attacker ? attacker->getPlayer() : nullptr;
-		if (player && player->wheel()->getInstant("Ballistic Mastery")) {
+		if (player && player->wheel()->getInstant(WheelInstant_t::BALLISTIC_MASTERY)) {
 			elementMod -= player->wheel()->checkElementSensitiveReduction(combatType);
 		}
 
@@ -746,8 +749,7 @@ void Monster::onThink(uint32_t interval) {
 		lua_State* L = scriptInterface->getLuaState();
 		scriptInterface->pushFunction(mType->info.thinkEvent);
 
-		LuaScriptInterface::pushUserdata<Monster>(L, getMonster());
-		LuaScriptInterface::setMetatable(L, -1, "Monster");
+		LuaScriptInterface::pushUserdata<Monster>(L, getMonster(), "Monster");
 
 		lua_pushnumber(L, interval);
 
@@ -39,11 +39,7 @@ public:
 		return static_self_cast<Monster>();
 	}
 
-	void setID() override {
-		if (id == 0) {
-			id = monsterAutoID++;
-		}
-	}
+	void setID() override;
 
 	void removeList() override;
 	void addList() override;
@@ -278,7 +274,8 @@ public:
 
 	BlockType_t blockHit(std::shared_ptr<Creature> attacker, CombatType_t combatType, int32_t &damage, bool checkDefense = false, bool checkArmor = false, bool field = false) override;
 
-	static uint32_t monsterAutoID;
+	static uint32_t getFirstID();
+	static uint32_t getLastID();
 
 	void configureForgeSystem();
 
@@ -10,6 +10,7 @@
 #include "pch.hpp"
 
 #include "creatures/monsters/spawns/spawn_monster.hpp"
+#include "creatures/monsters/spawns/spawn_scheduler.hpp"
 #include "game/game.hpp"
 #include "creatures/monsters/monster.hpp"
 #include "game/scheduling/dispatcher.hpp"
@@ -20,6 +21,7 @@
 #include "utils/pugicast.hpp"
 #include "game/zones/zone.hpp"
 #include "map/spectators.hpp"
+#include "lib/metrics/metrics.hpp"
 
 static constexpr int32_t MONSTER_MINSPAWN_INTERVAL = 1000; // 1 second
 static constexpr int32_t MONSTER_MAXSPAWN_INTERVAL = 86400000; // 1 day
@@ -125,6 +127,7 @@ void SpawnsMonster::startup() {
 }
 
 void SpawnsMonster::clear() {
+	g_spawnScheduler().clear();
 	for (SpawnMonster &spawnMonster : spawnMonsterList) {
 		spawnMonster.stopEvent();
 	}
@@ -143,9 +146,14 @@ bool SpawnsMonster::isInZone(const Position &centerPos, int32_t radius, const Po
 	return ((pos.getX() >= centerPos.getX() - radius) && (pos.getX() <= centerPos.getX() + radius) && (pos.getY() >= centerPos.getY() - radius) && (pos.getY() <= centerPos.getY() + radius));
 }
 
-void SpawnMonster::startSpawnMonsterCheck() {
-	if (checkSpawnMonsterEvent == 0) {
-		checkSpawnMonsterEvent = g_dispatcher().scheduleEvent(getInterval(), std::bind(&SpawnMonster::checkSpawnMonster, this), "SpawnMonster::checkSpawnMonster");
+void SpawnMonster::startSpawnMonsterCheck(const std::shared_ptr<Monster> &removedMonster) {
+	cleanup(removedMonster);
+
+	for (auto &[spawnMonsterId, sb] : spawnMonsterMap) {
+		if (!sb.pending && !spawnedMonsterMap.contains(spawnMonsterId)) {
+			// Never sooner than the area interval, like the periodic area check used to
+			scheduleCheck(spawnMonsterId, sb, std::max<int64_t>(sb.lastSpawn + sb.interval, OTSYS_TIME() + getInterval()));
+		}
 	}
 }
 
@@ -156,14 +164,44 @@ SpawnMonster::~SpawnMonster() {
 	}
 }
 
-bool SpawnMonster::findPlayer(const Position &pos) {
-	auto spectators = Spectators().find<Player>(pos);
+std::vector<Position> SpawnMonster::findPlayers(const std::vector<uint32_t> &spawnMonsterIds) const {
+	// One spectators query around every blockable block of the batch, instead of one per block
+	int32_t minX = std::numeric_limits<int32_t>::max();
+	int32_t minY = std::numeric_limits<int32_t>::max();
+	int32_t maxX = std::numeric_limits<int32_t>::min();
+	int32_t maxY = std::numeric_limits<int32_t>::min();
+	for (uint32_t spawnMonsterId : spawnMonsterIds) {
+		const auto it = spawnMonsterMap.find(spawnMonsterId);
+		if (it == spawnMonsterMap.end() || !it->second.monsterType->info.isBlockable) {
+			continue;
+		}
+
+		const Position &pos = it->second.pos;
+		minX = std::min<int32_t>(minX, pos.x);
+		minY = std::min<int32_t>(minY, pos.y);
+		maxX = std::max<int32_t>(maxX, pos.x);
+		maxY = std::max<int32_t>(maxY, pos.y);
+	}
+
+	std::vector<Position> players;
+	if (minX > maxX) {
+		return players;
+	}
+
+	const Position corner(static_cast<uint16_t>(minX), static_cast<uint16_t>(minY), centerPos.z);
+	auto spectators = Spectators().find<Player>(corner, false, MAP_MAX_VIEW_PORT_X, maxX - minX + MAP_MAX_VIEW_PORT_X, MAP_MAX_VIEW_PORT_Y, maxY - minY + MAP_MAX_VIEW_PORT_Y);
 	for (const auto &spectator : spectators) {
 		if (!spectator->getPlayer()->hasFlag(PlayerFlags_t::IgnoredByMonsters)) {
-			return true;
+			players.emplace_back(spectator->getPosition());
 		}
 	}
-	return false;
+	return players;
+}
+
+bool SpawnMonster::isPlayerNear(const std::vector<Position> &players, const Position &pos) {
+	return std::ranges::any_of(players, [&pos](const Position &playerPos) {
+		return playerPos.z == pos.z && std::abs(playerPos.x - pos.x) <= MAP_MAX_VIEW_PORT_X && std::abs(playerPos.y - pos.y) <= MAP_MAX_VIEW_PORT_Y;
+	});
 }
 
 bool SpawnMonster::isInSpawnMonsterZone(const Position &pos) {
@@ -171,6 +209,8 @@ bool SpawnMonster::isInSpawnMonsterZone(const Position &pos) {
 }
 
 bool SpawnMonster::spawnMonster(uint32_t spawnMonsterId, const std::shared_ptr<MonsterType> monsterType, const Position &pos, Direction dir, bool startup /*= false*/) {
+	static auto &spawned = g_metrics().counter("canary_spawn_monsters_total", "Monsters placed by their spawn");
+
 	auto monster = std::make_shared<Monster>(monsterType);
 	if (startup) {
 		// No need to send out events to the surrounding since there is no one out there to listen!
@@ -184,16 +224,22 @@ bool SpawnMonster::spawnMonster(uint32_t spawnMonsterId, const std::shared_ptr<M
 	}
 
 	monster->setDirection(dir);
-	monster->setSpawnMonster(this);
-	monster->setMasterPos(pos);
-
-	spawnedMonsterMap.insert(spawned_pair(spawnMonsterId, monster));
-	spawnMonsterMap[spawnMonsterId].lastSpawn = OTSYS_TIME();
+	addSpawnedMonster(spawnMonsterId, monster);
+	spawned.add();
 	g_events().eventMonsterOnSpawn(monster, pos);
 	g_callbacks().executeCallback(EventCallback_t::monsterOnSpawn, &EventCallback::monsterOnSpawn, monster, pos);
 	return true;
 }
 
+void SpawnMonster::addSpawnedMonster(uint32_t spawnMonsterId, const std::shared_ptr<Monster> &monster) {
+	auto &sb = spawnMonsterMap[spawnMonsterId];
+	monster->setSpawnMonster(this);
+	monster->setMasterPos(sb.pos);
+
+	spawnedMonsterMap.insert(spawned_pair(spawnMonsterId, monster));
+	sb.lastSpawn = OTSYS_TIME();
+}
+
 void SpawnMonster::startup() {
 	for (const auto &it : spawnMonsterMap) {
 		uint32_t spawnMonsterId = it.first;
@@ -202,63 +248,77 @@ void SpawnMonster::startup() {
 	}
 }
 
-void SpawnMonster::checkSpawnMonster() {
-	checkSpawnMonsterEvent = 0;
+void SpawnMonster::checkSpawnMonster(const std::vector<uint32_t> &dueSpawnMonsterIds) {
+	static auto &delayed = g_metrics().counter("canary_spawn_delayed_total", "Due monster spawns pushed back by a player nearby or by the monster type");
 
 	cleanup();
 
+	const int64_t now = OTSYS_TIME();
+	const auto players = findPlayers(dueSpawnMonsterIds);
+	const auto spawnLimit = static_cast<uint32_t>(g_configManager().getNumber(RATE_SPAWN));
 	uint32_t spawnMonsterCount = 0;
 
-	for (auto &it : spawnMonsterMap) {
-		uint32_t spawnMonsterId = it.first;
-		if (spawnedMonsterMap.find(spawnMonsterId) != spawnedMonsterMap.end()) {
+	for (uint32_t spawnMonsterId : dueSpawnMonsterIds) {
+		auto it = spawnMonsterMap.find(spawnMonsterId);
+		if (it == spawnMonsterMap.end()) {
 			continue;
 		}
 
-		spawnBlock_t &sb = it.second;
-		if (!sb.monsterType->canSpawn(sb.pos)) {
-			sb.lastSpawn = OTSYS_TIME();
+		spawnBlock_t &sb = it->second;
+		sb.pending = false;
+		if (spawnedMonsterMap.contains(spawnMonsterId)) {
 			continue;
 		}
 
-		if (OTSYS_TIME() >= sb.lastSpawn + sb.interval) {
-			if (sb.monsterType->info.isBlockable && findPlayer(sb.pos)) {
-				sb.lastSpawn = OTSYS_TIME();
-				continue;
-			}
+		// Keeps the per area spawn limit, the rest is checked again after the area interval
+		if (spawnMonsterCount >= spawnLimit) {
+			scheduleCheck(spawnMonsterId, sb, now + getInterval());
+			continue;
+		}
 
-			if (sb.monsterType->info.isBlockable) {
-				spawnMonster(spawnMonsterId, sb.monsterType, sb.pos, sb.direction);
-			} else {
-				scheduleSpawn(spawnMonsterId, sb, 3 * NONBLOCKABLE_SPAWN_MONSTER_INTERVAL);
-			}
+		if (!sb.monsterType->canSpawn(sb.pos) || (sb.monsterType->info.isBlockable && isPlayerNear(players, sb.pos))) {
+			sb.lastSpawn = now;
+			delayed.add();
+			scheduleCheck(spawnMonsterId, sb, now + sb.interval);
+			continue;
+		}
 
-			if (++spawnMonsterCount >= static_cast<uint32_t>(g_configManager().getNumber(RATE_SPAWN))) {
-				break;
+		if (sb.monsterType->info.isBlockable) {
+			if (!spawnMonster(spawnMonsterId, sb.monsterType, sb.pos, sb.direction)) {
+				scheduleCheck(spawnMonsterId, sb, now + getInterval());
 			}
+		} else {
+			sb.pending = true;
+			scheduleSpawn(spawnMonsterId, sb, 3 * NONBLOCKABLE_SPAWN_MONSTER_INTERVAL);
 		}
+		++spawnMonsterCount;
 	}
+}
 
-	if (spawnedMonsterMap.size() < spawnMonsterMap.size()) {
-		checkSpawnMonsterEvent = g_dispatcher().scheduleEvent(getInterval(), std::bind(&SpawnMonster::checkSpawnMonster, this), "SpawnMonster::checkSpawnMonster");
-	}
+void SpawnMonster::scheduleCheck(uint32_t spawnMonsterId, spawnBlock_t &sb, int64_t due) {
+	sb.pending = true;
+	g_spawnScheduler().schedule(this, spawnMonsterId, due);
 }
 
 void SpawnMonster::scheduleSpawn(uint32_t spawnMonsterId, spawnBlock_t &sb, uint16_t interval) {
 	if (interval <= 0) {
-		spawnMonster(spawnMonsterId, sb.monsterType, sb.pos, sb.direction);
+		auto &block = spawnMonsterMap[spawnMonsterId];
+		block.pending = false;
+		if (!spawnMonster(spawnMonsterId, sb.monsterType, sb.pos, sb.direction)) {
+			scheduleCheck(spawnMonsterId, block, OTSYS_TIME() + getInterval());
+		}
 	} else {
 		g_game().addMagicEffect(sb.pos, CONST_ME_TELEPORT);
 		g_dispatcher().scheduleEvent(1400, std::bind(&SpawnMonster::scheduleSpawn, this, spawnMonsterId, sb, interval - NONBLOCKABLE_SPAWN_MONSTER_INTERVAL), "SpawnMonster::scheduleSpawn");
 	}
 }
 
-void SpawnMonster::cleanup() {
+void SpawnMonster::cleanup(const std::shared_ptr<Monster> &removedMonster) {
 	auto it = spawnedMonsterMap.begin();
 	while (it != spawnedMonsterMap.end()) {
 		uint32_t spawnMonsterId = it->first;
 		std::shared_ptr<Monster> monster = it->second;
-		if (!monster || monster->isRemoved()) {
+		if (!monster || monster == removedMonster || monster->isRemoved()) {
 			spawnMonsterMap[spawnMonsterId].lastSpawn = OTSYS_TIME();
 			it = spawnedMonsterMap.erase(it);
 		} else {
@@ -313,8 +373,5 @@ void SpawnMonster::setMonsterVariant(const std::string &variant) {
 }
 
 void SpawnMonster::stopEvent() {
-	if (checkSpawnMonsterEvent != 0) {
-		g_dispatcher().stopEvent(checkSpawnMonsterEvent);
-		checkSpawnMonsterEvent = 0;
-	}
+	g_spawnScheduler().cancel(this);
 }
@@ -21,6 +21,8 @@ struct spawnBlock_t {
 	int64_t lastSpawn;
 	uint32_t interval;
 	Direction direction;
+	// Waiting in the spawn scheduler or in the teleport effect of a nonblockable spawn
+	bool pending = false;
 };
 
 class SpawnMonster {
@@ -34,6 +36,8 @@ public:
 	SpawnMonster &operator=(const SpawnMonster &) = delete;
 
 	bool addMonster(const std::string &name, const Position &pos, Direction dir, uint32_t interval);
+	// Links a monster already placed on the map to the block it was spawned for
+	void addSpawnedMonster(uint32_t spawnMonsterId, const std::shared_ptr<Monster> &monster);
 	void removeMonster(std::shared_ptr<Monster> monster);
 
 	uint32_t getInterval() const {
@@ -41,11 +45,14 @@ public:
 	}
 	void startup();
 
-	void startSpawnMonsterCheck();
+	// A monster of the area being removed is passed in, it is not flagged as removed yet
+	void startSpawnMonsterCheck(const std::shared_ptr<Monster> &removedMonster = nullptr);
 	void stopEvent();
+	// Called by the spawn scheduler with the blocks of this area that are due
+	void checkSpawnMonster(const std::vector<uint32_t> &dueSpawnMonsterIds);
 
 	bool isInSpawnMonsterZone(const Position &pos);
-	void cleanup();
+	void cleanup(const std::shared_ptr<Monster> &removedMonster = nullptr);
 
 	const Position &getCenterPos() const {
 		return centerPos;
@@ -66,11 +73,11 @@ private:
 	int32_t radius;
 
 	uint32_t interval = 30000;
-	uint32_t checkSpawnMonsterEvent = 0;
 
-	static bool findPlayer(const Position &pos);
+	std::vector<Position> findPlayers(const std::vector<uint32_t> &spawnMonsterIds) const;
+	static bool isPlayerNear(const std::vector<Position> &players, const Position &pos);
 	bool spawnMonster(uint32_t spawnMonsterId, const std::shared_ptr<MonsterType> monsterType, const Position &pos, Direction dir, bool startup = false);
-	void checkSpawnMonster();
+	void scheduleCheck(uint32_t spawnMonsterId, spawnBlock_t &sb, int64_t due);
 	void scheduleSpawn(uint32_t spawnMonsterId, spawnBlock_t &sb, uint16_t interval);
 };
 
@@ -0,0 +1,78 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2022 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include "creatures/monsters/spawns/spawn_scheduler.hpp"
+#include "creatures/monsters/spawns/spawn_monster.hpp"
+#include "game/scheduling/dispatcher.hpp"
+#include "lib/metrics/metrics.hpp"
+
+// Spawn times are whole seconds, checking more often would only find nothing due
+static constexpr uint32_t SPAWN_SCHEDULER_INTERVAL = 1000;
+
+// Heap functions keep the largest element first, so the latest due compares as smaller
+static constexpr auto dueLater = [](const auto &a, const auto &b) {
+	return a.due > b.due;
+};
+
+void SpawnScheduler::schedule(SpawnMonster* spawnMonster, uint32_t spawnMonsterId, int64_t due) {
+	dueSpawns.push_back({ due, spawnMonster, spawnMonsterId });
+	std::ranges::push_heap(dueSpawns, dueLater);
+
+	if (checkEventId == 0) {
+		checkEventId = g_dispatcher().cycleEvent(SPAWN_SCHEDULER_INTERVAL, std::bind(&SpawnScheduler::checkDueSpawns, this), "SpawnScheduler::checkDueSpawns");
+	}
+}
+
+void SpawnScheduler::cancel(const SpawnMonster* spawnMonster) {
+	if (std::erase_if(dueSpawns, [spawnMonster](const DueSpawn &dueSpawn) { return dueSpawn.spawnMonster == spawnMonster; }) > 0) {
+		std::ranges::make_heap(dueSpawns, dueLater);
+	}
+	dueBySpawn.erase(const_cast<SpawnMonster*>(spawnMonster));
+}
+
+void SpawnScheduler::clear() {
+	dueSpawns.clear();
+	dueBySpawn.clear();
+	if (checkEventId != 0) {
+		g_dispatcher().stopEvent(checkEventId);
+		checkEventId = 0;
+	}
+}
+
+void SpawnScheduler::checkDueSpawns() {
+	static auto &pending = g_metrics().gauge("canary_spawn_pending", "Monster spawn blocks waiting to respawn");
+	static auto &due = g_metrics().gauge("canary_spawn_due", "Monster spawn blocks that were due in the last spawn check");
+	static auto &lateness = g_metrics().histogram("canary_spawn_lateness_seconds", "Time between a spawn block being due and being checked", Metrics::durationBuckets());
+
+	const int64_t now = OTSYS_TIME();
+	size_t dueCount = 0;
+	while (!dueSpawns.empty() && dueSpawns.front().due <= now) {
+		std::ranges::pop_heap(dueSpawns, dueLater);
+		const DueSpawn dueSpawn = dueSpawns.back();
+		dueSpawns.pop_back();
+
+		lateness.observe(static_cast<double>(now - dueSpawn.due) / 1000);
+		dueBySpawn[dueSpawn.spawnMonster].emplace_back(dueSpawn.spawnMonsterId);
+		++dueCount;
+	}
+	due.set(static_cast<int64_t>(dueCount));
+
+	// Spawning runs scripts that may cancel an area, which takes it out of dueBySpawn
+	while (!dueBySpawn.empty()) {
+		auto it = dueBySpawn.begin();
+		SpawnMonster* spawnMonster = it->first;
+		const std::vector<uint32_t> spawnMonsterIds = std::move(it->second);
+		dueBySpawn.erase(it);
+		spawnMonster->checkSpawnMonster(spawnMonsterIds);
+	}
+
+	pending.set(static_cast<int64_t>(dueSpawns.size()));
+}
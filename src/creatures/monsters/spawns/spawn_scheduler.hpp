@@ -0,0 +1,57 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2022 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+#include "lib/di/container.hpp"
+
+class SpawnMonster;
+
+/**
+ * Keeps every monster spawn block waiting to respawn in one min-heap ordered by due time.
+ * A single dispatcher event pops the due blocks and hands them to their spawn area,
+ * so the work per check follows the due spawns instead of the spawns on the map.
+ */
+class SpawnScheduler {
+public:
+	SpawnScheduler() = default;
+
+	// Singleton - ensures we don't accidentally copy it.
+	SpawnScheduler(const SpawnScheduler &) = delete;
+	SpawnScheduler &operator=(const SpawnScheduler &) = delete;
+
+	static SpawnScheduler &getInstance() {
+		return inject<SpawnScheduler>();
+	}
+
+	void schedule(SpawnMonster* spawnMonster, uint32_t spawnMonsterId, int64_t due);
+	// Drops the blocks of a spawn area that is going away
+	void cancel(const SpawnMonster* spawnMonster);
+	void clear();
+
+	size_t getPendingCount() const {
+		return dueSpawns.size();
+	}
+
+private:
+	struct DueSpawn {
+		int64_t due;
+		SpawnMonster* spawnMonster;
+		uint32_t spawnMonsterId;
+	};
+
+	void checkDueSpawns();
+
+	std::vector<DueSpawn> dueSpawns;
+	// Due blocks of the current check, grouped by spawn area
+	phmap::flat_hash_map<SpawnMonster*, std::vector<uint32_t>> dueBySpawn;
+	uint64_t checkEventId = 0;
+};
+
+constexpr auto g_spawnScheduler = SpawnScheduler::getInstance;
@@ -20,7 +20,17 @@
 int32_t Npc::despawnRange;
 int32_t Npc::despawnRadius;
 
-uint32_t Npc::npcAutoID = 0x80000000;
+uint32_t Npc::getFirstID() {
+	return 0x80000000;
+}
+uint32_t Npc::getLastID() {
+	return 0xFFFFFFFF;
+}
+
+void Npc::setID() {
+	// An npc placed again after its removal does not keep an id that may be in use by now
+	id = g_game().reserveNpcId(id);
+}
 
 std::shared_ptr<Npc> Npc::createNpc(const std::string &name) {
 	const auto &npcType = g_npcs().getNpcType(name);
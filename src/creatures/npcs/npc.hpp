@@ -41,11 +41,7 @@ public:
 		return static_self_cast<Npc>();
 	}
 
-	void setID() override {
-		if (id == 0) {
-			id = npcAutoID++;
-		}
-	}
+	void setID() override;
 
 	void removeList() override;
 	void addList() override;
@@ -160,7 +156,8 @@ public:
 	void removeShopPlayer(const std::shared_ptr<Player> &player);
 	void closeAllShopWindows();
 
-	static uint32_t npcAutoID;
+	static uint32_t getFirstID();
+	static uint32_t getLastID();
 
 	void onCreatureWalk() override;
 
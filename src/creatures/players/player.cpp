@@ -20,6 +20,7 @@
 #include "game/scheduling/dispatcher.hpp"
 #include "game/scheduling/task.hpp"
 #include "game/scheduling/save_manager.hpp"
+#include "game/highscores/highscore_index.hpp"
 #include "grouping/familiars.hpp"
 #include "lua/creature/creatureevent.hpp"
 #include "lua/creature/events.hpp"
@@ -38,7 +39,7 @@ Player::Player(ProtocolGame_ptr p) :
 	Creature(),
 	lastPing(OTSYS_TIME()),
 	lastPong(lastPing),
-	inbox(std::make_shared<Inbox>(ITEM_INBOX)),
+	inbox(makePooled<Inbox, ItemPool>(ITEM_INBOX)),
 	client(std::move(p)) {
 	m_wheelPlayer = std::make_unique<PlayerWheel>(*this);
 }
@@ -401,7 +402,7 @@ int32_t Player::getDefense() const {
 		defenseValue = weapon != nullptr ? shield->getDefense() + weapon->getExtraDefense() : shield->getDefense();
 		// Wheel of destiny - Combat Mastery
 		if (shield->getDefense() > 0) {
-			defenseValue += wheel()->getMajorStatConditional("Combat Mastery", WheelMajor_t::DEFENSE);
+			defenseValue += wheel()->getMajorStatConditional(WheelStage_t::COMBAT_MASTERY, WheelMajor_t::DEFENSE);
 		}
 		defenseSkill = getSkillLevel(SKILL_SHIELD);
 	}
@@ -555,7 +556,6 @@ void Player::updateInventoryImbuement() {
 	bool isInProtectionZone = playerTile && playerTile->hasFlag(TILESTATE_PROTECTIONZONE);
 	// Check if the player is in fight mode
 	bool isInFightMode = hasCondition(CONDITION_INFIGHT);
-	bool nonAggressiveFightOnly = g_configManager().getBoolean(TOGGLE_IMBUEMENT_NON_AGGRESSIVE_FIGHT_ONLY);
 
 	// Iterate through all items in the player's inventory
 	for (auto [key, item] : getAllSlotItems()) {
@@ -571,17 +571,7 @@ void Player::updateInventoryImbuement() {
 
 			// Imbuement from imbuementInfo, this variable reduces code complexity
 			auto imbuement = imbuementInfo.imbuement;
-			// Get the category of the imbuement
-			const CategoryImbuement* categoryImbuement = g_imbuements().getCategoryByID(imbuement->getCategory());
-			// Parent of the imbued item
-			auto parent = item->getParent();
-			bool isInBackpack = parent && parent->getContainer();
-			// If the imbuement is aggressive and the player is not in fight mode or is in a protection zone, or the item is in a container, ignore it.
-			if (categoryImbuement && (categoryImbuement->agressive || nonAggressiveFightOnly) && (isInProtectionZone || !isInFightMode || isInBackpack)) {
-				continue;
-			}
-			// If the item is not in the backpack slot and it's not a agressive imbuement, ignore it.
-			if (categoryImbuement && !categoryImbuement->agressive && parent && parent != getPlayer()) {
+			if (!isImbuementTicking(item, imbuement, isInProtectionZone, isInFightMode)) {
 				continue;
 			}
 
@@ -607,6 +597,49 @@ void Player::updateInventoryImbuement() {
 	}
 }
 
+void Player::updateImbuementTicking() {
+	g_game().setImbuementTicking(getPlayer(), hasTickingImbuement());
+}
+
+bool Player::hasTickingImbuement() {
+	std::shared_ptr<Tile> playerTile = getTile();
+	bool isInProtectionZone = playerTile && playerTile->hasFlag(TILESTATE_PROTECTIONZONE);
+	bool isInFightMode = hasCondition(CONDITION_INFIGHT);
+
+	for (uint8_t slot = CONST_SLOT_FIRST; slot <= CONST_SLOT_LAST; ++slot) {
+		const std::shared_ptr<Item> &item = inventory[slot];
+		if (!item) {
+			continue;
+		}
+
+		for (uint8_t slotid = 0; slotid < item->getImbuementSlot(); slotid++) {
+			ImbuementInfo imbuementInfo;
+			if (item->getImbuementInfo(slotid, &imbuementInfo) && isImbuementTicking(item, imbuementInfo.imbuement, isInProtectionZone, isInFightMode)) {
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+bool Player::isImbuementTicking(const std::shared_ptr<Item> &item, const Imbuement* imbuement, bool isInProtectionZone, bool isInFightMode) {
+	bool nonAggressiveFightOnly = g_configManager().getBoolean(TOGGLE_IMBUEMENT_NON_AGGRESSIVE_FIGHT_ONLY);
+	// Get the category of the imbuement
+	const CategoryImbuement* categoryImbuement = g_imbuements().getCategoryByID(imbuement->getCategory());
+	// Parent of the imbued item
+	auto parent = item->getParent();
+	bool isInBackpack = parent && parent->getContainer();
+	// If the imbuement is aggressive and the player is not in fight mode or is in a protection zone, or the item is in a container, ignore it.
+	if (categoryImbuement && (categoryImbuement->agressive || nonAggressiveFightOnly) && (isInProtectionZone || !isInFightMode || isInBackpack)) {
+		return false;
+	}
+	// If the item is not in the backpack slot and it's not a agressive imbuement, ignore it.
+	if (categoryImbuement && !categoryImbuement->agressive && parent && parent != getPlayer()) {
+		return false;
+	}
+	return true;
+}
+
 phmap::flat_hash_map<uint8_t, std::shared_ptr<Item>> Player::getAllSlotItems() const {
 	phmap::flat_hash_map<uint8_t, std::shared_ptr<Item>> itemMap;
 	for (uint8_t i = CONST_SLOT_FIRST; i <= CONST_SLOT_LAST; ++i) {
@@ -684,6 +717,7 @@ void Player::addSkillAdvance(skills_t skill, uint64_t count) {
 		sendTextMessage(MESSAGE_EVENT_ADVANCE, ss.str());
 
 		g_creatureEvents().playerAdvance(static_self_cast<Player>(), skill, (skills[skill].level - 1), skills[skill].level);
+		g_highscoreIndex().update(static_self_cast<Player>());
 
 		sendUpdateSkills = true;
 		currReqTries = nextReqTries;
@@ -883,7 +917,7 @@ void Player::addStorageValue(const uint32_t key, const int32_t value, const bool
 
 	if (value != -1) {
 		int32_t oldValue = getStorageValue(key);
-		storageMap[key] = value;
+		storage.set(key, value);
 
 		if (!isLogin) {
 			auto currentFrameTime = g_dispatcher().getDispatcherCycle();
@@ -891,19 +925,12 @@ void Player::addStorageValue(const uint32_t key, const int32_t value, const bool
 			g_callbacks().executeCallback(EventCallback_t::playerOnStorageUpdate, &EventCallback::playerOnStorageUpdate, getPlayer(), key, value, oldValue, currentFrameTime);
 		}
 	} else {
-		storageMap.erase(key);
+		storage.erase(key);
 	}
 }
 
 int32_t Player::getStorageValue(const uint32_t key) const {
-	int32_t value = -1;
-	auto it = storageMap.find(key);
-	if (it == storageMap.end()) {
-		return value;
-	}
-
-	value = it->second;
-	return value;
+	return storage.get(key).value_or(-1);
 }
 
 int32_t Player::getStorageValueByName(const std::string &storageName) const {
@@ -1151,13 +1178,13 @@ std::shared_ptr<DepotChest> Player::getDepotChest(uint32_t depotId, bool autoCre
 
 	std::shared_ptr<DepotChest> depotChest;
 	if (depotId > 0 && depotId < 18) {
-		depotChest = std::make_shared<DepotChest>(ITEM_DEPOT_NULL + depotId);
+		depotChest = makePooled<DepotChest, ItemPool>(ITEM_DEPOT_NULL + depotId);
 	} else if (depotId == 18) {
-		depotChest = std::make_shared<DepotChest>(ITEM_DEPOT_XVIII);
+		depotChest = makePooled<DepotChest, ItemPool>(ITEM_DEPOT_XVIII);
 	} else if (depotId == 19) {
-		depotChest = std::make_shared<DepotChest>(ITEM_DEPOT_XIX);
+		depotChest = makePooled<DepotChest, ItemPool>(ITEM_DEPOT_XIX);
 	} else {
-		depotChest = std::make_shared<DepotChest>(ITEM_DEPOT_XX);
+		depotChest = makePooled<DepotChest, ItemPool>(ITEM_DEPOT_XX);
 	}
 
 	depotChests[depotId] = depotChest;
@@ -1179,7 +1206,7 @@ std::shared_ptr<DepotLocker> Player::getDepotLocker(uint32_t depotId) {
 	// We need to make room for supply stash on 12+ protocol versions and remove it for 10x.
 	bool createSupplyStash = !client->oldProtocol;
 
-	std::shared_ptr<DepotLocker> depotLocker = std::make_shared<DepotLocker>(ITEM_LOCKER, createSupplyStash ? 4 : 3);
+	std::shared_ptr<DepotLocker> depotLocker = makePooled<DepotLocker, ItemPool>(ITEM_LOCKER, createSupplyStash ? 4 : 3);
 	depotLocker->setDepotId(depotId);
 	depotLocker->internalAddThing(Item::CreateItem(ITEM_MARKET));
 	depotLocker->internalAddThing(inbox);
@@ -1202,7 +1229,7 @@ std::shared_ptr<RewardChest> Player::getRewardChest() {
 		return rewardChest;
 	}
 
-	rewardChest = std::make_shared<RewardChest>(ITEM_REWARD_CHEST);
+	rewardChest = makePooled<RewardChest, ItemPool>(ITEM_REWARD_CHEST);
 	return rewardChest;
 }
 
@@ -1215,7 +1242,7 @@ std::shared_ptr<Reward> Player::getReward(const uint64_t rewardId, const bool au
 		return nullptr;
 	}
 
-	auto reward = std::make_shared<Reward>();
+	auto reward = makePooled<Reward, ItemPool>();
 	reward->setAttribute(ItemAttribute_t::DATE, rewardId);
 	rewardMap[rewardId] = reward;
 	g_game().internalAddItem(getRewardChest(), reward, INDEX_WHEREEVER, FLAG_NOLIMIT);
@@ -1422,6 +1449,7 @@ void Player::onApplyImbuement(Imbuement* imbuement, std::shared_ptr<Item> item,
 	}
 
 	item->addImbuement(slot, imbuement->getID(), baseImbuement->duration);
+	updateImbuementTicking();
 	openImbuementWindow(item);
 }
 
@@ -1456,6 +1484,7 @@ void Player::onClearImbuement(std::shared_ptr<Item> item, uint8_t slot) {
 	}
 
 	item->clearImbuement(slot, imbuementInfo.imbuement->getID());
+	updateImbuementTicking();
 	this->openImbuementWindow(item);
 }
 
@@ -1686,6 +1715,8 @@ void Player::onFollowCreatureDisappear(bool isLogout) {
 }
 
 void Player::onChangeZone(ZoneType_t zone) {
+	updateImbuementTicking();
+
 	if (zone == ZONE_PROTECTION) {
 		if (getAttackedCreature() && !hasFlag(PlayerFlags_t::IgnoreProtectionZone)) {
 			setAttackedCreature(nullptr);
@@ -2197,6 +2228,7 @@ void Player::addManaSpent(uint64_t amount) {
 		sendTextMessage(MESSAGE_EVENT_ADVANCE, ss.str());
 
 		g_creatureEvents().playerAdvance(static_self_cast<Player>(), SKILL_MAGLEVEL, magLevel - 1, magLevel);
+		g_highscoreIndex().update(static_self_cast<Player>());
 
 		sendUpdateStats = true;
 		currReqMana = nextReqMana;
@@ -2320,6 +2352,7 @@ void Player::addExperience(std::shared_ptr<Creature> target, uint64_t exp, bool
 		}
 
 		g_creatureEvents().playerAdvance(static_self_cast<Player>(), SKILL_LEVEL, prevLevel, level);
+		g_highscoreIndex().update(static_self_cast<Player>());
 
 		std::ostringstream ss;
 		ss << "You advanced from Level " << prevLevel << " to Level " << level << '.';
@@ -4001,6 +4034,7 @@ void Player::postAddNotification(std::shared_ptr<Thing> thing, std::shared_ptr<C
 	if (link == LINK_OWNER) {
 		// calling movement scripts
 		g_moveEvents().onPlayerEquip(getPlayer(), thing->getItem(), static_cast<Slots_t>(index), false);
+		updateImbuementTicking();
 	}
 
 	bool requireListUpdate = true;
@@ -4059,6 +4093,7 @@ void Player::postRemoveNotification(std::shared_ptr<Thing> thing, std::shared_pt
 	if (link == LINK_OWNER) {
 		// calling movement scripts
 		g_moveEvents().onPlayerDeEquip(getPlayer(), thing->getItem(), static_cast<Slots_t>(index));
+		updateImbuementTicking();
 	}
 
 	bool requireListUpdate = true;
@@ -4377,6 +4412,10 @@ void Player::onAddCondition(ConditionType_t type) {
 		dismount();
 	}
 
+	if (type == CONDITION_INFIGHT) {
+		updateImbuementTicking();
+	}
+
 	sendIcons();
 }
 
@@ -4446,6 +4485,8 @@ void Player::onEndCondition(ConditionType_t type) {
 		if (getSkull() != SKULL_RED && getSkull() != SKULL_BLACK) {
 			setSkull(SKULL_NONE);
 		}
+
+		updateImbuementTicking();
 	}
 
 	sendIcons();
@@ -4790,16 +4831,18 @@ bool Player::canLogout() {
 }
 
 void Player::genReservedStorageRange() {
-	// generate outfits range
+	// generate outfits range, keys left over from removed outfits are dropped
 	uint32_t outfits_key = PSTRG_OUTFITS_RANGE_START;
 	for (const OutfitEntry &entry : outfits) {
-		storageMap[++outfits_key] = (entry.lookType << 16) | entry.addons;
+		storage.set(++outfits_key, (entry.lookType << 16) | entry.addons);
 	}
+	storage.eraseRange(outfits_key + 1, PSTRG_OUTFITS_RANGE_START + PSTRG_OUTFITS_RANGE_SIZE);
 	// generate familiars range
 	uint32_t familiar_key = PSTRG_FAMILIARS_RANGE_START;
 	for (const FamiliarEntry &entry : familiars) {
-		storageMap[++familiar_key] = (entry.lookType << 16);
+		storage.set(++familiar_key, (entry.lookType << 16));
 	}
+	storage.eraseRange(familiar_key + 1, PSTRG_FAMILIARS_RANGE_START + PSTRG_FAMILIARS_RANGE_SIZE);
 }
 
 void Player::addOutfit(uint16_t lookType, uint8_t addons) {
@@ -5159,7 +5202,7 @@ uint32_t Player::getMagicLevel() const {
 	uint32_t magic = std::max<int32_t>(0, getLoyaltyMagicLevel() + varStats[STAT_MAGICPOINTS]);
 	// Wheel of destiny magic bonus
 	magic += m_wheelPlayer->getStat(WheelStat_t::MAGIC); // Regular bonus
-	magic += m_wheelPlayer->getMajorStatConditional("Positional Tatics", WheelMajor_t::MAGIC); // Revelation bonus
+	magic += m_wheelPlayer->getMajorStatConditional(WheelInstant_t::POSITIONAL_TATICS, WheelMajor_t::MAGIC); // Revelation bonus
 	return magic;
 }
 
@@ -5219,22 +5262,22 @@ uint16_t Player::getSkillLevel(skills_t skill) const {
 	// Wheel of destiny
 	if (skill >= SKILL_CLUB && skill <= SKILL_AXE) {
 		skillLevel += m_wheelPlayer->getStat(WheelStat_t::MELEE);
-		skillLevel += m_wheelPlayer->getMajorStatConditional("Battle Instinct", WheelMajor_t::MELEE);
+		skillLevel += m_wheelPlayer->getMajorStatConditional(WheelInstant_t::BATTLE_INSTINCT, WheelMajor_t::MELEE);
 	} else if (skill == SKILL_DISTANCE) {
-		skillLevel += m_wheelPlayer->getMajorStatConditional("Positional Tatics", WheelMajor_t::DISTANCE);
+		skillLevel += m_wheelPlayer->getMajorStatConditional(WheelInstant_t::POSITIONAL_TATICS, WheelMajor_t::DISTANCE);
 		skillLevel += m_wheelPlayer->getStat(WheelStat_t::DISTANCE);
 	} else if (skill == SKILL_SHIELD) {
-		skillLevel += m_wheelPlayer->getMajorStatConditional("Battle Instinct", WheelMajor_t::SHIELD);
+		skillLevel += m_wheelPlayer->getMajorStatConditional(WheelInstant_t::BATTLE_INSTINCT, WheelMajor_t::SHIELD);
 	} else if (skill == SKILL_MAGLEVEL) {
-		skillLevel += m_wheelPlayer->getMajorStatConditional("Positional Tatics", WheelMajor_t::MAGIC);
+		skillLevel += m_wheelPlayer->getMajorStatConditional(WheelInstant_t::POSITIONAL_TATICS, WheelMajor_t::MAGIC);
 		skillLevel += m_wheelPlayer->getStat(WheelStat_t::MAGIC);
 	} else if (skill == SKILL_LIFE_LEECH_AMOUNT) {
 		skillLevel += m_wheelPlayer->getStat(WheelStat_t::LIFE_LEECH);
 	} else if (skill == SKILL_MANA_LEECH_AMOUNT) {
 		skillLevel += m_wheelPlayer->getStat(WheelStat_t::MANA_LEECH);
 	} else if (skill == SKILL_CRITICAL_HIT_DAMAGE) {
-		skillLevel += m_wheelPlayer->getMajorStatConditional("Combat Mastery", WheelMajor_t::CRITICAL_DMG_2);
-		skillLevel += m_wheelPlayer->getMajorStatConditional("Ballistic Mastery", WheelMajor_t::CRITICAL_DMG);
+		skillLevel += m_wheelPlayer->getMajorStatConditional(WheelStage_t::COMBAT_MASTERY, WheelMajor_t::CRITICAL_DMG_2);
+		skillLevel += m_wheelPlayer->getMajorStatConditional(WheelInstant_t::BALLISTIC_MASTERY, WheelMajor_t::CRITICAL_DMG);
 		skillLevel += m_wheelPlayer->checkAvatarSkill(WheelAvatarSkill_t::CRITICAL_DAMAGE);
 	}
 
@@ -5793,6 +5836,7 @@ bool Player::addOfflineTrainingTries(skills_t skill, uint64_t tries) {
 			manaSpent = 0;
 
 			g_creatureEvents().playerAdvance(static_self_cast<Player>(), SKILL_MAGLEVEL, magLevel - 1, magLevel);
+			g_highscoreIndex().update(static_self_cast<Player>());
 
 			sendUpdate = true;
 			currReqMana = nextReqMana;
@@ -5849,6 +5893,7 @@ bool Player::addOfflineTrainingTries(skills_t skill, uint64_t tries) {
 			skills[skill].percent = 0;
 
 			g_creatureEvents().playerAdvance(static_self_cast<Player>(), skill, (skills[skill].level - 1), skills[skill].level);
+			g_highscoreIndex().update(static_self_cast<Player>());
 
 			sendUpdate = true;
 			currReqTries = nextReqTries;
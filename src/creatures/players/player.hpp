@@ -25,6 +25,7 @@
 #include "io/ioprey.hpp"
 #include "creatures/appearance/mounts/mounts.hpp"
 #include "creatures/appearance/outfit/outfit.hpp"
+#include "creatures/players/storages/player_storage.hpp"
 #include "grouping/party.hpp"
 #include "server/network/protocol/protocolgame.hpp"
 #include "items/containers/rewards/reward.hpp"
@@ -485,6 +486,9 @@ public:
 
 	void addStorageValue(const uint32_t key, const int32_t value, const bool isLogin = false);
 	int32_t getStorageValue(const uint32_t key) const;
+	std::vector<PlayerStorage::Entry> getStorageValues(uint32_t firstKey, uint32_t lastKey) const {
+		return storage.getRange(firstKey, lastKey);
+	}
 
 	int32_t getStorageValueByName(const std::string &storageName) const;
 	void addStorageValueByName(const std::string &storageName, const int32_t value, const bool isLogin = false);
@@ -1346,6 +1350,16 @@ public:
 			client->sendMagicEffect(pos, type);
 		}
 	}
+	void sendMagicEffect(const Position &pos, const BroadcastMessage_ptr &broadcast) const {
+		if (client) {
+			client->sendMagicEffect(pos, broadcast);
+		}
+	}
+	void sendBroadcast(const BroadcastMessage_ptr &broadcast) const {
+		if (client) {
+			client->sendBroadcast(broadcast);
+		}
+	}
 	void removeMagicEffect(const Position &pos, uint16_t type) const {
 		if (client) {
 			client->removeMagicEffect(pos, type);
@@ -2544,6 +2558,13 @@ private:
 	 * Registers the player in an unordered_map in game.h so that the function can be initialized by the task
 	 */
 	void updateInventoryImbuement();
+	/**
+	 * @brief Tells the game whether an equipped imbuement of the player is losing time
+	 * Called when the equipment, the zone or the fight state changes, so Game::checkImbuements only visits those players
+	 */
+	void updateImbuementTicking();
+	bool hasTickingImbuement();
+	bool isImbuementTicking(const std::shared_ptr<Item> &item, const Imbuement* imbuement, bool isInProtectionZone, bool isInFightMode);
 
 	void setNextWalkActionTask(std::shared_ptr<Task> task);
 	void setNextWalkTask(std::shared_ptr<Task> task);
@@ -2597,7 +2618,7 @@ private:
 	std::map<uint32_t, std::shared_ptr<DepotLocker>> depotLockerMap;
 	std::map<uint32_t, std::shared_ptr<DepotChest>> depotChests;
 	std::map<uint8_t, int64_t> moduleDelayMap;
-	std::map<uint32_t, int32_t> storageMap;
+	PlayerStorage storage;
 	std::map<uint16_t, uint64_t> itemPriceMap;
 
 	std::map<uint8_t, uint16_t> maxValuePerSkill = {
@@ -0,0 +1,130 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2022 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.org/
+ */
+
+#include "pch.hpp"
+
+#include "creatures/players/storages/player_storage.hpp"
+
+namespace {
+	bool keyLess(const PlayerStorage::Entry &entry, uint32_t key) {
+		return entry.first < key;
+	}
+}
+
+std::optional<int32_t> PlayerStorage::get(uint32_t key) const {
+	std::scoped_lock lock(mutex);
+	return getUnlocked(key);
+}
+
+std::optional<int32_t> PlayerStorage::getUnlocked(uint32_t key) const {
+	const auto it = std::lower_bound(entries.begin(), entries.end(), key, keyLess);
+	if (it == entries.end() || it->first != key) {
+		return std::nullopt;
+	}
+	return it->second;
+}
+
+bool PlayerStorage::set(uint32_t key, int32_t value) {
+	std::scoped_lock lock(mutex);
+	auto it = std::lower_bound(entries.begin(), entries.end(), key, keyLess);
+	if (it != entries.end() && it->first == key) {
+		if (it->second == value) {
+			return false;
+		}
+		it->second = value;
+	} else {
+		entries.emplace(it, key, value);
+	}
+
+	dirtyKeys.emplace(key);
+	return true;
+}
+
+bool PlayerStorage::erase(uint32_t key) {
+	std::scoped_lock lock(mutex);
+	const auto it = std::lower_bound(entries.begin(), entries.end(), key, keyLess);
+	if (it == entries.end() || it->first != key) {
+		return false;
+	}
+
+	entries.erase(it);
+	dirtyKeys.emplace(key);
+	return true;
+}
+
+size_t PlayerStorage::eraseRange(uint32_t first, uint32_t last) {
+	std::scoped_lock lock(mutex);
+	const auto [begin, end] = findRange(first, last);
+	for (auto it = begin; it != end; ++it) {
+		dirtyKeys.emplace(it->first);
+	}
+
+	const auto erased = static_cast<size_t>(std::distance(begin, end));
+	entries.erase(begin, end);
+	return erased;
+}
+
+std::vector<PlayerStorage::Entry> PlayerStorage::getRange(uint32_t first, uint32_t last) const {
+	std::scoped_lock lock(mutex);
+	const auto [begin, end] = findRange(first, last);
+	return { begin, end };
+}
+
+std::pair<std::vector<PlayerStorage::Entry>::const_iterator, std::vector<PlayerStorage::Entry>::const_iterator> PlayerStorage::findRange(uint32_t first, uint32_t last) const {
+	if (first > last) {
+		return { entries.end(), entries.end() };
+	}
+
+	const auto begin = std::lower_bound(entries.begin(), entries.end(), first, keyLess);
+	const auto end = std::upper_bound(begin, entries.end(), last, [](uint32_t key, const Entry &entry) {
+		return key < entry.first;
+	});
+	return { begin, end };
+}
+
+size_t PlayerStorage::size() const {
+	std::scoped_lock lock(mutex);
+	return entries.size();
+}
+
+void PlayerStorage::load(uint32_t key, int32_t value) {
+	std::scoped_lock lock(mutex);
+	auto it = std::lower_bound(entries.begin(), entries.end(), key, keyLess);
+	if (it != entries.end() && it->first == key) {
+		it->second = value;
+	} else {
+		entries.emplace(it, key, value);
+	}
+	dirtyKeys.erase(key);
+}
+
+PlayerStorage::Changes PlayerStorage::beginSave() {
+	std::scoped_lock lock(mutex);
+	savingKeys.merge(dirtyKeys);
+	dirtyKeys.clear();
+
+	Changes changes;
+	for (uint32_t key : savingKeys) {
+		if (const auto value = getUnlocked(key)) {
+			changes.updated.emplace_back(key, *value);
+		} else {
+			changes.removed.emplace_back(key);
+		}
+	}
+	return changes;
+}
+
+void PlayerStorage::endSave(bool saved) {
+	std::scoped_lock lock(mutex);
+	// A key changed again during the save is back in dirtyKeys with its newer value
+	if (!saved) {
+		dirtyKeys.merge(savingKeys);
+	}
+	savingKeys.clear();
+}
@@ -0,0 +1,56 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2022 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.org/
+ */
+
+#pragma once
+
+/**
+ * Storage values of a player, kept in a vector sorted by key so lookups and range
+ * reads stay on contiguous memory. Every key set or erased since the last save is
+ * remembered, so a save only writes what changed instead of the whole storage.
+ * Saves run on the thread pool while the dispatcher keeps changing values, so every
+ * access takes the lock and no reference to the entries escapes it.
+ */
+class PlayerStorage {
+public:
+	using Entry = std::pair<uint32_t, int32_t>;
+
+	struct Changes {
+		std::vector<Entry> updated;
+		std::vector<uint32_t> removed;
+	};
+
+	std::optional<int32_t> get(uint32_t key) const;
+	// Both return whether the storage changed
+	bool set(uint32_t key, int32_t value);
+	bool erase(uint32_t key);
+	// Returns how many keys in [first, last] were erased
+	size_t eraseRange(uint32_t first, uint32_t last);
+
+	// Copy of the entries with a key in [first, last], ordered by key
+	std::vector<Entry> getRange(uint32_t first, uint32_t last) const;
+
+	size_t size() const;
+
+	// A value read from the database, it is not written back until it changes
+	void load(uint32_t key, int32_t value);
+	// Changes since the last save. They are forgotten by endSave(true) once written,
+	// a failed save hands them back to the next one with endSave(false). Keys changed
+	// between both calls stay dirty for the next save
+	Changes beginSave();
+	void endSave(bool saved);
+
+private:
+	std::optional<int32_t> getUnlocked(uint32_t key) const;
+	std::pair<std::vector<Entry>::const_iterator, std::vector<Entry>::const_iterator> findRange(uint32_t first, uint32_t last) const;
+
+	mutable std::mutex mutex;
+	std::vector<Entry> entries;
+	phmap::flat_hash_set<uint32_t> dirtyKeys;
+	phmap::flat_hash_set<uint32_t> savingKeys;
+};
@@ -20,6 +20,60 @@
 // To avoid conflict in other files that might use a function with the same name
 // Here are built-in helper functions
 namespace {
+	using WheelSpellTarget = std::variant<WheelInstant_t, WheelStage_t>;
+
+	/**
+	 * @brief Resolves a wheel spell name (as used by Lua and the revelation perks) into its instant or stage enum.
+	 * @details The table is built once, so a lookup is a single hash instead of a chain of string compares.
+	 */
+	std::optional<WheelSpellTarget> resolveWheelSpellName(const std::string &name) {
+		static const phmap::flat_hash_map<std::string, WheelSpellTarget> wheelSpellTargets = {
+			{ "Battle Instinct", WheelInstant_t::BATTLE_INSTINCT },
+			{ "Battle Healing", WheelInstant_t::BATTLE_HEALING },
+			{ "Positional Tatics", WheelInstant_t::POSITIONAL_TATICS },
+			{ "Ballistic Mastery", WheelInstant_t::BALLISTIC_MASTERY },
+			{ "Healing Link", WheelInstant_t::HEALING_LINK },
+			{ "Runic Mastery", WheelInstant_t::RUNIC_MASTERY },
+			{ "Focus Mastery", WheelInstant_t::FOCUS_MASTERY },
+			{ "Beam Mastery", WheelStage_t::BEAM_MASTERY },
+			{ "Combat Mastery", WheelStage_t::COMBAT_MASTERY },
+			{ "Gift of Life", WheelStage_t::GIFT_OF_LIFE },
+			{ "Blessing of the Grove", WheelStage_t::BLESSING_OF_THE_GROVE },
+			{ "Drain Body", WheelStage_t::DRAIN_BODY },
+			{ "Divine Empowerment", WheelStage_t::DIVINE_EMPOWERMENT },
+			{ "Divine Grenade", WheelStage_t::DIVINE_GRENADE },
+			{ "Twin Burst", WheelStage_t::TWIN_BURST },
+			{ "Executioner's Throw", WheelStage_t::EXECUTIONERS_THROW },
+			{ "Avatar of Light", WheelStage_t::AVATAR_OF_LIGHT },
+			{ "Avatar of Nature", WheelStage_t::AVATAR_OF_NATURE },
+			{ "Avatar of Steel", WheelStage_t::AVATAR_OF_STEEL },
+			{ "Avatar of Storm", WheelStage_t::AVATAR_OF_STORM },
+		};
+
+		auto it = wheelSpellTargets.find(name);
+		if (it == wheelSpellTargets.end()) {
+			return std::nullopt;
+		}
+		return it->second;
+	}
+
+	// Instants and stages that have periodic work in PlayerWheel::onThink
+	const auto onThinkInstants = [] {
+		std::bitset<static_cast<size_t>(WheelInstant_t::TOTAL_COUNT)> mask;
+		mask.set(static_cast<size_t>(WheelInstant_t::BATTLE_INSTINCT));
+		mask.set(static_cast<size_t>(WheelInstant_t::POSITIONAL_TATICS));
+		mask.set(static_cast<size_t>(WheelInstant_t::BALLISTIC_MASTERY));
+		return mask;
+	}();
+
+	const auto onThinkStages = [] {
+		std::bitset<static_cast<size_t>(WheelStage_t::TOTAL_COUNT)> mask;
+		mask.set(static_cast<size_t>(WheelStage_t::GIFT_OF_LIFE));
+		mask.set(static_cast<size_t>(WheelStage_t::COMBAT_MASTERY));
+		mask.set(static_cast<size_t>(WheelStage_t::DIVINE_EMPOWERMENT));
+		return mask;
+	}();
+
 	template <typename SpellType>
 	bool checkSpellArea(const std::array<SpellType, 5> &spellsTable, const std::string &spellName, uint8_t stage) {
 		for (const auto &spellTable : spellsTable) {
@@ -1105,117 +1159,117 @@ void PlayerWheel::registerPlayerBonusData() {
 	setPlayerCombatStats(COMBAT_MANADRAIN, m_playerBonusData.leech.manaLeech * 100);
 
 	// Instant
-	setSpellInstant("Battle Instinct", m_playerBonusData.instant.battleInstinct);
-	setSpellInstant("Battle Healing", m_playerBonusData.instant.battleHealing);
-	setSpellInstant("Positional Tatics", m_playerBonusData.instant.positionalTatics);
-	setSpellInstant("Ballistic Mastery", m_playerBonusData.instant.ballisticMastery);
-	setSpellInstant("Healing Link", m_playerBonusData.instant.healingLink);
-	setSpellInstant("Runic Mastery", m_playerBonusData.instant.runicMastery);
-	setSpellInstant("Focus Mastery", m_playerBonusData.instant.focusMastery);
+	setSpellInstant(WheelInstant_t::BATTLE_INSTINCT, m_playerBonusData.instant.battleInstinct);
+	setSpellInstant(WheelInstant_t::BATTLE_HEALING, m_playerBonusData.instant.battleHealing);
+	setSpellInstant(WheelInstant_t::POSITIONAL_TATICS, m_playerBonusData.instant.positionalTatics);
+	setSpellInstant(WheelInstant_t::BALLISTIC_MASTERY, m_playerBonusData.instant.ballisticMastery);
+	setSpellInstant(WheelInstant_t::HEALING_LINK, m_playerBonusData.instant.healingLink);
+	setSpellInstant(WheelInstant_t::RUNIC_MASTERY, m_playerBonusData.instant.runicMastery);
+	setSpellInstant(WheelInstant_t::FOCUS_MASTERY, m_playerBonusData.instant.focusMastery);
 
 	// Stages (Revelation)
 	if (m_playerBonusData.stages.combatMastery > 0) {
 		for (int i = 0; i < m_playerBonusData.stages.combatMastery; ++i) {
-			setSpellInstant("Combat Mastery", true);
+			setSpellStage(WheelStage_t::COMBAT_MASTERY, true);
 		}
 	} else {
-		setSpellInstant("Combat Mastery", false);
+		setSpellStage(WheelStage_t::COMBAT_MASTERY, false);
 	}
 
 	if (m_playerBonusData.stages.giftOfLife > 0) {
 		for (int i = 0; i < m_playerBonusData.stages.giftOfLife; ++i) {
-			setSpellInstant("Gift of Life", true);
+			setSpellStage(WheelStage_t::GIFT_OF_LIFE, true);
 		}
 	} else {
-		setSpellInstant("Gift of Life", false);
+		setSpellStage(WheelStage_t::GIFT_OF_LIFE, false);
 	}
 
 	if (m_playerBonusData.stages.blessingOfTheGrove > 0) {
 		for (int i = 0; i < m_playerBonusData.stages.blessingOfTheGrove; ++i) {
-			setSpellInstant("Blessing of the Grove", true);
+			setSpellStage(WheelStage_t::BLESSING_OF_THE_GROVE, true);
 		}
 	} else {
-		setSpellInstant("Blessing of the Grove", false);
+		setSpellStage(WheelStage_t::BLESSING_OF_THE_GROVE, false);
 	}
 
 	if (m_playerBonusData.stages.divineEmpowerment > 0) {
 		for (int i = 0; i < m_playerBonusData.stages.divineEmpowerment; ++i) {
-			setSpellInstant("Divine Empowerment", true);
+			setSpellStage(WheelStage_t::DIVINE_EMPOWERMENT, true);
 		}
 	} else {
-		setSpellInstant("Divine Empowerment", false);
+		setSpellStage(WheelStage_t::DIVINE_EMPOWERMENT, false);
 	}
 
 	if (m_playerBonusData.stages.divineGrenade > 0) {
 		for (int i = 0; i < m_playerBonusData.stages.divineGrenade; ++i) {
-			setSpellInstant("Divine Grenade", true);
+			setSpellStage(WheelStage_t::DIVINE_GRENADE, true);
 		}
 	} else {
-		setSpellInstant("Divine Grenade", false);
+		setSpellStage(WheelStage_t::DIVINE_GRENADE, false);
 	}
 
 	if (m_playerBonusData.stages.drainBody > 0) {
 		for (int i = 0; i < m_playerBonusData.stages.drainBody; ++i) {
-			setSpellInstant("Drain Body", true);
+			setSpellStage(WheelStage_t::DRAIN_BODY, true);
 		}
 	} else {
-		setSpellInstant("Drain Body", false);
+		setSpellStage(WheelStage_t::DRAIN_BODY, false);
 	}
 	if (m_playerBonusData.stages.beamMastery > 0) {
 		for (int i = 0; i < m_playerBonusData.stages.beamMastery; ++i) {
-			setSpellInstant("Beam Mastery", true);
+			setSpellStage(WheelStage_t::BEAM_MASTERY, true);
 		}
 	} else {
-		setSpellInstant("Beam Mastery", false);
+		setSpellStage(WheelStage_t::BEAM_MASTERY, false);
 	}
 
 	if (m_playerBonusData.stages.twinBurst > 0) {
 		for (int i = 0; i < m_playerBonusData.stages.twinBurst; ++i) {
-			setSpellInstant("Twin Burst", true);
+			setSpellStage(WheelStage_t::TWIN_BURST, true);
 		}
 	} else {
-		setSpellInstant("Twin Burst", false);
+		setSpellStage(WheelStage_t::TWIN_BURST, false);
 	}
 
 	if (m_playerBonusData.stages.executionersThrow > 0) {
 		for (int i = 0; i < m_playerBonusData.stages.executionersThrow; ++i) {
-			setSpellInstant("Executioner's Throw", true);
+			setSpellStage(WheelStage_t::EXECUTIONERS_THROW, true);
 		}
 	} else {
-		setSpellInstant("Executioner's Throw", false);
+		setSpellStage(WheelStage_t::EXECUTIONERS_THROW, false);
 	}
 
 	// Avatar
 	if (m_playerBonusData.avatar.light > 0) {
 		for (int i = 0; i < m_playerBonusData.avatar.light; ++i) {
-			setSpellInstant("Avatar of Light", true);
+			setSpellStage(WheelStage_t::AVATAR_OF_LIGHT, true);
 		}
 	} else {
-		setSpellInstant("Avatar of Light", false);
+		setSpellStage(WheelStage_t::AVATAR_OF_LIGHT, false);
 	}
 
 	if (m_playerBonusData.avatar.nature > 0) {
 		for (int i = 0; i < m_playerBonusData.avatar.nature; ++i) {
-			setSpellInstant("Avatar of Nature", true);
+			setSpellStage(WheelStage_t::AVATAR_OF_NATURE, true);
 		}
 	} else {
-		setSpellInstant("Avatar of Nature", false);
+		setSpellStage(WheelStage_t::AVATAR_OF_NATURE, false);
 	}
 
 	if (m_playerBonusData.avatar.steel > 0) {
 		for (int i = 0; i < m_playerBonusData.avatar.steel; ++i) {
-			setSpellInstant("Avatar of Steel", true);
+			setSpellStage(WheelStage_t::AVATAR_OF_STEEL, true);
 		}
 	} else {
-		setSpellInstant("Avatar of Steel", false);
+		setSpellStage(WheelStage_t::AVATAR_OF_STEEL, false);
 	}
 
 	if (m_playerBonusData.avatar.storm > 0) {
 		for (int i = 0; i < m_playerBonusData.avatar.storm; ++i) {
-			setSpellInstant("Avatar of Storm", true);
+			setSpellStage(WheelStage_t::AVATAR_OF_STORM, true);
 		}
 	} else {
-		setSpellInstant("Avatar of Storm", false);
+		setSpellStage(WheelStage_t::AVATAR_OF_STORM, false);
 	}
 
 	for (const auto spell : m_playerBonusData.spells) {
@@ -1587,13 +1641,13 @@ WheelStageEnum_t PlayerWheel::getPlayerSliceStage(const std::string &color) cons
 void PlayerWheel::checkAbilities() {
 	// Wheel of destiny
 	bool reloadClient = false;
-	if (getInstant("Battle Instinct") && getOnThinkTimer(WheelOnThink_t::BATTLE_INSTINCT) < OTSYS_TIME() && checkBattleInstinct()) {
+	if (getInstant(WheelInstant_t::BATTLE_INSTINCT) && getOnThinkTimer(WheelOnThink_t::BATTLE_INSTINCT) < OTSYS_TIME() && checkBattleInstinct()) {
 		reloadClient = true;
 	}
-	if (getInstant("Positional Tatics") && getOnThinkTimer(WheelOnThink_t::POSITIONAL_TATICS) < OTSYS_TIME() && checkPositionalTatics()) {
+	if (getInstant(WheelInstant_t::POSITIONAL_TATICS) && getOnThinkTimer(WheelOnThink_t::POSITIONAL_TATICS) < OTSYS_TIME() && checkPositionalTatics()) {
 		reloadClient = true;
 	}
-	if (getInstant("Ballistic Mastery") && getOnThinkTimer(WheelOnThink_t::BALLISTIC_MASTERY) < OTSYS_TIME() && checkBallisticMastery()) {
+	if (getInstant(WheelInstant_t::BALLISTIC_MASTERY) && getOnThinkTimer(WheelOnThink_t::BALLISTIC_MASTERY) < OTSYS_TIME() && checkBallisticMastery()) {
 		reloadClient = true;
 	}
 
@@ -2011,13 +2065,13 @@ int32_t PlayerWheel::checkAvatarSkill(WheelAvatarSkill_t skill) const {
 	}
 
 	uint8_t stage = 0;
-	if (getInstant("Avatar of Light")) {
+	if (hasStage(WheelStage_t::AVATAR_OF_LIGHT)) {
 		stage = getStage(WheelStage_t::AVATAR_OF_LIGHT);
-	} else if (getInstant("Avatar of Steel")) {
+	} else if (hasStage(WheelStage_t::AVATAR_OF_STEEL)) {
 		stage = getStage(WheelStage_t::AVATAR_OF_STEEL);
-	} else if (getInstant("Avatar of Nature")) {
+	} else if (hasStage(WheelStage_t::AVATAR_OF_NATURE)) {
 		stage = getStage(WheelStage_t::AVATAR_OF_NATURE);
-	} else if (getInstant("Avatar of Storm")) {
+	} else if (hasStage(WheelStage_t::AVATAR_OF_STORM)) {
 		stage = getStage(WheelStage_t::AVATAR_OF_STORM);
 	} else {
 		return 0;
@@ -2056,9 +2110,9 @@ int32_t PlayerWheel::checkFocusMasteryDamage() {
 int32_t PlayerWheel::checkElementSensitiveReduction(CombatType_t type) const {
 	int32_t rt = 0;
 	if (type == COMBAT_PHYSICALDAMAGE) {
-		rt += getMajorStatConditional("Ballistic Mastery", WheelMajor_t::PHYSICAL_DMG);
+		rt += getMajorStatConditional(WheelInstant_t::BALLISTIC_MASTERY, WheelMajor_t::PHYSICAL_DMG);
 	} else if (type == COMBAT_HOLYDAMAGE) {
-		rt += getMajorStatConditional("Ballistic Mastery", WheelMajor_t::HOLY_DMG);
+		rt += getMajorStatConditional(WheelInstant_t::BALLISTIC_MASTERY, WheelMajor_t::HOLY_DMG);
 	}
 	return rt;
 }
@@ -2066,7 +2120,8 @@ int32_t PlayerWheel::checkElementSensitiveReduction(CombatType_t type) const {
 void PlayerWheel::onThink(bool force /* = false*/) {
 	bool updateClient = false;
 	m_creaturesNearby = 0;
-	if (!m_player.hasCondition(CONDITION_INFIGHT) || m_player.getZoneType() == ZONE_PROTECTION || (!getInstant("Battle Instinct") && !getInstant("Positional Tatics") && !getInstant("Ballistic Mastery") && !getInstant("Gift of Life") && !getInstant("Combat Mastery") && !getInstant("Divine Empowerment") && getGiftOfCooldown() == 0)) {
+	const bool hasOnThinkPerk = (m_instant & onThinkInstants).any() || (m_activeStages & onThinkStages).any();
+	if (!m_player.hasCondition(CONDITION_INFIGHT) || m_player.getZoneType() == ZONE_PROTECTION || (!hasOnThinkPerk && getGiftOfCooldown() == 0)) {
 		bool mustReset = false;
 		for (int i = 0; i < static_cast<int>(WheelMajor_t::TOTAL_COUNT); i++) {
 			if (getMajorStat(static_cast<WheelMajor_t>(i)) != 0) {
@@ -2088,27 +2143,27 @@ void PlayerWheel::onThink(bool force /* = false*/) {
 		}
 	}
 	// Battle Instinct
-	if (getInstant("Battle Instinct") && (force || getOnThinkTimer(WheelOnThink_t::BATTLE_INSTINCT) < OTSYS_TIME()) && checkBattleInstinct()) {
+	if (getInstant(WheelInstant_t::BATTLE_INSTINCT) && (force || getOnThinkTimer(WheelOnThink_t::BATTLE_INSTINCT) < OTSYS_TIME()) && checkBattleInstinct()) {
 		updateClient = true;
 	}
 	// Positional Tatics
-	if (getInstant("Positional Tatics") && (force || getOnThinkTimer(WheelOnThink_t::POSITIONAL_TATICS) < OTSYS_TIME()) && checkPositionalTatics()) {
+	if (getInstant(WheelInstant_t::POSITIONAL_TATICS) && (force || getOnThinkTimer(WheelOnThink_t::POSITIONAL_TATICS) < OTSYS_TIME()) && checkPositionalTatics()) {
 		updateClient = true;
 	}
 	// Ballistic Mastery
-	if (getInstant("Ballistic Mastery") && (force || getOnThinkTimer(WheelOnThink_t::BALLISTIC_MASTERY) < OTSYS_TIME()) && checkBallisticMastery()) {
+	if (getInstant(WheelInstant_t::BALLISTIC_MASTERY) && (force || getOnThinkTimer(WheelOnThink_t::BALLISTIC_MASTERY) < OTSYS_TIME()) && checkBallisticMastery()) {
 		updateClient = true;
 	}
 	// Gift of life (Cooldown)
-	if (getGiftOfCooldown() > 0 /*getInstant("Gift of Life")*/ && getOnThinkTimer(WheelOnThink_t::GIFT_OF_LIFE) <= OTSYS_TIME()) {
+	if (getGiftOfCooldown() > 0 /*hasStage(WheelStage_t::GIFT_OF_LIFE)*/ && getOnThinkTimer(WheelOnThink_t::GIFT_OF_LIFE) <= OTSYS_TIME()) {
 		decreaseGiftOfCooldown(1);
 	}
 	// Combat Mastery
-	if (getInstant("Combat Mastery") && (force || getOnThinkTimer(WheelOnThink_t::COMBAT_MASTERY) < OTSYS_TIME()) && checkCombatMastery()) {
+	if (hasStage(WheelStage_t::COMBAT_MASTERY) && (force || getOnThinkTimer(WheelOnThink_t::COMBAT_MASTERY) < OTSYS_TIME()) && checkCombatMastery()) {
 		updateClient = true;
 	}
 	// Divine Empowerment
-	if (getInstant("Divine Empowerment") && (force || getOnThinkTimer(WheelOnThink_t::DIVINE_EMPOWERMENT) < OTSYS_TIME()) && checkDivineEmpowerment()) {
+	if (hasStage(WheelStage_t::DIVINE_EMPOWERMENT) && (force || getOnThinkTimer(WheelOnThink_t::DIVINE_EMPOWERMENT) < OTSYS_TIME()) && checkDivineEmpowerment()) {
 		updateClient = true;
 	}
 	if (updateClient) {
@@ -2173,7 +2228,7 @@ void PlayerWheel::downgradeSpell(const std::string &name) {
 
 std::shared_ptr<Spell> PlayerWheel::getCombatDataSpell(CombatDamage &damage) {
 	std::shared_ptr<Spell> spell = nullptr;
-	damage.damageMultiplier += getMajorStatConditional("Divine Empowerment", WheelMajor_t::DAMAGE);
+	damage.damageMultiplier += getMajorStatConditional(WheelStage_t::DIVINE_EMPOWERMENT, WheelMajor_t::DAMAGE);
 	WheelSpellGrade_t spellGrade = WheelSpellGrade_t::NONE;
 	if (!(damage.instantSpellName).empty()) {
 		spellGrade = getSpellUpgrade(damage.instantSpellName);
@@ -2186,7 +2241,7 @@ std::shared_ptr<Spell> PlayerWheel::getCombatDataSpell(CombatDamage &damage) {
 		if (getHealingLinkUpgrade(spell->getName())) {
 			damage.healingLink += 10;
 		}
-		if (spell->getSecondaryGroup() == SPELLGROUP_FOCUS && getInstant("Focus Mastery")) {
+		if (spell->getSecondaryGroup() == SPELLGROUP_FOCUS && getInstant(WheelInstant_t::FOCUS_MASTERY)) {
 			setOnThinkTimer(WheelOnThink_t::FOCUS_MASTERY, (OTSYS_TIME() + 12000));
 		}
 
@@ -2211,6 +2266,7 @@ void PlayerWheel::setStage(WheelStage_t type, uint8_t value) {
 	auto enumValue = static_cast<uint8_t>(type);
 	try {
 		m_stages.at(enumValue) = value;
+		m_activeStages.set(enumValue, value > 0);
 	} catch (const std::out_of_range &e) {
 		g_logger().error("[{}]. Type {} is out of range. Error message: {}", __FUNCTION__, enumValue, e.what());
 	}
@@ -2237,7 +2293,7 @@ void PlayerWheel::setMajorStat(WheelMajor_t type, int32_t value) {
 void PlayerWheel::setInstant(WheelInstant_t type, bool toggle) {
 	auto enumValue = static_cast<uint8_t>(type);
 	try {
-		m_instant.at(enumValue) = toggle;
+		m_instant.set(enumValue, toggle);
 	} catch (const std::out_of_range &e) {
 		g_logger().error("[{}]. Type {} is out of range. Error message: {}", __FUNCTION__, enumValue, e.what());
 	}
@@ -2261,114 +2317,51 @@ void PlayerWheel::setResistance(CombatType_t type, int32_t value) {
 }
 
 void PlayerWheel::setSpellInstant(const std::string &name, bool value) {
-	if (name == "Battle Instinct") {
-		setInstant(WheelInstant_t::BATTLE_INSTINCT, value);
-		if (!getInstant(WheelInstant_t::BATTLE_INSTINCT)) {
+	const auto target = resolveWheelSpellName(name);
+	if (!target) {
+		return;
+	}
+
+	if (const auto instant = std::get_if<WheelInstant_t>(&*target)) {
+		setSpellInstant(*instant, value);
+	} else {
+		setSpellStage(std::get<WheelStage_t>(*target), value);
+	}
+}
+
+void PlayerWheel::setSpellInstant(WheelInstant_t type, bool value) {
+	setInstant(type, value);
+	if (value) {
+		return;
+	}
+
+	switch (type) {
+		case WheelInstant_t::BATTLE_INSTINCT:
 			setMajorStat(WheelMajor_t::SHIELD, 0);
 			setMajorStat(WheelMajor_t::MELEE, 0);
-		}
-	} else if (name == "Battle Healing") {
-		setInstant(WheelInstant_t::BATTLE_HEALING, value);
-	} else if (name == "Positional Tatics") {
-		setInstant(WheelInstant_t::POSITIONAL_TATICS, value);
-		if (!getInstant(WheelInstant_t::POSITIONAL_TATICS)) {
+			break;
+		case WheelInstant_t::POSITIONAL_TATICS:
 			setMajorStat(WheelMajor_t::MAGIC, 0);
 			setMajorStat(WheelMajor_t::HOLY_RESISTANCE, 0);
-		}
-	} else if (name == "Ballistic Mastery") {
-		setInstant(WheelInstant_t::BALLISTIC_MASTERY, value);
-		if (!getInstant(WheelInstant_t::BALLISTIC_MASTERY)) {
+			break;
+		case WheelInstant_t::BALLISTIC_MASTERY:
 			setMajorStat(WheelMajor_t::CRITICAL_DMG, 0);
 			setMajorStat(WheelMajor_t::PHYSICAL_DMG, 0);
 			setMajorStat(WheelMajor_t::HOLY_DMG, 0);
-		}
-	} else if (name == "Healing Link") {
-		setInstant(WheelInstant_t::HEALING_LINK, value);
-	} else if (name == "Runic Mastery") {
-		setInstant(WheelInstant_t::RUNIC_MASTERY, value);
-	} else if (name == "Focus Mastery") {
-		setInstant(WheelInstant_t::FOCUS_MASTERY, value);
-		if (!getInstant(WheelInstant_t::FOCUS_MASTERY)) {
+			break;
+		case WheelInstant_t::FOCUS_MASTERY:
 			setOnThinkTimer(WheelOnThink_t::FOCUS_MASTERY, 0);
-		}
-	} else if (name == "Beam Mastery") {
-		if (value) {
-			setStage(WheelStage_t::BEAM_MASTERY, getStage(WheelStage_t::BEAM_MASTERY) + 1);
-		} else {
-			setStage(WheelStage_t::BEAM_MASTERY, 0);
-		}
-	} else if (name == "Combat Mastery") {
-		if (value) {
-			setStage(WheelStage_t::COMBAT_MASTERY, getStage(WheelStage_t::COMBAT_MASTERY) + 1);
-		} else {
-			setStage(WheelStage_t::COMBAT_MASTERY, 0);
-		}
-	} else if (name == "Gift of Life") {
-		if (value) {
-			setStage(WheelStage_t::GIFT_OF_LIFE, getStage(WheelStage_t::GIFT_OF_LIFE) + 1);
-		} else {
-			setStage(WheelStage_t::GIFT_OF_LIFE, 0);
-		}
-	} else if (name == "Blessing of the Grove") {
-		if (value) {
-			setStage(WheelStage_t::BLESSING_OF_THE_GROVE, getStage(WheelStage_t::BLESSING_OF_THE_GROVE) + 1);
-		} else {
-			setStage(WheelStage_t::BLESSING_OF_THE_GROVE, 0);
-		}
-	} else if (name == "Drain Body") {
-		if (value) {
-			setStage(WheelStage_t::DRAIN_BODY, getStage(WheelStage_t::DRAIN_BODY) + 1);
-		} else {
-			setStage(WheelStage_t::DRAIN_BODY, 0);
-		}
-	} else if (name == "Divine Empowerment") {
-		if (value) {
-			setStage(WheelStage_t::DIVINE_EMPOWERMENT, getStage(WheelStage_t::DIVINE_EMPOWERMENT) + 1);
-		} else {
-			setStage(WheelStage_t::DIVINE_EMPOWERMENT, 0);
-		}
-	} else if (name == "Divine Grenade") {
-		if (value) {
-			setStage(WheelStage_t::DIVINE_GRENADE, getStage(WheelStage_t::DIVINE_GRENADE) + 1);
-		} else {
-			setStage(WheelStage_t::DIVINE_GRENADE, 0);
-		}
-	} else if (name == "Twin Burst") {
-		if (value) {
-			setStage(WheelStage_t::TWIN_BURST, getStage(WheelStage_t::TWIN_BURST) + 1);
-		} else {
-			setStage(WheelStage_t::TWIN_BURST, 0);
-		}
-	} else if (name == "Executioner's Throw") {
-		if (value) {
-			setStage(WheelStage_t::EXECUTIONERS_THROW, getStage(WheelStage_t::EXECUTIONERS_THROW) + 1);
-		} else {
-			setStage(WheelStage_t::EXECUTIONERS_THROW, 0);
-		}
-	} else if (name == "Avatar of Light") {
-		if (value) {
-			setStage(WheelStage_t::AVATAR_OF_LIGHT, getStage(WheelStage_t::AVATAR_OF_LIGHT) + 1);
-		} else {
-			setStage(WheelStage_t::AVATAR_OF_LIGHT, 0);
-		}
-	} else if (name == "Avatar of Nature") {
-		if (value) {
-			setStage(WheelStage_t::AVATAR_OF_NATURE, getStage(WheelStage_t::AVATAR_OF_NATURE) + 1);
-		} else {
-			setStage(WheelStage_t::AVATAR_OF_NATURE, 0);
-		}
-	} else if (name == "Avatar of Steel") {
-		if (value) {
-			setStage(WheelStage_t::AVATAR_OF_STEEL, getStage(WheelStage_t::AVATAR_OF_STEEL) + 1);
-		} else {
-			setStage(WheelStage_t::AVATAR_OF_STEEL, 0);
-		}
-	} else if (name == "Avatar of Storm") {
-		if (value) {
-			setStage(WheelStage_t::AVATAR_OF_STORM, getStage(WheelStage_t::AVATAR_OF_STORM) + 1);
-		} else {
-			setStage(WheelStage_t::AVATAR_OF_STORM, 0);
-		}
+			break;
+		default:
+			break;
+	}
+}
+
+void PlayerWheel::setSpellStage(WheelStage_t type, bool value) {
+	if (value) {
+		setStage(type, getStage(type) + 1);
+	} else {
+		setStage(type, 0);
 	}
 }
 
@@ -2382,59 +2375,35 @@ void PlayerWheel::resetResistance() {
 bool PlayerWheel::getInstant(WheelInstant_t type) const {
 	auto enumValue = static_cast<uint8_t>(type);
 	try {
-		return m_instant.at(enumValue);
+		return m_instant.test(enumValue);
 	} catch (const std::out_of_range &e) {
 		g_logger().error("[{}]. Instant type {}. Error message: {}", __FUNCTION__, enumValue, e.what());
 	}
 	return false;
 }
 
-uint8_t PlayerWheel::getStage(const std::string name) const {
-	if (name == "Battle Instinct") {
-		return PlayerWheel::getInstant(WheelInstant_t::BATTLE_INSTINCT);
-	} else if (name == "Battle Healing") {
-		return PlayerWheel::getInstant(WheelInstant_t::BATTLE_HEALING);
-	} else if (name == "Positional Tatics") {
-		return PlayerWheel::getInstant(WheelInstant_t::POSITIONAL_TATICS);
-	} else if (name == "Ballistic Mastery") {
-		return PlayerWheel::getInstant(WheelInstant_t::BALLISTIC_MASTERY);
-	} else if (name == "Healing Link") {
-		return PlayerWheel::getInstant(WheelInstant_t::HEALING_LINK);
-	} else if (name == "Runic Mastery") {
-		return PlayerWheel::getInstant(WheelInstant_t::RUNIC_MASTERY);
-	} else if (name == "Focus Mastery") {
-		return PlayerWheel::getInstant(WheelInstant_t::FOCUS_MASTERY);
-	} else if (name == "Beam Mastery") {
-		return PlayerWheel::getStage(WheelStage_t::BEAM_MASTERY);
-	} else if (name == "Combat Mastery") {
-		return PlayerWheel::getStage(WheelStage_t::COMBAT_MASTERY);
-	} else if (name == "Gift of Life") {
-		return PlayerWheel::getStage(WheelStage_t::GIFT_OF_LIFE);
-	} else if (name == "Blessing of the Grove") {
-		return PlayerWheel::getStage(WheelStage_t::BLESSING_OF_THE_GROVE);
-	} else if (name == "Drain Body") {
-		return PlayerWheel::getStage(WheelStage_t::DRAIN_BODY);
-	} else if (name == "Divine Empowerment") {
-		return PlayerWheel::getStage(WheelStage_t::DIVINE_EMPOWERMENT);
-	} else if (name == "Divine Grenade") {
-		return PlayerWheel::getStage(WheelStage_t::DIVINE_GRENADE);
-	} else if (name == "Twin Burst") {
-		return PlayerWheel::getStage(WheelStage_t::TWIN_BURST);
-	} else if (name == "Executioner's Throw") {
-		return PlayerWheel::getStage(WheelStage_t::EXECUTIONERS_THROW);
-	} else if (name == "Avatar of Light") {
-		return PlayerWheel::getStage(WheelStage_t::AVATAR_OF_LIGHT);
-	} else if (name == "Avatar of Nature") {
-		return PlayerWheel::getStage(WheelStage_t::AVATAR_OF_NATURE);
-	} else if (name == "Avatar of Steel") {
-		return PlayerWheel::getStage(WheelStage_t::AVATAR_OF_STEEL);
-	} else if (name == "Avatar of Storm") {
-		return PlayerWheel::getStage(WheelStage_t::AVATAR_OF_STORM);
+bool PlayerWheel::hasStage(WheelStage_t type) const {
+	auto enumValue = static_cast<uint8_t>(type);
+	try {
+		return m_activeStages.test(enumValue);
+	} catch (const std::out_of_range &e) {
+		g_logger().error("[{}]. Stage type {}. Error message: {}", __FUNCTION__, enumValue, e.what());
 	}
-
 	return false;
 }
 
+uint8_t PlayerWheel::getStage(const std::string &name) const {
+	const auto target = resolveWheelSpellName(name);
+	if (!target) {
+		return 0;
+	}
+
+	if (const auto instant = std::get_if<WheelInstant_t>(&*target)) {
+		return PlayerWheel::getInstant(*instant);
+	}
+	return PlayerWheel::getStage(std::get<WheelStage_t>(*target));
+}
+
 uint8_t PlayerWheel::getStage(WheelStage_t type) const {
 	auto enumValue = static_cast<uint8_t>(type);
 	try {
@@ -2489,7 +2458,7 @@ double PlayerWheel::getMitigationMultiplier() const {
 }
 
 bool PlayerWheel::getHealingLinkUpgrade(const std::string &spell) const {
-	if (!getInstant("Healing Link")) {
+	if (!getInstant(WheelInstant_t::HEALING_LINK)) {
 		return false;
 	}
 	if (spell == "Nature's Embrace" || spell == "Heal Friend") {
@@ -2498,10 +2467,14 @@ bool PlayerWheel::getHealingLinkUpgrade(const std::string &spell) const {
 	return false;
 }
 
-int32_t PlayerWheel::getMajorStatConditional(const std::string &instant, WheelMajor_t major) const {
+int32_t PlayerWheel::getMajorStatConditional(WheelInstant_t instant, WheelMajor_t major) const {
 	return PlayerWheel::getInstant(instant) ? PlayerWheel::getMajorStat(major) : 0;
 }
 
+int32_t PlayerWheel::getMajorStatConditional(WheelStage_t stage, WheelMajor_t major) const {
+	return PlayerWheel::hasStage(stage) ? PlayerWheel::getMajorStat(major) : 0;
+}
+
 int64_t PlayerWheel::getOnThinkTimer(WheelOnThink_t type) const {
 	auto enumValue = static_cast<uint8_t>(type);
 	try {
@@ -2513,50 +2486,16 @@ int64_t PlayerWheel::getOnThinkTimer(WheelOnThink_t type) const {
 	return 0;
 }
 
-bool PlayerWheel::getInstant(const std::string name) const {
-	if (name == "Battle Instinct") {
-		return PlayerWheel::getInstant(WheelInstant_t::BATTLE_INSTINCT);
-	} else if (name == "Battle Healing") {
-		return PlayerWheel::getInstant(WheelInstant_t::BATTLE_HEALING);
-	} else if (name == "Positional Tatics") {
-		return PlayerWheel::getInstant(WheelInstant_t::POSITIONAL_TATICS);
-	} else if (name == "Ballistic Mastery") {
-		return PlayerWheel::getInstant(WheelInstant_t::BALLISTIC_MASTERY);
-	} else if (name == "Healing Link") {
-		return PlayerWheel::getInstant(WheelInstant_t::HEALING_LINK);
-	} else if (name == "Runic Mastery") {
-		return PlayerWheel::getInstant(WheelInstant_t::RUNIC_MASTERY);
-	} else if (name == "Focus Mastery") {
-		return PlayerWheel::getInstant(WheelInstant_t::FOCUS_MASTERY);
-	} else if (name == "Beam Mastery") {
-		return PlayerWheel::getStage(WheelStage_t::BEAM_MASTERY);
-	} else if (name == "Combat Mastery") {
-		return PlayerWheel::getStage(WheelStage_t::COMBAT_MASTERY);
-	} else if (name == "Gift of Life") {
-		return PlayerWheel::getStage(WheelStage_t::GIFT_OF_LIFE);
-	} else if (name == "Blessing of the Grove") {
-		return PlayerWheel::getStage(WheelStage_t::BLESSING_OF_THE_GROVE);
-	} else if (name == "Drain Body") {
-		return PlayerWheel::getStage(WheelStage_t::DRAIN_BODY);
-	} else if (name == "Divine Empowerment") {
-		return PlayerWheel::getStage(WheelStage_t::DIVINE_EMPOWERMENT);
-	} else if (name == "Divine Grenade") {
-		return PlayerWheel::getStage(WheelStage_t::DIVINE_GRENADE);
-	} else if (name == "Twin Burst") {
-		return PlayerWheel::getStage(WheelStage_t::TWIN_BURST);
-	} else if (name == "Executioner's Throw") {
-		return PlayerWheel::getStage(WheelStage_t::EXECUTIONERS_THROW);
-	} else if (name == "Avatar of Light") {
-		return PlayerWheel::getStage(WheelStage_t::AVATAR_OF_LIGHT);
-	} else if (name == "Avatar of Nature") {
-		return PlayerWheel::getStage(WheelStage_t::AVATAR_OF_NATURE);
-	} else if (name == "Avatar of Steel") {
-		return PlayerWheel::getStage(WheelStage_t::AVATAR_OF_STEEL);
-	} else if (name == "Avatar of Storm") {
-		return PlayerWheel::getStage(WheelStage_t::AVATAR_OF_STORM);
+bool PlayerWheel::getInstant(const std::string &name) const {
+	const auto target = resolveWheelSpellName(name);
+	if (!target) {
+		return false;
 	}
 
-	return false;
+	if (const auto instant = std::get_if<WheelInstant_t>(&*target)) {
+		return PlayerWheel::getInstant(*instant);
+	}
+	return PlayerWheel::hasStage(std::get<WheelStage_t>(*target));
 }
 
 // Wheel of destiny - Specific functions
@@ -2650,7 +2589,7 @@ void PlayerWheel::setWheelBonusData(const PlayerWheelMethodsBonusData &newBonusD
 // Functions used to Manage Combat
 uint8_t PlayerWheel::getBeamAffectedTotal(const CombatDamage &tmpDamage) const {
 	uint8_t beamAffectedTotal = 0; // Removed const
-	if (tmpDamage.runeSpellName == "Beam Mastery" && getInstant("Beam Mastery")) {
+	if (tmpDamage.runeSpellName == "Beam Mastery" && hasStage(WheelStage_t::BEAM_MASTERY)) {
 		beamAffectedTotal = 3;
 	}
 	return beamAffectedTotal;
@@ -2665,7 +2604,7 @@ void PlayerWheel::updateBeamMasteryDamage(CombatDamage &tmpDamage, uint8_t &beam
 }
 
 void PlayerWheel::healIfBattleHealingActive() const {
-	if (getInstant("Battle Healing")) {
+	if (getInstant(WheelInstant_t::BATTLE_HEALING)) {
 		CombatDamage damage;
 		damage.primary.value = checkBattleHealingAmount();
 		damage.primary.type = COMBAT_HEALING;
@@ -2717,7 +2656,7 @@ float PlayerWheel::calculateMitigation() const {
 		defenseValue = shield->getDefense();
 		// Wheel of destiny
 		if (shield->getDefense() > 0) {
-			defenseValue += getMajorStatConditional("Combat Mastery", WheelMajor_t::DEFENSE);
+			defenseValue += getMajorStatConditional(WheelStage_t::COMBAT_MASTERY, WheelMajor_t::DEFENSE);
 		}
 	}
 
@@ -245,20 +245,40 @@ public:
 	 * @param value The toggle value to set for the instant.
 	 */
 	void setSpellInstant(const std::string &name, bool value);
+
+	/**
+	 * @brief Toggles a specific instant in the Wheel of Destiny and applies its side effects.
+	 *
+	 * Enum overload of setSpellInstant, used by the wheel loading code so no name has to be resolved.
+	 *
+	 * @param type The type of the instant to set.
+	 * @param value The toggle value to set for the instant.
+	 */
+	void setSpellInstant(WheelInstant_t type, bool value);
+
+	/**
+	 * @brief Increases a specific revelation stage by one, or resets it when value is false.
+	 *
+	 * @param type The type of the stage to change.
+	 * @param value True to increase the stage, false to reset it.
+	 */
+	void setSpellStage(WheelStage_t type, bool value);
 	void resetResistance();
 
 	// Wheel of destiny - Header get:
 	bool getInstant(WheelInstant_t type) const;
+	bool hasStage(WheelStage_t type) const;
 	bool getHealingLinkUpgrade(const std::string &spell) const;
-	uint8_t getStage(const std::string name) const;
+	uint8_t getStage(const std::string &name) const;
 	uint8_t getStage(WheelStage_t type) const;
 	WheelSpellGrade_t getSpellUpgrade(const std::string &name) const;
 	int32_t getMajorStat(WheelMajor_t type) const;
 	int32_t getStat(WheelStat_t type) const;
 	int32_t getResistance(CombatType_t type) const;
-	int32_t getMajorStatConditional(const std::string &instant, WheelMajor_t major) const;
+	int32_t getMajorStatConditional(WheelInstant_t instant, WheelMajor_t major) const;
+	int32_t getMajorStatConditional(WheelStage_t stage, WheelMajor_t major) const;
 	int64_t getOnThinkTimer(WheelOnThink_t type) const;
-	bool getInstant(const std::string name) const;
+	bool getInstant(const std::string &name) const;
 	double getMitigationMultiplier() const;
 
 	// Wheel of destiny - Specific functions
@@ -329,7 +349,9 @@ private:
 	std::array<int64_t, static_cast<size_t>(WheelOnThink_t::TOTAL_COUNT)> m_onThink = { 0 };
 	std::array<int32_t, static_cast<size_t>(WheelStat_t::TOTAL_COUNT)> m_stats = { 0 };
 	std::array<int32_t, static_cast<size_t>(WheelMajor_t::TOTAL_COUNT)> m_majorStats = { 0 };
-	std::array<bool, static_cast<size_t>(WheelInstant_t::TOTAL_COUNT)> m_instant = { false };
+	// Cached flags of the toggled instants and of the stages above zero, so hot paths never compare names
+	std::bitset<static_cast<size_t>(WheelInstant_t::TOTAL_COUNT)> m_instant;
+	std::bitset<static_cast<size_t>(WheelStage_t::TOTAL_COUNT)> m_activeStages;
 	std::array<int32_t, COMBAT_COUNT> m_resistance = { 0 };
 
 	int32_t m_creaturesNearby = 0;
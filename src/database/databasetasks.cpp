@@ -13,6 +13,7 @@
 #include "game/scheduling/dispatcher.hpp"
 #include "lib/thread/thread_pool.hpp"
 #include "lib/di/container.hpp"
+#include "lib/metrics/metrics.hpp"
 
 DatabaseTasks::DatabaseTasks(ThreadPool &threadPool, Database &db) :
 	db(db), threadPool(threadPool) {
@@ -23,8 +24,15 @@ DatabaseTasks &DatabaseTasks::getInstance() {
 }
 
 void DatabaseTasks::execute(const std::string &query, std::function<void(DBResult_ptr, bool)> callback /* nullptr */) {
-	threadPool.addLoad([this, query, callback]() {
+	static auto &latency = g_metrics().histogram("canary_database_task_latency_seconds", "Time from queuing a database task to its query finishing", Metrics::durationBuckets(), { { "call", "execute" } });
+	static auto &duration = g_metrics().histogram("canary_database_query_duration_seconds", "Time spent running the query of a database task", Metrics::durationBuckets(), { { "call", "execute" } });
+
+	const auto queued = std::chrono::steady_clock::now();
+	threadPool.addLoad([this, query, callback, queued]() {
+		const auto start = std::chrono::steady_clock::now();
 		bool success = db.executeQuery(query);
+		duration.observeSince(start);
+		latency.observeSince(queued);
 		if (callback != nullptr) {
 			g_dispatcher().addEvent([callback, success]() { callback(nullptr, success); }, "DatabaseTasks::execute");
 		}
@@ -32,8 +40,15 @@ void DatabaseTasks::execute(const std::string &query, std::function<void(DBResul
 }
 
 void DatabaseTasks::store(const std::string &query, std::function<void(DBResult_ptr, bool)> callback /* nullptr */) {
-	threadPool.addLoad([this, query, callback]() {
+	static auto &latency = g_metrics().histogram("canary_database_task_latency_seconds", "Time from queuing a database task to its query finishing", Metrics::durationBuckets(), { { "call", "store" } });
+	static auto &duration = g_metrics().histogram("canary_database_query_duration_seconds", "Time spent running the query of a database task", Metrics::durationBuckets(), { { "call", "store" } });
+
+	const auto queued = std::chrono::steady_clock::now();
+	threadPool.addLoad([this, query, callback, queued]() {
+		const auto start = std::chrono::steady_clock::now();
 		DBResult_ptr result = db.storeQuery(query);
+		duration.observeSince(start);
+		latency.observeSince(queued);
 		if (callback != nullptr) {
 			g_dispatcher().addEvent([callback, result]() { callback(result, true); }, "DatabaseTasks::store");
 		}
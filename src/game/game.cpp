@@ -11,6 +11,7 @@
 
 #include "lua/creature/actions.hpp"
 #include "items/bed.hpp"
+#include "items/decay/decay.hpp"
 #include "creatures/creature.hpp"
 #include "database/databasetasks.hpp"
 #include "lua/creature/events.hpp"
@@ -18,6 +19,7 @@
 #include "lua/callbacks/events_callbacks.hpp"
 #include "game/game.hpp"
 #include "game/zones/zone.hpp"
+#include "game/highscores/highscore_index.hpp"
 #include "lua/global/globalevent.hpp"
 #include "io/iologindata.hpp"
 #include "io/io_wheel.hpp"
@@ -40,6 +42,9 @@
 #include "server/network/protocol/protocollogin.hpp"
 #include "server/network/protocol/protocolstatus.hpp"
 #include "map/spectators.hpp"
+#include "lib/memory/pool_allocator.hpp"
+#include "lib/metrics/metrics.hpp"
+#include "lib/metrics/metrics_exporter.hpp"
 
 #include "kv/kv.hpp"
 
@@ -165,7 +170,10 @@ namespace InternalGame {
 	}
 } // Namespace InternalGame
 
-Game::Game() {
+Game::Game() :
+	// Room for 65536 npcs and 262144 monsters on the map at once
+	npcs(Npc::getFirstID(), Npc::getLastID(), 16),
+	monsters(Monster::getFirstID(), Monster::getLastID(), 18) {
 	offlineTrainingWindow.choices.emplace_back("Sword Fighting and Shielding", SKILL_SWORD);
 	offlineTrainingWindow.choices.emplace_back("Axe Fighting and Shielding", SKILL_AXE);
 	offlineTrainingWindow.choices.emplace_back("Club Fighting and Shielding", SKILL_CLUB);
@@ -184,7 +192,7 @@ Game::Game() {
 Game::~Game() = default;
 
 void Game::resetMonsters() const {
-	for (const auto &[monsterId, monster] : getMonsters()) {
+	for (const auto &monster : getMonsters()) {
 		monster->clearTargetList();
 		monster->clearFriendList();
 	}
@@ -192,7 +200,7 @@ void Game::resetMonsters() const {
 
 void Game::resetNpcs() const {
 	// Close shop window from all npcs and reset the shopPlayerSet
-	for (const auto &[npcId, npc] : getNpcs()) {
+	for (const auto &npc : getNpcs()) {
 		npc->closeAllShopWindows();
 		npc->resetPlayerInteractions();
 	}
@@ -296,6 +304,53 @@ void Game::start(ServiceManager* manager) {
 	g_dispatcher().cycleEvent(
 		EVENT_LUA_GARBAGE_COLLECTION, [this] { g_luaEnvironment().collectGarbage(); }, "Calling GC"
 	);
+
+	if (g_configManager().getBoolean(METRICS_ENABLED)) {
+		const auto interval = std::max(1000, g_configManager().getNumber(METRICS_INTERVAL));
+		g_metricsExporter().start(g_configManager().getString(METRICS_HOST), static_cast<uint16_t>(g_configManager().getNumber(METRICS_PORT)), g_configManager().getString(METRICS_FILE), std::chrono::milliseconds(interval));
+		updateMetrics();
+		g_dispatcher().cycleEvent(interval, std::bind(&Game::updateMetrics, this), "Game::updateMetrics");
+	}
+}
+
+void Game::updateMetrics() {
+	// Game state is only read on the dispatcher, the exporter thread just reads the gauges
+	static auto &playersOnline = g_metrics().gauge("canary_players_online", "Players logged in");
+	static auto &monsters = g_metrics().gauge("canary_creatures", "Creatures on the map, by kind", { { "kind", "monster" } });
+	static auto &npcs = g_metrics().gauge("canary_creatures", "Creatures on the map, by kind", { { "kind", "npc" } });
+	static auto &connections = g_metrics().gauge("canary_network_connections", "Open client connections");
+	static auto &luaMemory = g_metrics().gauge("canary_lua_memory_bytes", "Memory held by the Lua state");
+	static auto &cachedTiles = g_metrics().gauge("canary_map_tiles", "Map tiles, cached ones are created on first access", { { "state", "cached" } });
+	static auto &loadedTiles = g_metrics().gauge("canary_map_tiles", "Map tiles, cached ones are created on first access", { { "state", "loaded" } });
+	static auto &decayingItems = g_metrics().gauge("canary_decaying_items", "Items waiting in the decay wheel");
+	static auto &decayTicks = g_metrics().gauge("canary_decay_last_check_ticks", "Wheel ticks advanced by the last decay check");
+	static auto &decayExpired = g_metrics().gauge("canary_decay_last_check_items", "Items handled by the last decay check, by step", { { "step", "expired" } });
+	static auto &decayCascaded = g_metrics().gauge("canary_decay_last_check_items", "Items handled by the last decay check, by step", { { "step", "cascaded" } });
+	static auto &decayDuration = g_metrics().gauge("canary_decay_last_check_microseconds", "Time spent in the last decay check");
+	static auto &droppedLogs = g_metrics().counter("canary_log_dropped_messages_total", "Log messages dropped because the log queue was full");
+
+	playersOnline.set(static_cast<int64_t>(getPlayersOnline()));
+	monsters.set(static_cast<int64_t>(getMonstersOnline()));
+	npcs.set(static_cast<int64_t>(getNpcsOnline()));
+	connections.set(static_cast<int64_t>(ConnectionManager::getInstance().getConnectionCount()));
+
+	if (lua_State* L = g_luaEnvironment().getLuaState()) {
+		luaMemory.set(static_cast<int64_t>(lua_gc(L, LUA_GCCOUNT, 0)) * 1024 + lua_gc(L, LUA_GCCOUNTB, 0));
+	}
+	g_luaEnvironment().updateTimerMetrics();
+
+	cachedTiles.set(static_cast<int64_t>(map.getCachedTileCount()));
+	loadedTiles.set(static_cast<int64_t>(map.getLoadedTileCount()));
+
+	const auto &decayStats = g_decay().getLastTickStats();
+	decayingItems.set(static_cast<int64_t>(g_decay().getDecayingCount()));
+	decayTicks.set(decayStats.ticks);
+	decayExpired.set(decayStats.expired);
+	decayCascaded.set(decayStats.cascaded);
+	decayDuration.set(decayStats.durationUs);
+
+	PoolArena::exportMetrics(g_metrics());
+	droppedLogs.set(g_logger().getDroppedMessages());
 }
 
 GameState_t Game::getGameState() const {
@@ -417,9 +472,18 @@ bool Game::loadItemsPrice() {
 }
 
 void Game::loadMainMap(const std::string &filename) {
+	loadMainMapFile(filename);
+	loadMainMapData();
+}
+
+void Game::loadMainMapFile(const std::string &filename) {
+	map.loadMapFile(g_configManager().getString(DATA_DIRECTORY) + "/world/" + filename + ".otbm", true);
+}
+
+void Game::loadMainMapData() {
 	Monster::despawnRange = g_configManager().getNumber(DEFAULT_DESPAWNRANGE);
 	Monster::despawnRadius = g_configManager().getNumber(DEFAULT_DESPAWNRADIUS);
-	map.loadMap(g_configManager().getString(DATA_DIRECTORY) + "/world/" + filename + ".otbm", true, true, true, true, true);
+	map.loadMapData(true, true, true, true, true);
 }
 
 void Game::loadCustomMaps(const std::filesystem::path &customMapPath) {
@@ -657,38 +721,20 @@ void Game::internalGetPosition(std::shared_ptr<Item> item, Position &pos, uint8_
 std::shared_ptr<Creature> Game::getCreatureByID(uint32_t id) {
 	if (id >= Player::getFirstID() && id <= Player::getLastID()) {
 		return getPlayerByID(id);
-	} else if (id <= Monster::monsterAutoID) {
+	} else if (id >= Monster::getFirstID() && id <= Monster::getLastID()) {
 		return getMonsterByID(id);
-	} else if (id <= Npc::npcAutoID) {
+	} else if (id >= Npc::getFirstID()) {
 		return getNpcByID(id);
-	} else {
-		g_logger().warn("Creature with id {} not exists");
 	}
 	return nullptr;
 }
 
 std::shared_ptr<Monster> Game::getMonsterByID(uint32_t id) {
-	if (id == 0) {
-		return nullptr;
-	}
-
-	auto it = monsters.find(id);
-	if (it == monsters.end()) {
-		return nullptr;
-	}
-	return it->second;
+	return monsters.find(id);
 }
 
 std::shared_ptr<Npc> Game::getNpcByID(uint32_t id) {
-	if (id == 0) {
-		return nullptr;
-	}
-
-	auto it = npcs.find(id);
-	if (it == npcs.end()) {
-		return nullptr;
-	}
-	return it->second;
+	return npcs.find(id);
 }
 
 std::shared_ptr<Player> Game::getPlayerByID(uint32_t id, bool loadTmp /* = false */) {
@@ -719,15 +765,15 @@ std::shared_ptr<Creature> Game::getCreatureByName(const std::string &s) {
 		return m_it->second.lock();
 	}
 
-	for (const auto &it : npcs) {
-		if (lowerCaseName == asLowerCaseString(it.second->getName())) {
-			return it.second;
+	for (const auto &npc : npcs.values()) {
+		if (lowerCaseName == asLowerCaseString(npc->getName())) {
+			return npc;
 		}
 	}
 
-	for (const auto &it : monsters) {
-		if (lowerCaseName == asLowerCaseString(it.second->getName())) {
-			return it.second;
+	for (const auto &monster : monsters.values()) {
+		if (lowerCaseName == asLowerCaseString(monster->getName())) {
+			return monster;
 		}
 	}
 	return nullptr;
@@ -739,9 +785,9 @@ std::shared_ptr<Npc> Game::getNpcByName(const std::string &s) {
 	}
 
 	const char* npcName = s.c_str();
-	for (const auto &it : npcs) {
-		if (strcasecmp(npcName, it.second->getName().c_str()) == 0) {
-			return it.second;
+	for (const auto &npc : npcs.values()) {
+		if (strcasecmp(npcName, npc->getName().c_str()) == 0) {
+			return npc;
 		}
 	}
 	return nullptr;
@@ -1023,6 +1069,11 @@ FILELOADER_ERRORS Game::loadAppearanceProtobuf(const std::string &file) {
 
 	// Only iterate other objects if necessary
 	if (g_configManager().getBoolean(WARN_UNSAFE_SCRIPTS)) {
+		// Already filled when the items were loaded from the items snapshot
+		registeredMagicEffects.clear();
+		registeredDistanceEffects.clear();
+		registeredLookTypes.clear();
+
 		// Registering distance effects
 		for (uint32_t it = 0; it < appearances.effect_size(); it++) {
 			registeredMagicEffects.push_back(static_cast<uint16_t>(appearances.effect(it).id()));
@@ -3851,6 +3902,7 @@ void Game::playerSetShowOffSocket(uint32_t playerId, Outfit_t &outfit, const Pos
 	}
 
 	// Send to client
+	tile->invalidateItemsEncoding();
 	for (const auto &spectator : Spectators().find<Player>(pos, true)) {
 		spectator->getPlayer()->sendUpdateTileItem(tile, pos, item);
 	}
@@ -5821,8 +5873,14 @@ void Game::changeSpeed(std::shared_ptr<Creature> creature, int32_t varSpeedDelta
 	creature->setSpeed(varSpeed);
 
 	// Send to clients
-	for (const auto &spectator : Spectators().find<Player>(creature->getPosition())) {
-		spectator->getPlayer()->sendChangeSpeed(creature, creature->getStepSpeed());
+	auto spectators = Spectators().find<Player>(creature->getPosition());
+	if (spectators.empty()) {
+		return;
+	}
+
+	const auto broadcast = ProtocolGame::createChangeSpeedBroadcast(creature, creature->getStepSpeed());
+	for (const auto &spectator : spectators) {
+		spectator->getPlayer()->sendBroadcast(broadcast);
 	}
 }
 
@@ -5830,8 +5888,14 @@ void Game::setCreatureSpeed(std::shared_ptr<Creature> creature, int32_t speed) {
 	creature->setBaseSpeed(static_cast<uint16_t>(speed));
 
 	// Send creature speed to client
-	for (const auto &spectator : Spectators().find<Player>(creature->getPosition())) {
-		spectator->getPlayer()->sendChangeSpeed(creature, creature->getStepSpeed());
+	auto spectators = Spectators().find<Player>(creature->getPosition());
+	if (spectators.empty()) {
+		return;
+	}
+
+	const auto broadcast = ProtocolGame::createChangeSpeedBroadcast(creature, creature->getStepSpeed());
+	for (const auto &spectator : spectators) {
+		spectator->getPlayer()->sendBroadcast(broadcast);
 	}
 }
 
@@ -5842,8 +5906,14 @@ void Game::changePlayerSpeed(const std::shared_ptr<Player> &player, int32_t varS
 	player->setSpeed(varSpeed);
 
 	// Send new player speed to the spectators
-	for (const auto &creatureSpectator : Spectators().find<Player>(player->getPosition())) {
-		creatureSpectator->getPlayer()->sendChangeSpeed(player, player->getStepSpeed());
+	auto spectators = Spectators().find<Player>(player->getPosition());
+	if (spectators.empty()) {
+		return;
+	}
+
+	const auto broadcast = ProtocolGame::createChangeSpeedBroadcast(player, player->getStepSpeed());
+	for (const auto &creatureSpectator : spectators) {
+		creatureSpectator->getPlayer()->sendBroadcast(broadcast);
 	}
 }
 
@@ -6293,7 +6363,7 @@ void Game::applyWheelOfDestinyHealing(CombatDamage &damage, std::shared_ptr<Play
 			combatChangeHealth(attackerPlayer, attackerPlayer, tmpDamage);
 		}
 
-		if (attackerPlayer->wheel()->getInstant("Blessing of the Grove")) {
+		if (attackerPlayer->wheel()->hasStage(WheelStage_t::BLESSING_OF_THE_GROVE)) {
 			damage.primary.value += (damage.primary.value * attackerPlayer->wheel()->checkBlessingGroveHealingByTarget(target)) / 100.;
 		}
 	}
@@ -6344,7 +6414,7 @@ int32_t Game::applyHealthChange(CombatDamage &damage, std::shared_ptr<Creature>
 
 	// Wheel of destiny (Gift of Life)
 	if (std::shared_ptr<Player> targetPlayer = target->getPlayer()) {
-		if (targetPlayer->wheel()->getInstant("Gift of Life") && targetPlayer->wheel()->getGiftOfCooldown() == 0 && (damage.primary.value + damage.secondary.value) >= targetHealth) {
+		if (targetPlayer->wheel()->hasStage(WheelStage_t::GIFT_OF_LIFE) && targetPlayer->wheel()->getGiftOfCooldown() == 0 && (damage.primary.value + damage.secondary.value) >= targetHealth) {
 			int32_t overkillMultiplier = (damage.primary.value + damage.secondary.value) - targetHealth;
 			overkillMultiplier = (overkillMultiplier * 100) / targetPlayer->getMaxHealth();
 			if (overkillMultiplier <= targetPlayer->wheel()->getGiftOfLifeValue()) {
@@ -7255,9 +7325,14 @@ void Game::addCreatureHealth(const CreatureVector &spectators, std::shared_ptr<C
 			}
 		}
 	}
+	if (spectators.empty() || target->isHealthHidden()) {
+		return;
+	}
+
+	const auto broadcast = ProtocolGame::createCreatureHealthBroadcast(target);
 	for (const auto &spectator : spectators) {
 		if (const auto &tmpPlayer = spectator->getPlayer()) {
-			tmpPlayer->sendCreatureHealth(target);
+			tmpPlayer->sendBroadcast(broadcast);
 		}
 	}
 }
@@ -7285,9 +7360,14 @@ void Game::addMagicEffect(const Position &pos, uint16_t effect) {
 }
 
 void Game::addMagicEffect(const CreatureVector &spectators, const Position &pos, uint16_t effect) {
+	if (spectators.empty()) {
+		return;
+	}
+
+	const auto broadcast = ProtocolGame::createMagicEffectBroadcast(pos, effect);
 	for (const auto &spectator : spectators) {
 		if (const auto &tmpPlayer = spectator->getPlayer()) {
-			tmpPlayer->sendMagicEffect(pos, effect);
+			tmpPlayer->sendMagicEffect(pos, broadcast);
 		}
 	}
 }
@@ -7311,20 +7391,43 @@ void Game::addDistanceEffect(const Position &fromPos, const Position &toPos, uin
 }
 
 void Game::addDistanceEffect(const CreatureVector &spectators, const Position &fromPos, const Position &toPos, uint16_t effect) {
+	if (spectators.empty()) {
+		return;
+	}
+
+	const auto broadcast = ProtocolGame::createDistanceShootBroadcast(fromPos, toPos, effect);
 	for (const auto &spectator : spectators) {
 		if (const auto &tmpPlayer = spectator->getPlayer()) {
-			tmpPlayer->sendDistanceShoot(fromPos, toPos, effect);
+			tmpPlayer->sendBroadcast(broadcast);
 		}
 	}
 }
 
 void Game::checkImbuements() {
-	for (const auto &[mapPlayerId, mapPlayer] : getPlayers()) {
-		if (!mapPlayer) {
+	if (imbuementTickingPlayers.empty()) {
+		return;
+	}
+
+	// Decaying can take a player out of the set
+	const std::vector<uint32_t> playerIds(imbuementTickingPlayers.begin(), imbuementTickingPlayers.end());
+	for (uint32_t playerId : playerIds) {
+		const auto &player = getPlayerByID(playerId);
+		if (!player) {
+			imbuementTickingPlayers.erase(playerId);
 			continue;
 		}
 
-		mapPlayer->updateInventoryImbuement();
+		player->updateInventoryImbuement();
+		player->updateImbuementTicking();
+	}
+}
+
+void Game::setImbuementTicking(const std::shared_ptr<Player> &player, bool ticking) {
+	// Offline players loaded for a moment must not join
+	if (ticking && players.contains(player->getID())) {
+		imbuementTickingPlayers.emplace(player->getID());
+	} else {
+		imbuementTickingPlayers.erase(player->getID());
 	}
 }
 
@@ -7423,6 +7526,8 @@ void Game::shutdown() {
 	}
 
 	ConnectionManager::getInstance().closeAll();
+	g_metricsExporter().stop();
+	g_ioMarket().flushWrites();
 
 	g_luaEnvironment().collectGarbage();
 
@@ -7894,206 +7999,24 @@ void Game::playerCyclopediaCharacterInfo(std::shared_ptr<Player> player, uint32_
 	}
 }
 
-std::string Game::generateHighscoreQueryForEntries(const std::string &categoryName, uint32_t page, uint8_t entriesPerPage, uint32_t vocation) {
-	std::ostringstream query;
-	uint32_t startPage = (static_cast<uint32_t>(page - 1) * static_cast<uint32_t>(entriesPerPage));
-	uint32_t endPage = startPage + static_cast<uint32_t>(entriesPerPage);
-
-	query << "SELECT *, @row AS `entries`, " << page << " AS `page` FROM (SELECT *, (@row := @row + 1) AS `rn` FROM (SELECT `id`, `name`, `level`, `vocation`, `"
-		  << categoryName << "` AS `points`, @curRank := IF(@prevRank = `" << categoryName << "`, @curRank, IF(@prevRank := `" << categoryName
-		  << "`, @curRank + 1, @curRank + 1)) AS `rank` FROM `players` `p`, (SELECT @curRank := 0, @prevRank := NULL, @row := 0) `r` WHERE `group_id` < "
-		  << static_cast<int>(account::GROUP_TYPE_GAMEMASTER) << " ORDER BY `" << categoryName << "` DESC) `t`";
-
-	if (vocation != 0xFFFFFFFF) {
-		query << generateVocationConditionHighscore(vocation);
-	}
-	query << ") `T` WHERE `rn` > " << startPage << " AND `rn` <= " << endPage;
-
-	return query.str();
-}
-
-std::string Game::generateHighscoreQueryForOurRank(const std::string &categoryName, uint8_t entriesPerPage, uint32_t playerGUID, uint32_t vocation) {
-	std::ostringstream query;
-	std::string entriesStr = std::to_string(entriesPerPage);
-
-	query << "SELECT *, @row AS `entries`, (@ourRow DIV " << entriesStr << ") + 1 AS `page` FROM (SELECT *, (@row := @row + 1) AS `rn`, @ourRow := IF(`id` = "
-		  << playerGUID << ", @row - 1, @ourRow) AS `rw` FROM (SELECT `id`, `name`, `level`, `vocation`, `" << categoryName << "` AS `points`, @curRank := IF(@prevRank = `"
-		  << categoryName << "`, @curRank, IF(@prevRank := `" << categoryName << "`, @curRank + 1, @curRank + 1)) AS `rank` FROM `players` `p`, (SELECT @curRank := 0, @prevRank := NULL, @row := 0, @ourRow := 0) `r` WHERE `group_id` < "
-		  << static_cast<int>(account::GROUP_TYPE_GAMEMASTER) << " ORDER BY `" << categoryName << "` DESC) `t`";
-
-	if (vocation != 0xFFFFFFFF) {
-		query << generateVocationConditionHighscore(vocation);
-	}
-	query << ") `T` WHERE `rn` > ((@ourRow DIV " << entriesStr << ") * " << entriesStr << ") AND `rn` <= (((@ourRow DIV " << entriesStr << ") * " << entriesStr << ") + " << entriesStr << ")";
-
-	return query.str();
-}
-
-std::string Game::generateVocationConditionHighscore(uint32_t vocation) {
-	std::ostringstream queryPart;
-	bool firstVocation = true;
-
-	const auto vocationsMap = g_vocations().getVocations();
-	for (const auto &it : vocationsMap) {
-		const auto &voc = it.second;
-		if (voc.getFromVocation() == vocation) {
-			if (firstVocation) {
-				queryPart << " WHERE `vocation` = " << voc.getId();
-				firstVocation = false;
-			} else {
-				queryPart << " OR `vocation` = " << voc.getId();
-			}
-		}
-	}
-
-	return queryPart.str();
-}
-
-void Game::processHighscoreResults(DBResult_ptr result, uint32_t playerID, uint8_t category, uint32_t vocation, uint8_t entriesPerPage) {
-	std::shared_ptr<Player> player = g_game().getPlayerByID(playerID);
-	if (!player) {
-		return;
-	}
-
-	player->resetAsyncOngoingTask(PlayerAsyncTask_Highscore);
-
-	if (!result) {
-		player->sendHighscoresNoData();
-		return;
-	}
-
-	uint16_t page = result->getNumber<uint16_t>("page");
-	uint32_t pages = result->getNumber<uint32_t>("entries");
-	pages += entriesPerPage - 1;
-	pages /= entriesPerPage;
-
-	std::ostringstream cacheKeyStream;
-	cacheKeyStream << "Highscore_" << static_cast<int>(category) << "_" << static_cast<int>(vocation) << "_" << static_cast<int>(entriesPerPage) << "_" << page;
-	std::string cacheKey = cacheKeyStream.str();
-
-	auto it = highscoreCache.find(cacheKey);
-	auto now = std::chrono::system_clock::now();
-	if (it != highscoreCache.end() && (now - it->second.timestamp < HIGHSCORE_CACHE_EXPIRATION_TIME)) {
-		auto &cacheEntry = it->second;
-		auto cachedTime = it->second.timestamp;
-		auto durationSinceEpoch = cachedTime.time_since_epoch();
-		auto secondsSinceEpoch = std::chrono::duration_cast<std::chrono::seconds>(durationSinceEpoch).count();
-		auto updateTimer = static_cast<uint32_t>(secondsSinceEpoch);
-		player->sendHighscores(cacheEntry.characters, category, vocation, cacheEntry.page, static_cast<uint16_t>(cacheEntry.entriesPerPage), updateTimer);
-	} else {
-		std::vector<HighscoreCharacter> characters;
-		characters.reserve(result->countResults());
-		if (result) {
-			do {
-				uint8_t characterVocation;
-				const auto &voc = g_vocations().getVocation(result->getNumber<uint16_t>("vocation"));
-				if (voc) {
-					characterVocation = voc->getClientId();
-				} else {
-					characterVocation = 0;
-				}
-				characters.emplace_back(std::move(result->getString("name")), result->getNumber<uint64_t>("points"), result->getNumber<uint32_t>("id"), result->getNumber<uint32_t>("rank"), result->getNumber<uint16_t>("level"), characterVocation);
-			} while (result->next());
-		}
-
-		player->sendHighscores(characters, category, vocation, page, static_cast<uint16_t>(pages), getTimeNow());
-		highscoreCache[cacheKey] = { characters, page, pages, now };
-	}
-}
-
-void Game::cacheQueryHighscore(const std::string &key, const std::string &query, uint32_t page, uint8_t entriesPerPage) {
-	QueryHighscoreCacheEntry queryEntry { query, page, entriesPerPage, std::chrono::steady_clock::now() };
-	queryCache[key] = queryEntry;
-}
-
-std::string Game::generateHighscoreOrGetCachedQueryForEntries(const std::string &categoryName, uint32_t page, uint8_t entriesPerPage, uint32_t vocation) {
-	std::ostringstream cacheKeyStream;
-	cacheKeyStream << "Entries_" << categoryName << "_" << page << "_" << static_cast<int>(entriesPerPage) << "_" << vocation;
-	std::string cacheKey = cacheKeyStream.str();
-
-	if (queryCache.find(cacheKey) != queryCache.end()) {
-		const QueryHighscoreCacheEntry &cachedEntry = queryCache[cacheKey];
-		if (cachedEntry.page == page) {
-			return cachedEntry.query;
-		}
-	}
-
-	std::string newQuery = generateHighscoreQueryForEntries(categoryName, page, entriesPerPage, vocation);
-	cacheQueryHighscore(cacheKey, newQuery, page, entriesPerPage);
-
-	return newQuery;
-}
-
-std::string Game::generateHighscoreOrGetCachedQueryForOurRank(const std::string &categoryName, uint8_t entriesPerPage, uint32_t playerGUID, uint32_t vocation) {
-	std::ostringstream cacheKeyStream;
-	cacheKeyStream << "OurRank_" << categoryName << "_" << static_cast<int>(entriesPerPage) << "_" << playerGUID << "_" << vocation;
-	std::string cacheKey = cacheKeyStream.str();
-
-	if (queryCache.find(cacheKey) != queryCache.end()) {
-		const QueryHighscoreCacheEntry &cachedEntry = queryCache[cacheKey];
-		if (cachedEntry.page == entriesPerPage) {
-			return cachedEntry.query;
-		}
-	}
-
-	std::string newQuery = generateHighscoreQueryForOurRank(categoryName, entriesPerPage, playerGUID, vocation);
-	cacheQueryHighscore(cacheKey, newQuery, entriesPerPage, entriesPerPage);
-
-	return newQuery;
-}
-
 void Game::playerHighscores(std::shared_ptr<Player> player, HighscoreType_t type, uint8_t category, uint32_t vocation, const std::string &, uint16_t page, uint8_t entriesPerPage) {
-	if (player->hasAsyncOngoingTask(PlayerAsyncTask_Highscore)) {
-		return;
+	if (category >= HIGHSCORE_CATEGORY_COUNT) {
+		category = HIGHSCORE_CATEGORY_EXPERIENCE;
 	}
 
-	std::string categoryName;
-	switch (category) {
-		case HIGHSCORE_CATEGORY_FIST_FIGHTING:
-			categoryName = "skill_fist";
-			break;
-		case HIGHSCORE_CATEGORY_CLUB_FIGHTING:
-			categoryName = "skill_club";
-			break;
-		case HIGHSCORE_CATEGORY_SWORD_FIGHTING:
-			categoryName = "skill_sword";
-			break;
-		case HIGHSCORE_CATEGORY_AXE_FIGHTING:
-			categoryName = "skill_axe";
-			break;
-		case HIGHSCORE_CATEGORY_DISTANCE_FIGHTING:
-			categoryName = "skill_dist";
-			break;
-		case HIGHSCORE_CATEGORY_SHIELDING:
-			categoryName = "skill_shielding";
-			break;
-		case HIGHSCORE_CATEGORY_FISHING:
-			categoryName = "skill_fishing";
-			break;
-		case HIGHSCORE_CATEGORY_MAGIC_LEVEL:
-			categoryName = "maglevel";
-			break;
-		default: {
-			category = HIGHSCORE_CATEGORY_EXPERIENCE;
-			categoryName = "experience";
-			break;
-		}
-	}
-
-	std::string query;
+	std::optional<HighscorePage> highscores;
 	if (type == HIGHSCORE_GETENTRIES) {
-		query = generateHighscoreOrGetCachedQueryForEntries(categoryName, page, entriesPerPage, vocation);
+		highscores = g_highscoreIndex().getEntries(category, vocation, page, entriesPerPage);
 	} else if (type == HIGHSCORE_OURRANK) {
-		query = generateHighscoreOrGetCachedQueryForOurRank(categoryName, entriesPerPage, player->getGUID(), vocation);
+		highscores = g_highscoreIndex().getOurRank(category, vocation, player->getGUID(), entriesPerPage);
 	}
 
-	uint32_t playerID = player->getID();
-	std::function<void(DBResult_ptr, bool)> callback = [this, playerID, category, vocation, entriesPerPage](DBResult_ptr result, bool) {
-		processHighscoreResults(std::move(result), playerID, category, vocation, entriesPerPage);
-	};
+	if (!highscores) {
+		player->sendHighscoresNoData();
+		return;
+	}
 
-	g_databaseTasks().store(query, callback);
-	player->addAsyncOngoingTask(PlayerAsyncTask_Highscore);
+	player->sendHighscores(highscores->characters, category, vocation, highscores->page, highscores->pages, getTimeNow());
 }
 
 void Game::playerReportRuleViolationReport(uint32_t playerId, const std::string &targetName, uint8_t reportType, uint8_t reportReason, const std::string &comment, const std::string &translation) {
@@ -8201,8 +8124,8 @@ void Game::playerBrowseMarket(uint32_t playerId, uint16_t itemId, uint8_t tier)
 		return;
 	}
 
-	const MarketOfferList &buyOffers = IOMarket::getActiveOffers(MARKETACTION_BUY, it.id, tier);
-	const MarketOfferList &sellOffers = IOMarket::getActiveOffers(MARKETACTION_SELL, it.id, tier);
+	const MarketOfferList &buyOffers = g_ioMarket().getActiveOffers(MARKETACTION_BUY, it.id, tier);
+	const MarketOfferList &sellOffers = g_ioMarket().getActiveOffers(MARKETACTION_SELL, it.id, tier);
 	player->sendMarketBrowseItem(it.id, buyOffers, sellOffers, tier);
 	player->sendMarketDetail(it.id, tier);
 }
@@ -8217,8 +8140,8 @@ void Game::playerBrowseMarketOwnOffers(uint32_t playerId) {
 		return;
 	}
 
-	const MarketOfferList &buyOffers = IOMarket::getOwnOffers(MARKETACTION_BUY, player->getGUID());
-	const MarketOfferList &sellOffers = IOMarket::getOwnOffers(MARKETACTION_SELL, player->getGUID());
+	const MarketOfferList &buyOffers = g_ioMarket().getOwnOffers(MARKETACTION_BUY, player->getGUID());
+	const MarketOfferList &sellOffers = g_ioMarket().getOwnOffers(MARKETACTION_SELL, player->getGUID());
 	player->sendMarketBrowseOwnOffers(buyOffers, sellOffers);
 }
 
@@ -8363,7 +8286,7 @@ bool checkCanInitCreateMarketOffer(std::shared_ptr<Player> player, uint8_t type,
 	}
 
 	const uint32_t maxOfferCount = g_configManager().getNumber(MAX_MARKET_OFFERS_AT_A_TIME_PER_PLAYER);
-	if (maxOfferCount != 0 && IOMarket::getPlayerOfferCount(player->getGUID()) >= maxOfferCount) {
+	if (maxOfferCount != 0 && g_ioMarket().getPlayerOfferCount(player->getGUID()) >= maxOfferCount) {
 		offerStatus << "Player " << player->getName() << "excedeed max offer count " << maxOfferCount;
 		return false;
 	}
@@ -8444,7 +8367,7 @@ void Game::playerCreateMarketOffer(uint32_t playerId, uint8_t type, uint16_t ite
 		return;
 	}
 
-	IOMarket::createOffer(player->getGUID(), static_cast<MarketAction_t>(type), it.id, amount, price, tier, anonymous);
+	g_ioMarket().createOffer(player->getGUID(), player->getName(), static_cast<MarketAction_t>(type), it.id, amount, price, tier, anonymous);
 
 	// uint8_t = tier, uint64_t price
 	std::map<uint8_t, uint64_t> tierAndPriceMap;
@@ -8457,8 +8380,8 @@ void Game::playerCreateMarketOffer(uint32_t playerId, uint8_t type, uint16_t ite
 		itemsPriceMap[it.id] = tierAndPriceMap;
 	}
 
-	const MarketOfferList &buyOffers = IOMarket::getActiveOffers(MARKETACTION_BUY, it.id, tier);
-	const MarketOfferList &sellOffers = IOMarket::getActiveOffers(MARKETACTION_SELL, it.id, tier);
+	const MarketOfferList &buyOffers = g_ioMarket().getActiveOffers(MARKETACTION_BUY, it.id, tier);
+	const MarketOfferList &sellOffers = g_ioMarket().getActiveOffers(MARKETACTION_SELL, it.id, tier);
 	player->sendMarketBrowseItem(it.id, buyOffers, sellOffers, tier);
 
 	// Exhausted for create offert in the market
@@ -8481,7 +8404,7 @@ void Game::playerCancelMarketOffer(uint32_t playerId, uint32_t timestamp, uint16
 		return;
 	}
 
-	MarketOfferEx offer = IOMarket::getOfferByCounter(timestamp, counter);
+	MarketOfferEx offer = g_ioMarket().getOfferByCounter(timestamp, counter);
 	if (offer.id == 0 || offer.playerId != player->getGUID()) {
 		return;
 	}
@@ -8535,7 +8458,7 @@ void Game::playerCancelMarketOffer(uint32_t playerId, uint32_t timestamp, uint16
 		}
 	}
 
-	IOMarket::moveOfferToHistory(offer.id, OFFERSTATE_CANCELLED);
+	g_ioMarket().moveOfferToHistory(offer.id, OFFERSTATE_CANCELLED);
 
 	offer.amount = 0;
 	offer.timestamp += g_configManager().getNumber(MARKET_OFFER_DURATION);
@@ -8565,7 +8488,7 @@ void Game::playerAcceptMarketOffer(uint32_t playerId, uint32_t timestamp, uint16
 		return;
 	}
 
-	MarketOfferEx offer = IOMarket::getOfferByCounter(timestamp, counter);
+	MarketOfferEx offer = g_ioMarket().getOfferByCounter(timestamp, counter);
 	if (offer.id == 0) {
 		offerStatus << "Failed to load offer id";
 		return;
@@ -8803,16 +8726,16 @@ void Game::playerAcceptMarketOffer(uint32_t playerId, uint32_t timestamp, uint16
 
 	const int32_t marketOfferDuration = g_configManager().getNumber(MARKET_OFFER_DURATION);
 
-	IOMarket::appendHistory(player->getGUID(), (offer.type == MARKETACTION_BUY ? MARKETACTION_SELL : MARKETACTION_BUY), offer.itemId, amount, offer.price, time(nullptr), offer.tier, OFFERSTATE_ACCEPTEDEX);
+	g_ioMarket().appendHistory(player->getGUID(), (offer.type == MARKETACTION_BUY ? MARKETACTION_SELL : MARKETACTION_BUY), offer.itemId, amount, offer.price, time(nullptr), offer.tier, OFFERSTATE_ACCEPTEDEX);
 
-	IOMarket::appendHistory(offer.playerId, offer.type, offer.itemId, amount, offer.price, time(nullptr), offer.tier, OFFERSTATE_ACCEPTED);
+	g_ioMarket().appendHistory(offer.playerId, offer.type, offer.itemId, amount, offer.price, time(nullptr), offer.tier, OFFERSTATE_ACCEPTED);
 
 	offer.amount -= amount;
 
 	if (offer.amount == 0) {
-		IOMarket::deleteOffer(offer.id);
+		g_ioMarket().deleteOffer(offer.id);
 	} else {
-		IOMarket::acceptOffer(offer.id, amount);
+		g_ioMarket().acceptOffer(offer.id, amount);
 	}
 
 	offer.timestamp += marketOfferDuration;
@@ -9068,6 +8991,7 @@ void Game::playerSetMonsterPodium(uint32_t playerId, uint32_t monsterRaceId, con
 		item->removeAttribute(ItemAttribute_t::NAME);
 	}
 
+	tile->invalidateItemsEncoding();
 	for (const auto &spectator : Spectators().find<Player>(pos, true)) {
 		spectator->getPlayer()->sendUpdateTileItem(tile, pos, item);
 	}
@@ -9244,6 +9168,8 @@ void Game::addPlayer(std::shared_ptr<Player> player) {
 	mappedPlayerNames[lowercase_name] = player;
 	wildcardTree.insert(lowercase_name);
 	players[player->getID()] = player;
+	player->updateImbuementTicking();
+	ProtocolStatus::invalidateStatusString();
 }
 
 void Game::removePlayer(std::shared_ptr<Player> player) {
@@ -9251,22 +9177,50 @@ void Game::removePlayer(std::shared_ptr<Player> player) {
 	mappedPlayerNames.erase(lowercase_name);
 	wildcardTree.remove(lowercase_name);
 	players.erase(player->getID());
+	imbuementTickingPlayers.erase(player->getID());
+	ProtocolStatus::invalidateStatusString();
+}
+
+uint32_t Game::reserveNpcId(uint32_t currentId) {
+	if (npcs.contains(currentId)) {
+		return currentId;
+	}
+
+	const uint32_t id = npcs.reserve();
+	if (id == 0) {
+		g_logger().error("[{}] - No npc id left, {} npcs are on the map", __FUNCTION__, npcs.size());
+	}
+	return id;
+}
+
+uint32_t Game::reserveMonsterId(uint32_t currentId) {
+	if (monsters.contains(currentId)) {
+		return currentId;
+	}
+
+	const uint32_t id = monsters.reserve();
+	if (id == 0) {
+		g_logger().error("[{}] - No monster id left, {} monsters are on the map", __FUNCTION__, monsters.size());
+	}
+	return id;
 }
 
 void Game::addNpc(std::shared_ptr<Npc> npc) {
-	npcs[npc->getID()] = npc;
+	const uint32_t id = npc->getID();
+	npcs.add(id, std::move(npc));
 }
 
 void Game::removeNpc(std::shared_ptr<Npc> npc) {
-	npcs.erase(npc->getID());
+	npcs.release(npc->getID());
 }
 
 void Game::addMonster(std::shared_ptr<Monster> monster) {
-	monsters[monster->getID()] = monster;
+	const uint32_t id = monster->getID();
+	monsters.add(id, std::move(monster));
 }
 
 void Game::removeMonster(std::shared_ptr<Monster> monster) {
-	monsters.erase(monster->getID());
+	monsters.release(monster->getID());
 }
 
 std::shared_ptr<Guild> Game::getGuild(uint32_t id, bool allowOffline /* = flase */) const {
@@ -9479,7 +9433,7 @@ uint32_t Game::makeFiendishMonster(uint32_t forgeableMonsterId /* = 0*/, bool cr
 		forgeableMonsters.clear();
 		// If the forgeable monsters haven't been created
 		// Then we'll create them so they don't return in the next if (forgeableMonsters.empty())
-		for (auto [monsterId, monster] : monsters) {
+		for (const auto &monster : monsters.values()) {
 			auto monsterTile = monster->getTile();
 			if (!monster || !monsterTile) {
 				continue;
@@ -9644,7 +9598,7 @@ bool Game::removeFiendishMonster(uint32_t id, bool create /* = true*/) {
 
 void Game::updateForgeableMonsters() {
 	forgeableMonsters.clear();
-	for (auto [monsterId, monster] : monsters) {
+	for (const auto &monster : monsters.values()) {
 		auto monsterTile = monster->getTile();
 		if (!monsterTile) {
 			continue;
@@ -17,6 +17,7 @@
 #include "items/item.hpp"
 #include "map/map.hpp"
 #include "creatures/npcs/npc.hpp"
+#include "creatures/creature_id_slab.hpp"
 #include "movement/position.hpp"
 #include "creatures/players/player.hpp"
 #include "lua/creature/raids.hpp"
@@ -46,21 +47,6 @@ static constexpr int32_t EVENT_FORGEABLEMONSTERCHECKINTERVAL = 300000;
 static constexpr int32_t EVENT_LUA_GARBAGE_COLLECTION = 60000 * 10; // 10min
 
 static constexpr std::chrono::minutes CACHE_EXPIRATION_TIME { 10 }; // 10min
-static constexpr std::chrono::minutes HIGHSCORE_CACHE_EXPIRATION_TIME { 10 }; // 10min
-
-struct QueryHighscoreCacheEntry {
-	std::string query;
-	uint32_t page;
-	uint8_t entriesPerPage;
-	std::chrono::time_point<std::chrono::steady_clock> timestamp;
-};
-
-struct HighscoreCacheEntry {
-	std::vector<HighscoreCharacter> characters;
-	uint32_t page;
-	uint32_t entriesPerPage;
-	std::chrono::time_point<std::chrono::system_clock> timestamp;
-};
 
 class Game {
 public:
@@ -89,6 +75,12 @@ public:
 	 * \returns true if the custom map was loaded successfully
 	 */
 	void loadMainMap(const std::string &filename);
+	/**
+	 * The two halves of loadMainMap, the file parsing only needs the item types
+	 * while the map data needs the scripts, monsters and npcs loaded
+	 */
+	void loadMainMapFile(const std::string &filename);
+	void loadMainMapData();
 	/**
 	 * Load the custom map
 	 * \param filename Is the map custom name (Example: "map".otbm, not is necessary add extension .otbm)
@@ -511,11 +503,11 @@ public:
 	const phmap::parallel_flat_hash_map<uint32_t, std::shared_ptr<Player>> &getPlayers() const {
 		return players;
 	}
-	const std::map<uint32_t, std::shared_ptr<Monster>> &getMonsters() const {
-		return monsters;
+	const std::vector<std::shared_ptr<Monster>> &getMonsters() const {
+		return monsters.values();
 	}
-	const std::map<uint32_t, std::shared_ptr<Npc>> &getNpcs() const {
-		return npcs;
+	const std::vector<std::shared_ptr<Npc>> &getNpcs() const {
+		return npcs.values();
 	}
 
 	const std::vector<ItemClassification*> &getItemsClassifications() const {
@@ -525,6 +517,13 @@ public:
 	void addPlayer(std::shared_ptr<Player> player);
 	void removePlayer(std::shared_ptr<Player> player);
 
+	// Only players with an imbuement losing time are visited by checkImbuements
+	void setImbuementTicking(const std::shared_ptr<Player> &player, bool ticking);
+
+	// Id for the next placement of a creature, its current one if that is still reserved
+	uint32_t reserveNpcId(uint32_t currentId);
+	uint32_t reserveMonsterId(uint32_t currentId);
+
 	void addNpc(std::shared_ptr<Npc> npc);
 	void removeNpc(std::shared_ptr<Npc> npc);
 
@@ -595,6 +594,22 @@ public:
 		return std::find(registeredLookTypes.begin(), registeredLookTypes.end(), type) != registeredLookTypes.end();
 	}
 
+	const std::vector<uint16_t> &getRegisteredMagicEffects() const {
+		return registeredMagicEffects;
+	}
+	const std::vector<uint16_t> &getRegisteredDistanceEffects() const {
+		return registeredDistanceEffects;
+	}
+	const std::vector<uint16_t> &getRegisteredLookTypes() const {
+		return registeredLookTypes;
+	}
+	// Used by the items snapshot, which skips loadAppearanceProtobuf
+	void setRegisteredAppearances(std::vector<uint16_t> magicEffects, std::vector<uint16_t> distanceEffects, std::vector<uint16_t> lookTypes) {
+		registeredMagicEffects = std::move(magicEffects);
+		registeredDistanceEffects = std::move(distanceEffects);
+		registeredLookTypes = std::move(lookTypes);
+	}
+
 	void setCreateLuaItems(Position position, uint16_t itemId) {
 		mapLuaItemsStored[position] = itemId;
 	}
@@ -687,6 +702,7 @@ private:
 	std::set<uint32_t> fiendishMonsters;
 	std::set<uint32_t> influencedMonsters;
 	void checkImbuements();
+	void updateMetrics();
 	bool playerSaySpell(std::shared_ptr<Player> player, SpeakClasses type, const std::string &text);
 	void playerWhisper(std::shared_ptr<Player> player, const std::string &text);
 	bool playerYell(std::shared_ptr<Player> player, const std::string &text);
@@ -777,11 +793,9 @@ private:
 	 */
 	ReturnValue collectRewardChestItems(std::shared_ptr<Player> player, uint32_t maxMoveItems = 0);
 
-	phmap::flat_hash_map<std::string, QueryHighscoreCacheEntry> queryCache;
-	phmap::flat_hash_map<std::string, HighscoreCacheEntry> highscoreCache;
-
 	phmap::flat_hash_map<std::string, std::weak_ptr<Player>> m_uniqueLoginPlayerNames;
 	phmap::parallel_flat_hash_map<uint32_t, std::shared_ptr<Player>> players;
+	phmap::flat_hash_set<uint32_t> imbuementTickingPlayers;
 	phmap::flat_hash_map<std::string, std::weak_ptr<Player>> mappedPlayerNames;
 	phmap::parallel_flat_hash_map<uint32_t, std::shared_ptr<Guild>> guilds;
 	phmap::flat_hash_map<uint16_t, std::shared_ptr<Item>> uniqueItems;
@@ -809,8 +823,8 @@ private:
 
 	WildcardTreeNode wildcardTree { false };
 
-	std::map<uint32_t, std::shared_ptr<Npc>> npcs;
-	std::map<uint32_t, std::shared_ptr<Monster>> monsters;
+	CreatureIdSlab<Npc> npcs;
+	CreatureIdSlab<Monster> monsters;
 	std::vector<uint32_t> forgeableMonsters;
 
 	std::map<uint32_t, std::unique_ptr<TeamFinder>> teamFinderMap; // [leaderGUID] = TeamFinder*
@@ -903,15 +917,6 @@ private:
 
 	// Variable members (m_)
 	std::unique_ptr<IOWheel> m_IOWheel;
-
-	void cacheQueryHighscore(const std::string &key, const std::string &query, uint32_t page, uint8_t entriesPerPage);
-	void processHighscoreResults(DBResult_ptr result, uint32_t playerID, uint8_t category, uint32_t vocation, uint8_t entriesPerPage);
-
-	std::string generateVocationConditionHighscore(uint32_t vocation);
-	std::string generateHighscoreQueryForEntries(const std::string &categoryName, uint32_t page, uint8_t entriesPerPage, uint32_t vocation);
-	std::string generateHighscoreQueryForOurRank(const std::string &categoryName, uint8_t entriesPerPage, uint32_t playerGUID, uint32_t vocation);
-	std::string generateHighscoreOrGetCachedQueryForEntries(const std::string &categoryName, uint32_t page, uint8_t entriesPerPage, uint32_t vocation);
-	std::string generateHighscoreOrGetCachedQueryForOurRank(const std::string &categoryName, uint8_t entriesPerPage, uint32_t playerGUID, uint32_t vocation);
 };
 
 constexpr auto g_game = Game::getInstance;
@@ -0,0 +1,202 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2022 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include "game/highscores/highscore_index.hpp"
+#include "creatures/players/player.hpp"
+#include "creatures/players/vocations/vocation.hpp"
+#include "database/database.hpp"
+
+namespace {
+	uint32_t getBaseVocation(uint16_t vocationId) {
+		const auto vocation = g_vocations().getVocation(vocationId);
+		return vocation ? vocation->getFromVocation() : vocationId;
+	}
+}
+
+HighscoreIndex &HighscoreIndex::getInstance() {
+	return inject<HighscoreIndex>();
+}
+
+bool HighscoreIndex::load() {
+	std::ostringstream query;
+	query << "SELECT `id`, `name`, `level`, `vocation`, `experience`, `skill_fist`, `skill_club`, `skill_sword`, `skill_axe`, `skill_dist`, "
+		  << "`skill_shielding`, `skill_fishing`, `maglevel` FROM `players` WHERE `group_id` < " << static_cast<int>(account::GROUP_TYPE_GAMEMASTER);
+
+	std::scoped_lock lock(mutex);
+	characters.clear();
+	for (auto &category : categories) {
+		category = {};
+	}
+
+	DBResult_ptr result = Database::getInstance().storeQuery(query.str());
+	if (!result) {
+		g_logger().debug("[HighscoreIndex::load] - No characters to rank");
+		return true;
+	}
+
+	do {
+		Character character;
+		character.name = result->getString("name");
+		character.level = result->getNumber<uint16_t>("level");
+		character.vocation = result->getNumber<uint16_t>("vocation");
+		character.baseVocation = getBaseVocation(character.vocation);
+		character.points[HIGHSCORE_CATEGORY_EXPERIENCE] = result->getNumber<uint64_t>("experience");
+		character.points[HIGHSCORE_CATEGORY_FIST_FIGHTING] = result->getNumber<uint64_t>("skill_fist");
+		character.points[HIGHSCORE_CATEGORY_CLUB_FIGHTING] = result->getNumber<uint64_t>("skill_club");
+		character.points[HIGHSCORE_CATEGORY_SWORD_FIGHTING] = result->getNumber<uint64_t>("skill_sword");
+		character.points[HIGHSCORE_CATEGORY_AXE_FIGHTING] = result->getNumber<uint64_t>("skill_axe");
+		character.points[HIGHSCORE_CATEGORY_DISTANCE_FIGHTING] = result->getNumber<uint64_t>("skill_dist");
+		character.points[HIGHSCORE_CATEGORY_SHIELDING] = result->getNumber<uint64_t>("skill_shielding");
+		character.points[HIGHSCORE_CATEGORY_FISHING] = result->getNumber<uint64_t>("skill_fishing");
+		character.points[HIGHSCORE_CATEGORY_MAGIC_LEVEL] = result->getNumber<uint64_t>("maglevel");
+		insert(result->getNumber<uint32_t>("id"), std::move(character));
+	} while (result->next());
+
+	g_logger().debug("[HighscoreIndex::load] - Ranked {} characters", characters.size());
+	return true;
+}
+
+void HighscoreIndex::update(const std::shared_ptr<Player> &player) {
+	if (!player) {
+		return;
+	}
+
+	const uint32_t guid = player->getGUID();
+	if (player->getGroup()->id >= account::GROUP_TYPE_GAMEMASTER) {
+		remove(guid);
+		return;
+	}
+
+	Character character;
+	character.name = player->getName();
+	character.level = static_cast<uint16_t>(player->getLevel());
+	character.vocation = player->getVocationId();
+	character.baseVocation = getBaseVocation(character.vocation);
+	character.points[HIGHSCORE_CATEGORY_EXPERIENCE] = player->getExperience();
+	character.points[HIGHSCORE_CATEGORY_FIST_FIGHTING] = player->getBaseSkill(SKILL_FIST);
+	character.points[HIGHSCORE_CATEGORY_CLUB_FIGHTING] = player->getBaseSkill(SKILL_CLUB);
+	character.points[HIGHSCORE_CATEGORY_SWORD_FIGHTING] = player->getBaseSkill(SKILL_SWORD);
+	character.points[HIGHSCORE_CATEGORY_AXE_FIGHTING] = player->getBaseSkill(SKILL_AXE);
+	character.points[HIGHSCORE_CATEGORY_DISTANCE_FIGHTING] = player->getBaseSkill(SKILL_DISTANCE);
+	character.points[HIGHSCORE_CATEGORY_SHIELDING] = player->getBaseSkill(SKILL_SHIELD);
+	character.points[HIGHSCORE_CATEGORY_FISHING] = player->getBaseSkill(SKILL_FISHING);
+	character.points[HIGHSCORE_CATEGORY_MAGIC_LEVEL] = player->getBaseMagicLevel();
+
+	std::scoped_lock lock(mutex);
+	erase(guid);
+	insert(guid, std::move(character));
+}
+
+void HighscoreIndex::remove(uint32_t guid) {
+	std::scoped_lock lock(mutex);
+	erase(guid);
+}
+
+std::optional<HighscorePage> HighscoreIndex::getEntries(uint8_t category, uint32_t vocation, uint16_t page, uint8_t entriesPerPage) const {
+	std::scoped_lock lock(mutex);
+	const RankTree* tree = getTree(category, vocation);
+	if (!tree || page == 0 || entriesPerPage == 0) {
+		return std::nullopt;
+	}
+
+	const size_t first = static_cast<size_t>(page - 1) * entriesPerPage;
+	if (first >= tree->size()) {
+		return std::nullopt;
+	}
+
+	HighscorePage result = buildPage(categories[category], *tree, first, entriesPerPage);
+	result.page = page;
+	return result;
+}
+
+std::optional<HighscorePage> HighscoreIndex::getOurRank(uint8_t category, uint32_t vocation, uint32_t guid, uint8_t entriesPerPage) const {
+	std::scoped_lock lock(mutex);
+	const RankTree* tree = getTree(category, vocation);
+	if (!tree || tree->size() == 0 || entriesPerPage == 0) {
+		return std::nullopt;
+	}
+
+	size_t position = 0;
+	if (auto it = characters.find(guid); it != characters.end()) {
+		const Character &character = it->second;
+		if (vocation == HIGHSCORE_ALL_VOCATIONS || character.baseVocation == vocation) {
+			position = tree->rank({ character.points[category], guid });
+		}
+	}
+
+	const size_t first = position - (position % entriesPerPage);
+	HighscorePage result = buildPage(categories[category], *tree, first, entriesPerPage);
+	result.page = static_cast<uint16_t>(first / entriesPerPage + 1);
+	return result;
+}
+
+void HighscoreIndex::insert(uint32_t guid, Character &&character) {
+	for (uint8_t id = 0; id < HIGHSCORE_CATEGORY_COUNT; ++id) {
+		Category &category = categories[id];
+		const uint64_t points = character.points[id];
+		category.characters.insert({ points, guid });
+		category.byVocation[character.baseVocation].insert({ points, guid });
+		if (category.pointsCount[points]++ == 0) {
+			category.distinctPoints.insert(points);
+		}
+	}
+	characters.insert_or_assign(guid, std::move(character));
+}
+
+void HighscoreIndex::erase(uint32_t guid) {
+	auto it = characters.find(guid);
+	if (it == characters.end()) {
+		return;
+	}
+
+	const Character &character = it->second;
+	for (uint8_t id = 0; id < HIGHSCORE_CATEGORY_COUNT; ++id) {
+		Category &category = categories[id];
+		const uint64_t points = character.points[id];
+		category.characters.erase({ points, guid });
+		category.byVocation[character.baseVocation].erase({ points, guid });
+		if (auto countIt = category.pointsCount.find(points); countIt != category.pointsCount.end() && --countIt->second == 0) {
+			category.pointsCount.erase(countIt);
+			category.distinctPoints.erase(points);
+		}
+	}
+	characters.erase(it);
+}
+
+const HighscoreIndex::RankTree* HighscoreIndex::getTree(uint8_t category, uint32_t vocation) const {
+	if (category >= HIGHSCORE_CATEGORY_COUNT) {
+		return nullptr;
+	}
+
+	const Category &rankings = categories[category];
+	if (vocation == HIGHSCORE_ALL_VOCATIONS) {
+		return &rankings.characters;
+	}
+
+	auto it = rankings.byVocation.find(vocation);
+	return it != rankings.byVocation.end() ? &it->second : nullptr;
+}
+
+HighscorePage HighscoreIndex::buildPage(const Category &category, const RankTree &tree, size_t first, uint8_t entriesPerPage) const {
+	HighscorePage result;
+	result.pages = static_cast<uint16_t>((tree.size() + entriesPerPage - 1) / entriesPerPage);
+
+	const size_t last = std::min<size_t>(first + entriesPerPage, tree.size());
+	result.characters.reserve(last - first);
+	for (size_t position = first; position < last; ++position) {
+		const auto &[points, guid] = tree.at(position);
+		const Character &character = characters.at(guid);
+		const auto vocation = g_vocations().getVocation(character.vocation);
+		const uint32_t rank = static_cast<uint32_t>(category.distinctPoints.rank(points) + 1);
+		result.characters.emplace_back(character.name, points, guid, rank, character.level, vocation ? vocation->getClientId() : 0);
+	}
+	return result;
+}
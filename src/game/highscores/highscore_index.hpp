@@ -0,0 +1,243 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2022 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+#include "game/game_definitions.hpp"
+#include "server/server_definitions.hpp"
+
+class Player;
+
+/**
+ * Balanced search tree (treap) with subtree sizes, answering the position of a key
+ * and the key at a position in O(log n). Nodes live in a vector and link by index.
+ */
+template <typename Key, typename Compare>
+class OrderStatisticTree {
+public:
+	void insert(const Key &key) {
+		int32_t node = allocate(key);
+		int32_t left, right;
+		split(root, key, left, right);
+		root = merge(merge(left, node), right);
+	}
+
+	bool erase(const Key &key) {
+		return erase(root, key);
+	}
+
+	void clear() {
+		nodes.clear();
+		freeNodes.clear();
+		root = -1;
+	}
+
+	size_t size() const {
+		return sizeOf(root);
+	}
+
+	// Number of keys ordered before key
+	size_t rank(const Key &key) const {
+		size_t position = 0;
+		int32_t node = root;
+		while (node != -1) {
+			if (compare(nodes[node].key, key)) {
+				position += sizeOf(nodes[node].left) + 1;
+				node = nodes[node].right;
+			} else {
+				node = nodes[node].left;
+			}
+		}
+		return position;
+	}
+
+	// Key at the 0-based position, must be lower than size()
+	const Key &at(size_t position) const {
+		int32_t node = root;
+		while (true) {
+			const size_t leftSize = sizeOf(nodes[node].left);
+			if (position < leftSize) {
+				node = nodes[node].left;
+			} else if (position == leftSize) {
+				return nodes[node].key;
+			} else {
+				position -= leftSize + 1;
+				node = nodes[node].right;
+			}
+		}
+	}
+
+private:
+	struct Node {
+		Key key;
+		uint32_t priority;
+		uint32_t size;
+		int32_t left;
+		int32_t right;
+	};
+
+	uint32_t sizeOf(int32_t node) const {
+		return node == -1 ? 0 : nodes[node].size;
+	}
+
+	void update(int32_t node) {
+		nodes[node].size = sizeOf(nodes[node].left) + sizeOf(nodes[node].right) + 1;
+	}
+
+	int32_t allocate(const Key &key) {
+		// xorshift, the priorities only need to be well spread
+		seed ^= seed << 13;
+		seed ^= seed >> 17;
+		seed ^= seed << 5;
+		const Node node { key, seed, 1, -1, -1 };
+		if (!freeNodes.empty()) {
+			int32_t index = freeNodes.back();
+			freeNodes.pop_back();
+			nodes[index] = node;
+			return index;
+		}
+		nodes.push_back(node);
+		return static_cast<int32_t>(nodes.size() - 1);
+	}
+
+	// Left receives the keys ordered before key, right the remaining ones
+	void split(int32_t node, const Key &key, int32_t &left, int32_t &right) {
+		if (node == -1) {
+			left = right = -1;
+			return;
+		}
+
+		if (compare(nodes[node].key, key)) {
+			split(nodes[node].right, key, nodes[node].right, right);
+			left = node;
+		} else {
+			split(nodes[node].left, key, left, nodes[node].left);
+			right = node;
+		}
+		update(node);
+	}
+
+	int32_t merge(int32_t left, int32_t right) {
+		if (left == -1) {
+			return right;
+		}
+		if (right == -1) {
+			return left;
+		}
+
+		if (nodes[left].priority > nodes[right].priority) {
+			nodes[left].right = merge(nodes[left].right, right);
+			update(left);
+			return left;
+		}
+		nodes[right].left = merge(left, nodes[right].left);
+		update(right);
+		return right;
+	}
+
+	bool erase(int32_t &node, const Key &key) {
+		if (node == -1) {
+			return false;
+		}
+
+		if (compare(key, nodes[node].key)) {
+			if (!erase(nodes[node].left, key)) {
+				return false;
+			}
+		} else if (compare(nodes[node].key, key)) {
+			if (!erase(nodes[node].right, key)) {
+				return false;
+			}
+		} else {
+			freeNodes.push_back(node);
+			node = merge(nodes[node].left, nodes[node].right);
+			return true;
+		}
+		update(node);
+		return true;
+	}
+
+	std::vector<Node> nodes;
+	std::vector<int32_t> freeNodes;
+	int32_t root = -1;
+	uint32_t seed = 2463534242;
+	Compare compare;
+};
+
+static constexpr uint8_t HIGHSCORE_CATEGORY_COUNT = HIGHSCORE_CATEGORY_MAGIC_LEVEL + 1;
+static constexpr uint32_t HIGHSCORE_ALL_VOCATIONS = 0xFFFFFFFF;
+
+struct HighscorePage {
+	std::vector<HighscoreCharacter> characters;
+	uint16_t page = 0;
+	uint16_t pages = 0;
+};
+
+/**
+ * Rankings of every character (gamemasters excluded) for each highscore category.
+ * Loaded once from the database and kept current by player saves and skill advances,
+ * so highscore requests never hit the database.
+ */
+class HighscoreIndex {
+public:
+	HighscoreIndex() = default;
+
+	// Singleton - ensures we don't accidentally copy it.
+	HighscoreIndex(const HighscoreIndex &) = delete;
+	void operator=(const HighscoreIndex &) = delete;
+
+	static HighscoreIndex &getInstance();
+
+	bool load();
+
+	void update(const std::shared_ptr<Player> &player);
+	void remove(uint32_t guid);
+
+	// Returns std::nullopt when the page has no entries
+	std::optional<HighscorePage> getEntries(uint8_t category, uint32_t vocation, uint16_t page, uint8_t entriesPerPage) const;
+	// Page holding the character, or the first page when it isn't ranked
+	std::optional<HighscorePage> getOurRank(uint8_t category, uint32_t vocation, uint32_t guid, uint8_t entriesPerPage) const;
+
+private:
+	// Higher points first, ties ordered by character id
+	using RankKey = std::pair<uint64_t, uint32_t>;
+	struct RankOrder {
+		bool operator()(const RankKey &lhs, const RankKey &rhs) const {
+			return lhs.first != rhs.first ? lhs.first > rhs.first : lhs.second < rhs.second;
+		}
+	};
+	using RankTree = OrderStatisticTree<RankKey, RankOrder>;
+
+	struct Character {
+		std::string name;
+		uint16_t level;
+		uint16_t vocation;
+		uint32_t baseVocation;
+		std::array<uint64_t, HIGHSCORE_CATEGORY_COUNT> points;
+	};
+
+	struct Category {
+		RankTree characters;
+		phmap::flat_hash_map<uint32_t, RankTree> byVocation;
+		// Distinct point values, the rank shown to the client is dense like the old query
+		OrderStatisticTree<uint64_t, std::greater<>> distinctPoints;
+		phmap::flat_hash_map<uint64_t, uint32_t> pointsCount;
+	};
+
+	void insert(uint32_t guid, Character &&character);
+	void erase(uint32_t guid);
+	const RankTree* getTree(uint8_t category, uint32_t vocation) const;
+	HighscorePage buildPage(const Category &category, const RankTree &tree, size_t first, uint8_t entriesPerPage) const;
+
+	mutable std::mutex mutex;
+	phmap::flat_hash_map<uint32_t, Character> characters;
+	std::array<Category, HIGHSCORE_CATEGORY_COUNT> categories;
+};
+
+constexpr auto g_highscoreIndex = HighscoreIndex::getInstance;
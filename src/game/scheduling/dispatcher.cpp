@@ -12,6 +12,7 @@
 #include "game/scheduling/dispatcher.hpp"
 #include "lib/thread/thread_pool.hpp"
 #include "lib/di/container.hpp"
+#include "lib/metrics/metrics.hpp"
 #include "utils/tools.hpp"
 
 constexpr static auto ASYNC_TIME_OUT = std::chrono::seconds(15);
@@ -42,13 +43,22 @@ void Dispatcher::init() {
 }
 
 void Dispatcher::executeSerialEvents(std::vector<Task> &tasks) {
+	static auto &queueDepth = g_metrics().gauge("canary_dispatcher_queue_depth", "Serial tasks waiting at the start of the last dispatcher pass");
+	static auto &taskWait = g_metrics().histogram("canary_dispatcher_task_wait_seconds", "Time serial tasks waited in the dispatcher queue", Metrics::durationBuckets());
+	static auto &taskDuration = g_metrics().histogram("canary_dispatcher_task_duration_seconds", "Time spent running dispatcher tasks", Metrics::durationBuckets(), { { "type", "event" } });
+
 	dispacherContext.group = TaskGroup::Serial;
 	dispacherContext.type = DispatcherType::Event;
+	queueDepth.set(static_cast<int64_t>(tasks.size()));
 
 	for (const auto &task : tasks) {
 		dispacherContext.taskName = task.getContext();
+		taskWait.observe(std::max(0.0, std::chrono::duration<double>(Task::TIME_NOW - task.getTime()).count()));
+
+		const auto start = std::chrono::steady_clock::now();
 		if (task.execute()) {
 			++dispatcherCycle;
+			taskDuration.observeSince(start);
 		}
 	}
 	tasks.clear();
@@ -100,7 +110,11 @@ void Dispatcher::executeEvents(std::unique_lock<std::mutex> &asyncLock) {
 }
 
 void Dispatcher::executeScheduledEvents() {
+	static auto &scheduledCount = g_metrics().gauge("canary_dispatcher_scheduled_tasks", "Scheduled and cycle tasks waiting for their time");
+	static auto &taskDuration = g_metrics().histogram("canary_dispatcher_task_duration_seconds", "Time spent running dispatcher tasks", Metrics::durationBuckets(), { { "type", "scheduled" } });
+
 	auto &threadScheduledTasks = getThreadTask()->scheduledTasks;
+	scheduledCount.set(static_cast<int64_t>(scheduledTasks.size()));
 
 	auto it = scheduledTasks.begin();
 	while (it != scheduledTasks.end()) {
@@ -113,7 +127,13 @@ void Dispatcher::executeScheduledEvents() {
 		dispacherContext.group = TaskGroup::Serial;
 		dispacherContext.taskName = task->getContext();
 
-		if (task->execute() && task->isCycle()) {
+		const auto start = std::chrono::steady_clock::now();
+		const bool executed = task->execute();
+		if (executed) {
+			taskDuration.observeSince(start);
+		}
+
+		if (executed && task->isCycle()) {
 			task->updateTime();
 			threadScheduledTasks.emplace_back(task);
 		} else {
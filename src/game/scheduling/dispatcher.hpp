@@ -90,6 +90,9 @@ public:
 
 	static Dispatcher &getInstance();
 
+	// Starts the loop running the events on the thread pool, only once per process
+	void init();
+
 	void addEvent(std::function<void(void)> &&f, std::string_view context, uint32_t expiresAfterMs = 0);
 
 	uint64_t cycleEvent(uint32_t delay, std::function<void(void)> &&f, std::string_view context) {
@@ -141,7 +144,6 @@ private:
 		return scheduleEvent(std::make_shared<Task>(std::move(f), context, delay, cycle, log));
 	}
 
-	void init();
 	void shutdown() {
 		signalAsync.notify_all();
 	}
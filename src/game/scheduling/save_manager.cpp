@@ -2,7 +2,15 @@
 
 #include "game/game.hpp"
 #include "game/scheduling/save_manager.hpp"
+#include "game/highscores/highscore_index.hpp"
 #include "io/iologindata.hpp"
+#include "lib/metrics/metrics.hpp"
+
+namespace {
+	MetricHistogram &saveDuration(const std::string &kind) {
+		return g_metrics().histogram("canary_save_duration_seconds", "Time spent saving, by what was saved", Metrics::durationBuckets(), { { "kind", kind } });
+	}
+}
 
 SaveManager::SaveManager(ThreadPool &threadPool, KVStore &kvStore, Logger &logger, Game &game) :
 	threadPool(threadPool), kv(kvStore), logger(logger), game(game) { }
@@ -12,6 +20,7 @@ SaveManager &SaveManager::getInstance() {
 }
 
 void SaveManager::saveAll() {
+	static auto &metric = saveDuration("server");
 	Benchmark bm_saveAll;
 	logger.info("Saving server...");
 	const auto players = game.getPlayers();
@@ -28,7 +37,9 @@ void SaveManager::saveAll() {
 
 	saveMap();
 	saveKV();
-	logger.info("Server saved in {} milliseconds.", bm_saveAll.duration());
+	const auto duration = bm_saveAll.duration();
+	metric.observe(duration / 1000);
+	logger.info("Server saved in {} milliseconds.", duration);
 }
 
 void SaveManager::scheduleAll() {
@@ -72,15 +83,19 @@ bool SaveManager::doSavePlayer(std::shared_ptr<Player> player) {
 		logger.debug("Failed to save player because player is null.");
 		return false;
 	}
+	static auto &metric = saveDuration("player");
 	Benchmark bm_savePlayer;
 	Player::PlayerLock lock(player);
 	m_playerMap.erase(player->getGUID());
 	logger.debug("Saving player {}...", player->getName());
 	bool saveSuccess = IOLoginData::savePlayer(player);
-	if (!saveSuccess) {
+	if (saveSuccess) {
+		g_highscoreIndex().update(player);
+	} else {
 		logger.error("Failed to save player {}.", player->getName());
 	}
 	auto duration = bm_savePlayer.duration();
+	metric.observe(duration / 1000);
 	if (duration > 100) {
 		logger.warn("Saving player {} took {} milliseconds.", player->getName(), duration);
 	} else {
@@ -102,10 +117,12 @@ void SaveManager::saveGuild(std::shared_ptr<Guild> guild) {
 		logger.debug("Failed to save guild because guild is null.");
 		return;
 	}
+	static auto &metric = saveDuration("guild");
 	Benchmark bm_saveGuild;
 	logger.debug("Saving guild {}...", guild->getName());
 	IOGuild::saveGuild(guild);
 	auto duration = bm_saveGuild.duration();
+	metric.observe(duration / 1000);
 	if (duration > 100) {
 		logger.warn("Saving guild {} took {} milliseconds.", guild->getName(), duration);
 	} else {
@@ -114,6 +131,7 @@ void SaveManager::saveGuild(std::shared_ptr<Guild> guild) {
 }
 
 void SaveManager::saveMap() {
+	static auto &metric = saveDuration("map");
 	Benchmark bm_saveMap;
 	logger.debug("Saving map...");
 	bool saveSuccess = Map::save();
@@ -121,6 +139,7 @@ void SaveManager::saveMap() {
 		logger.error("Failed to save map.");
 	}
 	auto duration = bm_saveMap.duration();
+	metric.observe(duration / 1000);
 	if (duration > 100) {
 		logger.warn("Map saved in {} milliseconds.", bm_saveMap.duration());
 	} else {
@@ -129,6 +148,7 @@ void SaveManager::saveMap() {
 }
 
 void SaveManager::saveKV() {
+	static auto &metric = saveDuration("kv");
 	Benchmark bm_saveKV;
 	logger.debug("Saving key-value store...");
 	bool saveSuccess = kv.saveAll();
@@ -136,6 +156,7 @@ void SaveManager::saveKV() {
 		logger.error("Failed to save key-value store.");
 	}
 	auto duration = bm_saveKV.duration();
+	metric.observe(duration / 1000);
 	if (duration > 100) {
 		logger.warn("Key-value store saved in {} milliseconds.", bm_saveKV.duration());
 	} else {
@@ -92,14 +92,14 @@ private:
 			"Game::updateCreatureWalk",
 			"Game::updateForgeableMonsters",
 			"GlobalEvents::think",
-			"LuaEnvironment::executeTimerEvent",
+			"LuaEnvironment::executeTimerEvents",
 			"Modules::executeOnRecvbyte",
 			"OutputMessagePool::sendAll",
 			"ProtocolGame::addGameTask",
 			"ProtocolGame::parsePacketFromDispatcher",
 			"Raids::checkRaids",
-			"SpawnMonster::checkSpawnMonster",
 			"SpawnMonster::scheduleSpawn",
+			"SpawnScheduler::checkDueSpawns",
 			"SpawnNpc::checkSpawnNpc",
 			"Webhook::run",
 			"Protocol::sendRecvMessageCallback",
@@ -658,7 +658,10 @@ void IOLoginDataLoad::loadPlayerStorageMap(std::shared_ptr<Player> player, DBRes
 	query << "SELECT `key`, `value` FROM `player_storage` WHERE `player_id` = " << player->getGUID();
 	if ((result = db.storeQuery(query.str()))) {
 		do {
-			player->addStorageValue(result->getNumber<uint32_t>("key"), result->getNumber<int32_t>("value"), true);
+			const auto key = result->getNumber<uint32_t>("key");
+			const auto value = result->getNumber<int32_t>("value");
+			player->addStorageValue(key, value, true);
+			player->storage.load(key, value);
 		} while (result->next());
 	}
 }
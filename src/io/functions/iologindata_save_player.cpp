@@ -766,19 +766,30 @@ bool IOLoginDataSave::savePlayerStorage(std::shared_ptr<Player> player) {
 		return false;
 	}
 
+	// Only the keys changed since the last save are written
+	player->genReservedStorageRange();
+	const auto changes = player->storage.beginSave();
+
 	Database &db = Database::getInstance();
 	std::ostringstream query;
-	query << "DELETE FROM `player_storage` WHERE `player_id` = " << player->getGUID();
-	if (!db.executeQuery(query.str())) {
-		return false;
+	if (!changes.removed.empty()) {
+		query << "DELETE FROM `player_storage` WHERE `player_id` = " << player->getGUID() << " AND `key` IN (";
+		for (size_t i = 0; i < changes.removed.size(); ++i) {
+			if (i != 0) {
+				query << ',';
+			}
+			query << changes.removed[i];
+		}
+		query << ')';
+		if (!db.executeQuery(query.str())) {
+			return false;
+		}
+		query.str("");
 	}
 
-	query.str("");
-
 	DBInsert storageQuery("INSERT INTO `player_storage` (`player_id`, `key`, `value`) VALUES ");
-	player->genReservedStorageRange();
-
-	for (const auto &[key, value] : player->storageMap) {
+	storageQuery.upsert({ "value" });
+	for (const auto &[key, value] : changes.updated) {
 		query << player->getGUID() << ',' << key << ',' << value;
 		if (!storageQuery.addRow(query)) {
 			return false;
@@ -189,6 +189,10 @@ bool IOLoginData::savePlayer(std::shared_ptr<Player> player) {
 	bool success = DBTransaction::executeWithinTransaction([player]() {
 		return savePlayerGuard(player);
 	});
+	// Storage changes of a rolled back save go out with the next one
+	if (player) {
+		player->storage.endSave(success);
+	}
 
 	if (!success) {
 		g_logger().error("[{}] Error occurred saving player", __FUNCTION__);
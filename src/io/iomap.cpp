@@ -225,8 +225,7 @@ void IOMap::parseTileArea(FileStream &stream, Map &map, const Position &pos) {
 							if (!zoneId) {
 								throw IOMapException(fmt::format("[x:{}, y:{}, z:{}] Invalid zone id.", x, y, z));
 							}
-							auto zone = Zone::getZone(zoneId);
-							zone->addPosition(Position(x, y, z));
+							map.zonePositions.emplace_back(zoneId, Position(x, y, z));
 						}
 					} break;
 					default:
@@ -16,6 +16,11 @@
 #include "game/scheduling/dispatcher.hpp"
 #include "game/scheduling/save_manager.hpp"
 
+IOMarket::IOMarket(ThreadPool &threadPool, Database &db) :
+	threadPool(threadPool),
+	db(db) {
+}
+
 uint8_t IOMarket::getTierFromDatabaseTable(const std::string &string) {
 	auto tier = static_cast<uint8_t>(std::atoi(string.c_str()));
 	if (tier > g_configManager().getNumber(FORGE_MAX_ITEM_TIER)) {
@@ -26,59 +31,86 @@ uint8_t IOMarket::getTierFromDatabaseTable(const std::string &string) {
 	return tier;
 }
 
-MarketOfferList IOMarket::getActiveOffers(MarketAction_t action, uint16_t itemId, uint8_t tier) {
-	MarketOfferList offerList;
+void IOMarket::loadOffers() {
+	offers.clear();
+	books.clear();
+	playerOffers.clear();
+	counterOffers.clear();
+	expirations = {};
+
+	DBResult_ptr result = db.storeQuery("SELECT `o`.`id`, `o`.`player_id`, `o`.`sale`, `o`.`itemtype`, `o`.`amount`, `o`.`created`, `o`.`anonymous`, `o`.`price`, `o`.`tier`, `p`.`name` AS `player_name` FROM `market_offers` AS `o` INNER JOIN `players` AS `p` ON `p`.`id` = `o`.`player_id` ORDER BY `o`.`id`");
+	if (result) {
+		do {
+			Offer offer;
+			offer.id = result->getNumber<uint32_t>("id");
+			offer.playerId = result->getNumber<uint32_t>("player_id");
+			offer.created = result->getNumber<uint32_t>("created");
+			offer.price = result->getNumber<uint64_t>("price");
+			offer.itemId = result->getNumber<uint16_t>("itemtype");
+			offer.amount = result->getNumber<uint16_t>("amount");
+			offer.tier = getTierFromDatabaseTable(result->getString("tier"));
+			offer.type = static_cast<MarketAction_t>(result->getNumber<uint16_t>("sale"));
+			offer.anonymous = result->getNumber<uint16_t>("anonymous") != 0;
+			offer.playerName = result->getString("player_name");
 
-	std::ostringstream query;
-	query << "SELECT `id`, `amount`, `price`, `tier`, `created`, `anonymous`, (SELECT `name` FROM `players` WHERE `id` = `player_id`) AS `player_name` FROM `market_offers` WHERE `sale` = " << action << " AND `itemtype` = " << itemId << " AND `tier` = " << std::to_string(tier);
+			nextOfferId = std::max(nextOfferId, offer.id + 1);
+			addOffer(std::move(offer));
+		} while (result->next());
+	}
 
-	DBResult_ptr result = Database::getInstance().storeQuery(query.str());
-	if (!result) {
+	g_logger().info("Loaded {} market offers", offers.size());
+}
+
+MarketOfferList IOMarket::getActiveOffers(MarketAction_t action, uint16_t itemId, uint8_t tier) const {
+	MarketOfferList offerList;
+
+	const auto it = books.find(getBookKey(action, itemId, tier));
+	if (it == books.end()) {
 		return offerList;
 	}
 
 	const int32_t marketOfferDuration = g_configManager().getNumber(MARKET_OFFER_DURATION);
 
-	do {
-		MarketOffer offer;
-		offer.amount = result->getNumber<uint16_t>("amount");
-		offer.price = result->getNumber<uint64_t>("price");
-		offer.timestamp = result->getNumber<uint32_t>("created") + marketOfferDuration;
-		offer.counter = result->getNumber<uint32_t>("id") & 0xFFFF;
-		if (result->getNumber<uint16_t>("anonymous") == 0) {
-			offer.playerName = result->getString("player_name");
-		} else {
-			offer.playerName = "Anonymous";
-		}
-		offer.tier = getTierFromDatabaseTable(result->getString("tier"));
-		offerList.push_back(offer);
-	} while (result->next());
+	for (uint32_t offerId : it->second) {
+		const Offer &offer = offers.at(offerId);
+		MarketOffer marketOffer;
+		marketOffer.amount = offer.amount;
+		marketOffer.price = offer.price;
+		marketOffer.timestamp = offer.created + marketOfferDuration;
+		marketOffer.counter = offerId & 0xFFFF;
+		marketOffer.itemId = offer.itemId;
+		marketOffer.playerName = offer.anonymous ? "Anonymous" : offer.playerName;
+		marketOffer.tier = offer.tier;
+		offerList.push_back(std::move(marketOffer));
+	}
 	return offerList;
 }
 
-MarketOfferList IOMarket::getOwnOffers(MarketAction_t action, uint32_t playerId) {
+MarketOfferList IOMarket::getOwnOffers(MarketAction_t action, uint32_t playerId) const {
 	MarketOfferList offerList;
 
+	const auto it = playerOffers.find(playerId);
+	if (it == playerOffers.end()) {
+		return offerList;
+	}
+
 	const int32_t marketOfferDuration = g_configManager().getNumber(MARKET_OFFER_DURATION);
 
-	std::ostringstream query;
-	query << "SELECT `id`, `amount`, `price`, `created`, `itemtype`, `tier` FROM `market_offers` WHERE `player_id` = " << playerId << " AND `sale` = " << action;
+	for (uint32_t offerId : it->second) {
+		const Offer &offer = offers.at(offerId);
+		if (offer.type != action) {
+			continue;
+		}
 
-	DBResult_ptr result = Database::getInstance().storeQuery(query.str());
-	if (!result) {
-		return offerList;
+		MarketOffer marketOffer;
+		marketOffer.amount = offer.amount;
+		marketOffer.price = offer.price;
+		marketOffer.timestamp = offer.created + marketOfferDuration;
+		marketOffer.counter = offerId & 0xFFFF;
+		marketOffer.itemId = offer.itemId;
+		marketOffer.tier = offer.tier;
+		offerList.push_back(std::move(marketOffer));
 	}
-
-	do {
-		MarketOffer offer;
-		offer.amount = result->getNumber<uint16_t>("amount");
-		offer.price = result->getNumber<uint64_t>("price");
-		offer.timestamp = result->getNumber<uint32_t>("created") + marketOfferDuration;
-		offer.counter = result->getNumber<uint32_t>("id") & 0xFFFF;
-		offer.itemId = result->getNumber<uint16_t>("itemtype");
-		offer.tier = getTierFromDatabaseTable(result->getString("tier"));
-		offerList.push_back(offer);
-	} while (result->next());
 	return offerList;
 }
 
@@ -113,202 +145,144 @@ HistoryMarketOfferList IOMarket::getOwnHistory(MarketAction_t action, uint32_t p
 	return offerList;
 }
 
-void IOMarket::processExpiredOffers(DBResult_ptr result, bool) {
-	if (!result) {
-		return;
-	}
+void IOMarket::checkExpiredOffers() {
+	const time_t lastExpireDate = getTimeNow() - g_configManager().getNumber(MARKET_OFFER_DURATION);
 
-	do {
-		if (!IOMarket::moveOfferToHistory(result->getNumber<uint32_t>("id"), OFFERSTATE_EXPIRED)) {
+	while (!expirations.empty() && expirations.top().first <= lastExpireDate) {
+		const uint32_t offerId = expirations.top().second;
+		expirations.pop();
+
+		const auto it = offers.find(offerId);
+		if (it == offers.end()) {
 			continue;
 		}
 
-		const uint32_t playerId = result->getNumber<uint32_t>("player_id");
-		const uint16_t amount = result->getNumber<uint16_t>("amount");
-		auto tier = getTierFromDatabaseTable(result->getString("tier"));
-		if (result->getNumber<uint16_t>("sale") == 1) {
-			const ItemType &itemType = Item::items[result->getNumber<uint16_t>("itemtype")];
-			if (itemType.id == 0) {
-				continue;
-			}
-
-			std::shared_ptr<Player> player = g_game().getPlayerByGUID(playerId);
-			if (!player) {
-				player = std::make_shared<Player>(nullptr);
-				if (!IOLoginData::loadPlayerById(player, playerId)) {
-					continue;
-				}
-			}
-
-			if (itemType.stackable) {
-				uint16_t tmpAmount = amount;
-				while (tmpAmount > 0) {
-					uint16_t stackCount = std::min<uint16_t>(100, tmpAmount);
-					std::shared_ptr<Item> item = Item::CreateItem(itemType.id, stackCount);
-					if (g_game().internalAddItem(player->getInbox(), item, INDEX_WHEREEVER, FLAG_NOLIMIT) != RETURNVALUE_NOERROR) {
-						g_logger().error("[{}] Ocurred an error to add item with id {} to player {}", __FUNCTION__, itemType.id, player->getName());
-
-						break;
-					}
-
-					if (tier != 0) {
-						item->setAttribute(ItemAttribute_t::TIER, tier);
-					}
-
-					tmpAmount -= stackCount;
-				}
-			} else {
-				int32_t subType;
-				if (itemType.charges != 0) {
-					subType = itemType.charges;
-				} else {
-					subType = -1;
-				}
-
-				for (uint16_t i = 0; i < amount; ++i) {
-					std::shared_ptr<Item> item = Item::CreateItem(itemType.id, subType);
-					if (g_game().internalAddItem(player->getInbox(), item, INDEX_WHEREEVER, FLAG_NOLIMIT) != RETURNVALUE_NOERROR) {
-						break;
-					}
-
-					if (tier != 0) {
-						item->setAttribute(ItemAttribute_t::TIER, tier);
-					}
-				}
-			}
-
-			if (player->isOffline()) {
-				g_saveManager().savePlayer(player);
-			}
-		} else {
-			uint64_t totalPrice = result->getNumber<uint64_t>("price") * amount;
-
-			std::shared_ptr<Player> player = g_game().getPlayerByGUID(playerId);
-			if (player) {
-				player->setBankBalance(player->getBankBalance() + totalPrice);
-			} else {
-				IOLoginData::increaseBankBalance(playerId, totalPrice);
-			}
+		const Offer offer = it->second;
+		if (moveOfferToHistory(offerId, OFFERSTATE_EXPIRED)) {
+			expireOffer(offer);
 		}
-	} while (result->next());
-}
-
-void IOMarket::checkExpiredOffers() {
-	const time_t lastExpireDate = getTimeNow() - g_configManager().getNumber(MARKET_OFFER_DURATION);
-
-	std::ostringstream query;
-	query << "SELECT `id`, `amount`, `price`, `itemtype`, `player_id`, `sale`, `tier` FROM `market_offers` WHERE `created` <= " << lastExpireDate;
-	g_databaseTasks().store(query.str(), IOMarket::processExpiredOffers);
+	}
 
 	int32_t checkExpiredMarketOffersEachMinutes = g_configManager().getNumber(CHECK_EXPIRED_MARKET_OFFERS_EACH_MINUTES);
 	if (checkExpiredMarketOffersEachMinutes <= 0) {
 		return;
 	}
 
-	g_dispatcher().scheduleEvent(checkExpiredMarketOffersEachMinutes * 60 * 1000, IOMarket::checkExpiredOffers, __FUNCTION__);
+	g_dispatcher().scheduleEvent(
+		checkExpiredMarketOffersEachMinutes * 60 * 1000, [] { g_ioMarket().checkExpiredOffers(); }, __FUNCTION__
+	);
 }
 
-uint32_t IOMarket::getPlayerOfferCount(uint32_t playerId) {
-	std::ostringstream query;
-	query << "SELECT COUNT(*) AS `count` FROM `market_offers` WHERE `player_id` = " << playerId;
-
-	DBResult_ptr result = Database::getInstance().storeQuery(query.str());
-	if (!result) {
-		return 0;
-	}
-	return result->getNumber<int32_t>("count");
+uint32_t IOMarket::getPlayerOfferCount(uint32_t playerId) const {
+	const auto it = playerOffers.find(playerId);
+	return it != playerOffers.end() ? static_cast<uint32_t>(it->second.size()) : 0;
 }
 
-MarketOfferEx IOMarket::getOfferByCounter(uint32_t timestamp, uint16_t counter) {
-	MarketOfferEx offer;
-
-	const int32_t created = timestamp - g_configManager().getNumber(MARKET_OFFER_DURATION);
+MarketOfferEx IOMarket::getOfferByCounter(uint32_t timestamp, uint16_t counter) const {
+	MarketOfferEx marketOffer;
 
-	std::ostringstream query;
-	query << "SELECT `id`, `sale`, `itemtype`, `amount`, `created`, `price`, `player_id`, `anonymous`, `tier`, (SELECT `name` FROM `players` WHERE `id` = `player_id`) AS `player_name` FROM `market_offers` WHERE `created` = " << created << " AND (`id` & 65535) = " << counter << " LIMIT 1";
+	const uint32_t created = timestamp - g_configManager().getNumber(MARKET_OFFER_DURATION);
 
-	DBResult_ptr result = Database::getInstance().storeQuery(query.str());
-	if (!result) {
-		offer.id = 0;
-		return offer;
+	const auto it = counterOffers.find(getCounterKey(created, counter));
+	if (it == counterOffers.end()) {
+		marketOffer.id = 0;
+		return marketOffer;
 	}
 
-	offer.id = result->getNumber<uint32_t>("id");
-	offer.type = static_cast<MarketAction_t>(result->getNumber<uint16_t>("sale"));
-	offer.amount = result->getNumber<uint16_t>("amount");
-	offer.counter = result->getNumber<uint32_t>("id") & 0xFFFF;
-	offer.timestamp = result->getNumber<uint32_t>("created");
-	offer.price = result->getNumber<uint64_t>("price");
-	offer.itemId = result->getNumber<uint16_t>("itemtype");
-	offer.playerId = result->getNumber<uint32_t>("player_id");
-	offer.tier = getTierFromDatabaseTable(result->getString("tier"));
-	if (result->getNumber<uint16_t>("anonymous") == 0) {
-		offer.playerName = result->getString("player_name");
-	} else {
-		offer.playerName = "Anonymous";
-	}
-	return offer;
+	const Offer &offer = offers.at(it->second);
+	marketOffer.id = offer.id;
+	marketOffer.type = offer.type;
+	marketOffer.amount = offer.amount;
+	marketOffer.counter = offer.id & 0xFFFF;
+	marketOffer.timestamp = offer.created;
+	marketOffer.price = offer.price;
+	marketOffer.itemId = offer.itemId;
+	marketOffer.playerId = offer.playerId;
+	marketOffer.tier = offer.tier;
+	marketOffer.playerName = offer.anonymous ? "Anonymous" : offer.playerName;
+	return marketOffer;
 }
 
-void IOMarket::createOffer(uint32_t playerId, MarketAction_t action, uint32_t itemId, uint16_t amount, uint64_t price, uint8_t tier, bool anonymous) {
+void IOMarket::createOffer(uint32_t playerId, const std::string &playerName, MarketAction_t action, uint32_t itemId, uint16_t amount, uint64_t price, uint8_t tier, bool anonymous) {
+	Offer offer;
+	offer.id = nextOfferId++;
+	offer.playerId = playerId;
+	offer.created = static_cast<uint32_t>(getTimeNow());
+	offer.price = price;
+	offer.itemId = static_cast<uint16_t>(itemId);
+	offer.amount = amount;
+	offer.tier = tier;
+	offer.type = action;
+	offer.anonymous = anonymous;
+	offer.playerName = playerName;
+
 	std::ostringstream query;
-	query << "INSERT INTO `market_offers` (`player_id`, `sale`, `itemtype`, `amount`, `created`, `anonymous`, `price`, `tier`) VALUES (" << playerId << ',' << action << ',' << itemId << ',' << amount << ',' << getTimeNow() << ',' << anonymous << ',' << price << ',' << std::to_string(tier) << ')';
-	Database::getInstance().executeQuery(query.str());
+	query << "INSERT INTO `market_offers` (`id`, `player_id`, `sale`, `itemtype`, `amount`, `created`, `anonymous`, `price`, `tier`) VALUES (" << offer.id << ',' << playerId << ',' << action << ',' << itemId << ',' << amount << ',' << offer.created << ',' << anonymous << ',' << price << ',' << std::to_string(tier) << ')';
+	persist(query.str());
+
+	addOffer(std::move(offer));
 }
 
 void IOMarket::acceptOffer(uint32_t offerId, uint16_t amount) {
+	const auto it = offers.find(offerId);
+	if (it == offers.end()) {
+		return;
+	}
+
+	Offer &offer = it->second;
+	offer.amount -= std::min(amount, offer.amount);
+
 	std::ostringstream query;
-	query << "UPDATE `market_offers` SET `amount` = `amount` - " << amount << " WHERE `id` = " << offerId;
-	Database::getInstance().executeQuery(query.str());
+	query << "UPDATE `market_offers` SET `amount` = " << offer.amount << " WHERE `id` = " << offerId;
+	persist(query.str());
 }
 
 void IOMarket::deleteOffer(uint32_t offerId) {
+	removeOffer(offerId);
+
 	std::ostringstream query;
 	query << "DELETE FROM `market_offers` WHERE `id` = " << offerId;
-	Database::getInstance().executeQuery(query.str());
+	persist(query.str());
 }
 
 void IOMarket::appendHistory(uint32_t playerId, MarketAction_t type, uint16_t itemId, uint16_t amount, uint64_t price, time_t timestamp, uint8_t tier, MarketOfferState_t state) {
+	if (state == OFFERSTATE_ACCEPTED) {
+		auto &statistics = type == MARKETACTION_BUY ? purchaseStatistics : saleStatistics;
+		MarketStatistics &itemStatistics = statistics[getStatisticsKey(itemId, tier)];
+		if (itemStatistics.numTransactions == 0 || price < itemStatistics.lowestPrice) {
+			itemStatistics.lowestPrice = price;
+		}
+		itemStatistics.highestPrice = std::max(itemStatistics.highestPrice, price);
+		itemStatistics.totalPrice += price;
+		++itemStatistics.numTransactions;
+	}
+
 	std::ostringstream query;
 	query << "INSERT INTO `market_history` (`player_id`, `sale`, `itemtype`, `amount`, `price`, `expires_at`, `inserted`, `state`, `tier`) VALUES ("
 		  << playerId << ',' << type << ',' << itemId << ',' << amount << ',' << price << ','
 		  << timestamp << ',' << getTimeNow() << ',' << state << ',' << std::to_string(tier) << ')';
-	g_databaseTasks().execute(query.str());
+	persist(query.str());
 }
 
 bool IOMarket::moveOfferToHistory(uint32_t offerId, MarketOfferState_t state) {
-	Database &db = Database::getInstance();
-
-	std::ostringstream query;
-	query << "SELECT `player_id`, `sale`, `itemtype`, `amount`, `price`, `created`, `tier` FROM `market_offers` WHERE `id` = " << offerId;
-
-	DBResult_ptr result = db.storeQuery(query.str());
-	if (!result) {
+	const auto it = offers.find(offerId);
+	if (it == offers.end()) {
 		return false;
 	}
 
-	query.str(std::string());
-	query << "DELETE FROM `market_offers` WHERE `id` = " << offerId;
-	if (!db.executeQuery(query.str())) {
-		return false;
-	}
-
-	appendHistory(
-		result->getNumber<uint32_t>("player_id"),
-		static_cast<MarketAction_t>(result->getNumber<uint16_t>("sale")),
-		result->getNumber<uint16_t>("itemtype"),
-		result->getNumber<uint16_t>("amount"),
-		result->getNumber<uint64_t>("price"),
-		getTimeNow(),
-		getTierFromDatabaseTable(result->getString("tier")), state
-	);
+	const Offer offer = it->second;
+	deleteOffer(offerId);
+	appendHistory(offer.playerId, offer.type, offer.itemId, offer.amount, offer.price, getTimeNow(), offer.tier, state);
 	return true;
 }
 
 void IOMarket::updateStatistics() {
+	purchaseStatistics.clear();
+	saleStatistics.clear();
+
 	std::ostringstream query;
 	query << "SELECT `sale` AS `sale`, `itemtype` AS `itemtype`, COUNT(`price`) AS `num`, MIN(`price`) AS `min`, MAX(`price`) AS `max`, SUM(`price`) AS `sum`, `tier` AS `tier` FROM `market_history` WHERE `state` = " << OFFERSTATE_ACCEPTED << " GROUP BY `itemtype`, `sale`, `tier`";
-	DBResult_ptr result = Database::getInstance().storeQuery(query.str());
+	DBResult_ptr result = db.storeQuery(query.str());
 	if (!result) {
 		return;
 	}
@@ -318,9 +292,9 @@ void IOMarket::updateStatistics() {
 		const auto tier = getTierFromDatabaseTable(result->getString("tier"));
 		auto itemId = result->getNumber<uint16_t>("itemtype");
 		if (result->getNumber<uint16_t>("sale") == MARKETACTION_BUY) {
-			statistics = &purchaseStatistics[itemId][tier];
+			statistics = &purchaseStatistics[getStatisticsKey(itemId, tier)];
 		} else {
-			statistics = &saleStatistics[itemId][tier];
+			statistics = &saleStatistics[getStatisticsKey(itemId, tier)];
 		}
 
 		statistics->numTransactions = result->getNumber<uint32_t>("num");
@@ -329,3 +303,164 @@ void IOMarket::updateStatistics() {
 		statistics->highestPrice = result->getNumber<uint64_t>("max");
 	} while (result->next());
 }
+
+MarketStatistics IOMarket::getPurchaseStatistics(uint16_t itemId, uint8_t tier) const {
+	const auto it = purchaseStatistics.find(getStatisticsKey(itemId, tier));
+	return it != purchaseStatistics.end() ? it->second : MarketStatistics();
+}
+
+MarketStatistics IOMarket::getSaleStatistics(uint16_t itemId, uint8_t tier) const {
+	const auto it = saleStatistics.find(getStatisticsKey(itemId, tier));
+	return it != saleStatistics.end() ? it->second : MarketStatistics();
+}
+
+void IOMarket::flushWrites() {
+	std::scoped_lock orderLock(writeOrderMutex);
+	while (true) {
+		std::string query;
+		{
+			std::scoped_lock lock(writeMutex);
+			if (pendingWrites.empty()) {
+				writing = false;
+				return;
+			}
+			query = std::move(pendingWrites.front());
+			pendingWrites.pop_front();
+		}
+
+		if (!db.executeQuery(query)) {
+			g_logger().error("[IOMarket::flushWrites] - Failed to write market change: {}", query);
+		}
+	}
+}
+
+void IOMarket::persist(std::string query) {
+	std::scoped_lock lock(writeMutex);
+	pendingWrites.emplace_back(std::move(query));
+	if (writing) {
+		return;
+	}
+
+	writing = true;
+	threadPool.addLoad([this] { flushWrites(); });
+}
+
+void IOMarket::addOffer(Offer &&offer) {
+	const uint32_t offerId = offer.id;
+	// Ids only grow, so appending keeps the indexes ordered
+	books[getBookKey(offer.type, offer.itemId, offer.tier)].emplace_back(offerId);
+	playerOffers[offer.playerId].emplace_back(offerId);
+	counterOffers.try_emplace(getCounterKey(offer.created, offerId & 0xFFFF), offerId);
+	expirations.emplace(offer.created, offerId);
+	offers.try_emplace(offerId, std::move(offer));
+}
+
+void IOMarket::removeOffer(uint32_t offerId) {
+	const auto it = offers.find(offerId);
+	if (it == offers.end()) {
+		return;
+	}
+
+	const auto eraseId = [offerId](phmap::flat_hash_map<uint32_t, std::vector<uint32_t>> &index, uint32_t key) {
+		const auto indexIt = index.find(key);
+		if (indexIt == index.end()) {
+			return;
+		}
+
+		auto &offerIds = indexIt->second;
+		if (const auto idIt = std::ranges::lower_bound(offerIds, offerId); idIt != offerIds.end() && *idIt == offerId) {
+			offerIds.erase(idIt);
+		}
+		if (offerIds.empty()) {
+			index.erase(indexIt);
+		}
+	};
+
+	const Offer &offer = it->second;
+	eraseId(books, getBookKey(offer.type, offer.itemId, offer.tier));
+	eraseId(playerOffers, offer.playerId);
+	if (const auto counterIt = counterOffers.find(getCounterKey(offer.created, offerId & 0xFFFF)); counterIt != counterOffers.end() && counterIt->second == offerId) {
+		counterOffers.erase(counterIt);
+	}
+	offers.erase(it);
+
+	// Cancelled and accepted offers leave their entry in the heap until it expires
+	if (expirations.size() > offers.size() * 2 + 1024) {
+		std::vector<std::pair<uint32_t, uint32_t>> entries;
+		entries.reserve(offers.size());
+		for (const auto &[id, activeOffer] : offers) {
+			entries.emplace_back(activeOffer.created, id);
+		}
+		expirations = decltype(expirations)(std::greater<>(), std::move(entries));
+	}
+}
+
+void IOMarket::expireOffer(const Offer &offer) {
+	const uint32_t playerId = offer.playerId;
+	const uint16_t amount = offer.amount;
+	const uint8_t tier = offer.tier;
+	if (offer.type == MARKETACTION_SELL) {
+		const ItemType &itemType = Item::items[offer.itemId];
+		if (itemType.id == 0) {
+			return;
+		}
+
+		std::shared_ptr<Player> player = g_game().getPlayerByGUID(playerId);
+		if (!player) {
+			player = std::make_shared<Player>(nullptr);
+			if (!IOLoginData::loadPlayerById(player, playerId)) {
+				return;
+			}
+		}
+
+		if (itemType.stackable) {
+			uint16_t tmpAmount = amount;
+			while (tmpAmount > 0) {
+				uint16_t stackCount = std::min<uint16_t>(100, tmpAmount);
+				std::shared_ptr<Item> item = Item::CreateItem(itemType.id, stackCount);
+				if (g_game().internalAddItem(player->getInbox(), item, INDEX_WHEREEVER, FLAG_NOLIMIT) != RETURNVALUE_NOERROR) {
+					g_logger().error("[{}] Ocurred an error to add item with id {} to player {}", __FUNCTION__, itemType.id, player->getName());
+
+					break;
+				}
+
+				if (tier != 0) {
+					item->setAttribute(ItemAttribute_t::TIER, tier);
+				}
+
+				tmpAmount -= stackCount;
+			}
+		} else {
+			int32_t subType;
+			if (itemType.charges != 0) {
+				subType = itemType.charges;
+			} else {
+				subType = -1;
+			}
+
+			for (uint16_t i = 0; i < amount; ++i) {
+				std::shared_ptr<Item> item = Item::CreateItem(itemType.id, subType);
+				if (g_game().internalAddItem(player->getInbox(), item, INDEX_WHEREEVER, FLAG_NOLIMIT) != RETURNVALUE_NOERROR) {
+					break;
+				}
+
+				if (tier != 0) {
+					item->setAttribute(ItemAttribute_t::TIER, tier);
+				}
+			}
+		}
+
+		if (player->isOffline()) {
+			g_saveManager().savePlayer(player);
+		}
+	} else {
+		uint64_t totalPrice = offer.price * amount;
+
+		std::shared_ptr<Player> player = g_game().getPlayerByGUID(playerId);
+		if (player) {
+			player->setBankBalance(player->getBankBalance() + totalPrice);
+		} else {
+			IOLoginData::increaseBankBalance(playerId, totalPrice);
+		}
+	}
+}
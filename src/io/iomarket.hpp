@@ -12,47 +12,108 @@
 #include "database/database.hpp"
 #include "declarations.hpp"
 #include "lib/di/container.hpp"
+#include "lib/thread/thread_pool.hpp"
 
+/**
+ * The market keeps every active offer in memory: an order book per item, tier and
+ * side, the offers of each player and a min-heap of creation times for expiry, so
+ * browsing never reaches the database. The memory is authoritative while the server
+ * runs, changes are written to the database in the order they were made from the
+ * thread pool. Everything except the write queue belongs to the dispatcher.
+ *
+ * Statistics of accepted offers are read once at startup and then kept up to date
+ * as offers are accepted.
+ */
 class IOMarket {
-	using StatisticsMap = std::map<uint16_t, std::map<uint8_t, MarketStatistics>>;
-
 public:
-	IOMarket() = default;
+	IOMarket(ThreadPool &threadPool, Database &db);
+
+	// Ensures that we don't accidentally copy it
+	IOMarket(const IOMarket &) = delete;
+	IOMarket &operator=(const IOMarket &) = delete;
 
 	static IOMarket &getInstance() {
 		return inject<IOMarket>();
 	}
 
-	static MarketOfferList getActiveOffers(MarketAction_t action, uint16_t itemId, uint8_t tier);
-	static MarketOfferList getOwnOffers(MarketAction_t action, uint32_t playerId);
+	void loadOffers();
+	void updateStatistics();
+
+	MarketOfferList getActiveOffers(MarketAction_t action, uint16_t itemId, uint8_t tier) const;
+	MarketOfferList getOwnOffers(MarketAction_t action, uint32_t playerId) const;
 	static HistoryMarketOfferList getOwnHistory(MarketAction_t action, uint32_t playerId);
 
-	static void processExpiredOffers(DBResult_ptr result, bool);
-	static void checkExpiredOffers();
+	void checkExpiredOffers();
 
-	static uint32_t getPlayerOfferCount(uint32_t playerId);
-	static MarketOfferEx getOfferByCounter(uint32_t timestamp, uint16_t counter);
+	uint32_t getPlayerOfferCount(uint32_t playerId) const;
+	MarketOfferEx getOfferByCounter(uint32_t timestamp, uint16_t counter) const;
 
-	static void createOffer(uint32_t playerId, MarketAction_t action, uint32_t itemId, uint16_t amount, uint64_t price, uint8_t tier, bool anonymous);
-	static void acceptOffer(uint32_t offerId, uint16_t amount);
-	static void deleteOffer(uint32_t offerId);
+	void createOffer(uint32_t playerId, const std::string &playerName, MarketAction_t action, uint32_t itemId, uint16_t amount, uint64_t price, uint8_t tier, bool anonymous);
+	void acceptOffer(uint32_t offerId, uint16_t amount);
+	void deleteOffer(uint32_t offerId);
 
-	static void appendHistory(uint32_t playerId, MarketAction_t type, uint16_t itemId, uint16_t amount, uint64_t price, time_t timestamp, uint8_t tier, MarketOfferState_t state);
-	static bool moveOfferToHistory(uint32_t offerId, MarketOfferState_t state);
+	void appendHistory(uint32_t playerId, MarketAction_t type, uint16_t itemId, uint16_t amount, uint64_t price, time_t timestamp, uint8_t tier, MarketOfferState_t state);
+	bool moveOfferToHistory(uint32_t offerId, MarketOfferState_t state);
 
-	void updateStatistics();
+	MarketStatistics getPurchaseStatistics(uint16_t itemId, uint8_t tier) const;
+	MarketStatistics getSaleStatistics(uint16_t itemId, uint8_t tier) const;
 
-	StatisticsMap getPurchaseStatistics() const {
-		return purchaseStatistics;
-	}
-	StatisticsMap getSaleStatistics() const {
-		return saleStatistics;
-	}
+	// Writes the queued changes from the calling thread, the shutdown uses it to not lose them
+	void flushWrites();
 
 	static uint8_t getTierFromDatabaseTable(const std::string &string);
 
 private:
-	// [uint16_t = item id, [uint8_t = item tier, MarketStatistics = structure of the statistics]]
-	StatisticsMap purchaseStatistics;
-	StatisticsMap saleStatistics;
+	struct Offer {
+		uint32_t id;
+		uint32_t playerId;
+		uint32_t created;
+		uint64_t price;
+		uint16_t itemId;
+		uint16_t amount;
+		uint8_t tier;
+		MarketAction_t type;
+		bool anonymous;
+		std::string playerName;
+	};
+
+	static uint32_t getBookKey(MarketAction_t action, uint16_t itemId, uint8_t tier) {
+		return (static_cast<uint32_t>(itemId) << 16) | (static_cast<uint32_t>(tier) << 8) | static_cast<uint8_t>(action);
+	}
+	static uint64_t getCounterKey(uint32_t created, uint16_t counter) {
+		return (static_cast<uint64_t>(created) << 16) | counter;
+	}
+	static uint32_t getStatisticsKey(uint16_t itemId, uint8_t tier) {
+		return (static_cast<uint32_t>(itemId) << 8) | tier;
+	}
+
+	void addOffer(Offer &&offer);
+	void removeOffer(uint32_t offerId);
+	void expireOffer(const Offer &offer);
+
+	void persist(std::string query);
+
+	ThreadPool &threadPool;
+	Database &db;
+
+	phmap::flat_hash_map<uint32_t, Offer> offers;
+	// Offer ids of each book, oldest first
+	phmap::flat_hash_map<uint32_t, std::vector<uint32_t>> books;
+	phmap::flat_hash_map<uint32_t, std::vector<uint32_t>> playerOffers;
+	// The client names an offer by its creation time and the low bits of its id
+	phmap::flat_hash_map<uint64_t, uint32_t> counterOffers;
+	// Creation time and id of the offers, entries of removed offers are skipped when popped
+	std::priority_queue<std::pair<uint32_t, uint32_t>, std::vector<std::pair<uint32_t, uint32_t>>, std::greater<>> expirations;
+	uint32_t nextOfferId = 1;
+
+	phmap::flat_hash_map<uint32_t, MarketStatistics> purchaseStatistics;
+	phmap::flat_hash_map<uint32_t, MarketStatistics> saleStatistics;
+
+	std::mutex writeMutex;
+	// Held while queries are written, so the shutdown flush cannot overtake a worker
+	std::mutex writeOrderMutex;
+	std::deque<std::string> pendingWrites;
+	bool writing = false;
 };
+
+constexpr auto g_ioMarket = IOMarket::getInstance;
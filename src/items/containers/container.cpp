@@ -32,15 +32,15 @@ Container::Container(uint16_t initType, uint16_t initSize, bool initUnlocked /*=
 	pagination(initPagination) { }
 
 std::shared_ptr<Container> Container::create(uint16_t type) {
-	return std::make_shared<Container>(type);
+	return makePooled<Container, ItemPool>(type);
 }
 
 std::shared_ptr<Container> Container::create(uint16_t type, uint16_t size, bool unlocked /*= true*/, bool pagination /*= false*/) {
-	return std::make_shared<Container>(type, size, unlocked, pagination);
+	return makePooled<Container, ItemPool>(type, size, unlocked, pagination);
 }
 
 std::shared_ptr<Container> Container::create(std::shared_ptr<Tile> tile) {
-	auto container = std::make_shared<Container>(ITEM_BROWSEFIELD, 30, false, true);
+	auto container = makePooled<Container, ItemPool>(ITEM_BROWSEFIELD, 30, false, true);
 	TileItemVector* itemVector = tile->getItemList();
 	if (itemVector) {
 		for (auto &item : *itemVector) {
@@ -35,64 +35,47 @@ void Decay::startDecay(std::shared_ptr<Item> item) {
 	}
 
 	if (duration > 0) {
-		if (item->hasAttribute(ItemAttribute_t::DURATION_TIMESTAMP)) {
+		if (item->decayHandle.active) {
 			stopDecay(item);
 		}
 
-		int64_t timestamp = OTSYS_TIME() + duration;
-		if (decayMap.empty()) {
-			eventId = g_dispatcher().scheduleEvent(std::max<int32_t>(SCHEDULER_MINTICKS, duration), std::bind(&Decay::checkDecay, this), "Decay::checkDecay");
-		} else {
-			if (timestamp < decayMap.begin()->first) {
-				g_dispatcher().stopEvent(eventId);
-				eventId = g_dispatcher().scheduleEvent(std::max<int32_t>(SCHEDULER_MINTICKS, duration), std::bind(&Decay::checkDecay, this), "Decay::checkDecay");
-			}
+		if (decayingCount == 0) {
+			// The wheel was idle, so it starts counting from now instead of the last processed tick
+			currentTick = std::max<int64_t>(currentTick, OTSYS_TIME() / DECAY_TICK_MS);
 		}
 
+		int64_t timestamp = OTSYS_TIME() + duration;
 		item->setDecaying(DECAYING_TRUE);
 		item->setAttribute(ItemAttribute_t::DURATION_TIMESTAMP, timestamp);
-		decayMap[timestamp].push_back(item);
+		link(item, timestamp);
+		++decayingCount;
+
+		// Items added while the wheel is being checked are picked up by the reschedule at the end of the check
+		if (!checking && (eventId == 0 || (timestamp + DECAY_TICK_MS - 1) / DECAY_TICK_MS < nextCheckTick)) {
+			scheduleCheck();
+		}
 	}
 }
 
 void Decay::stopDecay(std::shared_ptr<Item> item) {
+	if (!item) {
+		return;
+	}
+
+	if (item->decayHandle.active) {
+		if (item->hasAttribute(ItemAttribute_t::DURATION)) {
+			// Incase we removed duration attribute don't assign new duration
+			item->setDuration(item->getDuration());
+		}
+		item->removeAttribute(ItemAttribute_t::DECAYSTATE);
+
+		unlink(item);
+		--decayingCount;
+		return;
+	}
+
 	if (item->hasAttribute(ItemAttribute_t::DECAYSTATE)) {
-		auto timestamp = item->getAttribute<int64_t>(ItemAttribute_t::DURATION_TIMESTAMP);
 		if (item->hasAttribute(ItemAttribute_t::DURATION_TIMESTAMP)) {
-			auto it = decayMap.find(timestamp);
-			if (it != decayMap.end()) {
-				auto &decayItems = it->second;
-
-				size_t i = 0, end = decayItems.size();
-				auto decayItem = decayItems[i];
-				if (end == 1) {
-					if (item == decayItem) {
-						if (item->hasAttribute(ItemAttribute_t::DURATION)) {
-							// Incase we removed duration attribute don't assign new duration
-							item->setDuration(item->getDuration());
-						}
-						item->removeAttribute(ItemAttribute_t::DECAYSTATE);
-
-						decayMap.erase(it);
-					}
-					return;
-				}
-				while (i < end) {
-					decayItem = decayItems[i];
-					if (item == decayItem) {
-						if (item->hasAttribute(ItemAttribute_t::DURATION)) {
-							// Incase we removed duration attribute don't assign new duration
-							item->setDuration(item->getDuration());
-						}
-						item->removeAttribute(ItemAttribute_t::DECAYSTATE);
-
-						decayItems[i] = decayItems.back();
-						decayItems.pop_back();
-						return;
-					}
-					++i;
-				}
-			}
 			item->removeAttribute(ItemAttribute_t::DURATION_TIMESTAMP);
 		} else {
 			item->removeAttribute(ItemAttribute_t::DECAYSTATE);
@@ -100,25 +83,106 @@ void Decay::stopDecay(std::shared_ptr<Item> item) {
 	}
 }
 
+void Decay::link(const std::shared_ptr<Item> &item, int64_t timestamp) {
+	// Round up, so an item is never decayed before its timestamp
+	const int64_t expireTick = std::max<int64_t>(currentTick, (timestamp + DECAY_TICK_MS - 1) / DECAY_TICK_MS);
+	const int64_t delta = expireTick - currentTick;
+
+	uint8_t level = 0;
+	while (level + 1 < WHEEL_LEVELS && delta >= (int64_t(1) << (WHEEL_BITS * (level + 1)))) {
+		++level;
+	}
+
+	// Deadlines beyond the wheel horizon wait in the farthest slot and are placed again when it is cascaded
+	const int64_t horizon = int64_t(1) << (WHEEL_BITS * WHEEL_LEVELS);
+	const int64_t slotTick = delta < horizon ? expireTick : currentTick + horizon - 1;
+	const auto slot = static_cast<uint16_t>((slotTick >> (WHEEL_BITS * level)) & WHEEL_MASK);
+
+	auto &bucket = wheel[level][slot];
+	item->decayHandle = { timestamp, static_cast<uint32_t>(bucket.size()), slot, level, true };
+	bucket.emplace_back(item);
+}
+
+void Decay::unlink(const std::shared_ptr<Item> &item) {
+	auto &handle = item->decayHandle;
+	auto &bucket = wheel[handle.level][handle.slot];
+	if (handle.index + 1 != bucket.size()) {
+		bucket[handle.index] = std::move(bucket.back());
+		bucket[handle.index]->decayHandle.index = handle.index;
+	}
+	bucket.pop_back();
+	handle = {};
+}
+
+uint32_t Decay::cascade(uint8_t level) {
+	const auto slot = static_cast<size_t>((currentTick >> (WHEEL_BITS * level)) & WHEEL_MASK);
+	auto items = std::move(wheel[level][slot]);
+	wheel[level][slot].clear();
+
+	for (const auto &item : items) {
+		link(item, item->decayHandle.timestamp);
+	}
+	return static_cast<uint32_t>(items.size());
+}
+
+void Decay::scheduleCheck() {
+	if (eventId != 0) {
+		g_dispatcher().stopEvent(eventId);
+		eventId = 0;
+	}
+
+	if (decayingCount == 0) {
+		return;
+	}
+
+	// Wake up on the first non-empty slot, or at the end of the current revolution to cascade the upper levels
+	nextCheckTick = (currentTick | WHEEL_MASK) + 1;
+	for (int64_t tick = currentTick; tick < nextCheckTick; ++tick) {
+		if (!wheel[0][tick & WHEEL_MASK].empty()) {
+			nextCheckTick = tick;
+			break;
+		}
+	}
+
+	const int64_t delay = nextCheckTick * DECAY_TICK_MS - OTSYS_TIME();
+	eventId = g_dispatcher().scheduleEvent(static_cast<uint32_t>(std::max<int64_t>(SCHEDULER_MINTICKS, delay)), std::bind(&Decay::checkDecay, this), "Decay::checkDecay");
+}
+
 void Decay::checkDecay() {
-	int64_t timestamp = OTSYS_TIME();
+	const auto start = std::chrono::steady_clock::now();
+	// This event is the one being executed, it must not be stopped by the reschedule below
+	eventId = 0;
+	checking = true;
+
+	const int64_t nowTick = OTSYS_TIME() / DECAY_TICK_MS;
+	DecayTickStats stats;
 
 	std::vector<std::shared_ptr<Item>> tempItems;
 	tempItems.reserve(32); // Small preallocation
 
-	auto it = decayMap.begin(), end = decayMap.end();
-	while (it != end) {
-		if (it->first > timestamp) {
-			break;
+	while (currentTick <= nowTick && decayingCount > 0) {
+		if ((currentTick & WHEEL_MASK) == 0) {
+			// Find the highest level whose slot starts on this tick, and cascade from there down
+			uint8_t level = 1;
+			while (level + 1 < WHEEL_LEVELS && ((currentTick >> (WHEEL_BITS * level)) & WHEEL_MASK) == 0) {
+				++level;
+			}
+			for (; level > 0; --level) {
+				stats.cascaded += cascade(level);
+			}
 		}
 
-		// Iterating here is unsafe so let's copy our items into temporary vector
-		auto &decayItems = it->second;
-		tempItems.reserve(tempItems.size() + decayItems.size());
+		// Iterating here is unsafe so let's move our items into temporary vector
+		auto &decayItems = wheel[0][currentTick & WHEEL_MASK];
 		for (auto &decayItem : decayItems) {
-			tempItems.push_back(decayItem);
+			decayItem->decayHandle = {};
+			tempItems.emplace_back(std::move(decayItem));
 		}
-		it = decayMap.erase(it);
+		decayingCount -= decayItems.size();
+		decayItems.clear();
+
+		++currentTick;
+		++stats.ticks;
 	}
 
 	for (const auto &item : tempItems) {
@@ -131,8 +195,14 @@ void Decay::checkDecay() {
 		}
 	}
 
-	if (it != end) {
-		eventId = g_dispatcher().scheduleEvent(std::max<int32_t>(SCHEDULER_MINTICKS, static_cast<int32_t>(it->first - timestamp)), std::bind(&Decay::checkDecay, this), "Decay::checkDecay");
+	checking = false;
+	scheduleCheck();
+
+	stats.expired = static_cast<uint32_t>(tempItems.size());
+	stats.durationUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+	lastTickStats = stats;
+	if (stats.expired > 0 || stats.cascaded > 0) {
+		g_logger().trace("[Decay::checkDecay] - ticks: {}, expired: {}, cascaded: {}, decaying: {}, took {} us", stats.ticks, stats.expired, stats.cascaded, decayingCount, stats.durationUs);
 	}
 }
 
@@ -11,6 +11,24 @@
 
 #include "items/item.hpp"
 
+struct DecayTickStats {
+	// Wheel ticks advanced by the last check
+	uint32_t ticks = 0;
+	// Items that expired and were decayed by the last check
+	uint32_t expired = 0;
+	// Items moved down from an upper wheel level by the last check
+	uint32_t cascaded = 0;
+	// Time spent in the last check, in microseconds
+	int64_t durationUs = 0;
+};
+
+/**
+ * Decay keeps the decaying items in a hierarchical timing wheel.
+ * Each level has WHEEL_SIZE slots; a level 0 slot covers one DECAY_TICK_MS tick and every upper level
+ * slot covers a whole revolution of the level below. Items are cascaded down when their upper slot is reached,
+ * so each check only touches the items that are due. Every Item keeps a DecayHandle with its slot and index,
+ * which makes removing it O(1).
+ */
 class Decay {
 public:
 	Decay() = default;
@@ -25,13 +43,36 @@ public:
 	void startDecay(std::shared_ptr<Item> item);
 	void stopDecay(std::shared_ptr<Item> item);
 
+	size_t getDecayingCount() const {
+		return decayingCount;
+	}
+	const DecayTickStats &getLastTickStats() const {
+		return lastTickStats;
+	}
+
 private:
+	static constexpr int64_t DECAY_TICK_MS = 50;
+	static constexpr uint8_t WHEEL_BITS = 8;
+	static constexpr uint8_t WHEEL_LEVELS = 3;
+	static constexpr size_t WHEEL_SIZE = 1 << WHEEL_BITS;
+	static constexpr int64_t WHEEL_MASK = WHEEL_SIZE - 1;
+
 	void checkDecay();
+	void scheduleCheck();
 	void internalDecayItem(std::shared_ptr<Item> item);
 
-	uint32_t eventId { 0 };
-	// order is important, so we use an std::map
-	std::map<int64_t, std::vector<std::shared_ptr<Item>>> decayMap;
+	void link(const std::shared_ptr<Item> &item, int64_t timestamp);
+	void unlink(const std::shared_ptr<Item> &item);
+	uint32_t cascade(uint8_t level);
+
+	uint64_t eventId { 0 };
+	int64_t nextCheckTick { 0 };
+	int64_t currentTick { 0 };
+	size_t decayingCount { 0 };
+	bool checking { false };
+
+	DecayTickStats lastTickStats;
+	std::array<std::array<std::vector<std::shared_ptr<Item>>, WHEEL_SIZE>, WHEEL_LEVELS> wheel;
 };
 
 constexpr auto g_decay = Decay::getInstance;
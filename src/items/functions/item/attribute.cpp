@@ -11,6 +11,62 @@
 
 #include "items/functions/item/attribute.hpp"
 
+namespace {
+	// Interned text attributes. The pool only holds weak references, a value is freed
+	// with the last item using it and its entry is swept once enough of them pile up
+	class SharedStringPool {
+	public:
+		SharedString intern(const std::string &value) {
+			// Items are also created by the map loader in the thread pool
+			std::scoped_lock lock(mutex);
+			auto &entry = strings[value];
+			if (SharedString string = entry.lock()) {
+				return string;
+			}
+
+			auto string = std::make_shared<const std::string>(value);
+			entry = string;
+			if (strings.size() >= sweepSize) {
+				phmap::erase_if(strings, [](const auto &it) {
+					return it.second.expired();
+				});
+				sweepSize = std::max<size_t>(MIN_SWEEP_SIZE, strings.size() * 2);
+			}
+			return string;
+		}
+
+	private:
+		static constexpr size_t MIN_SWEEP_SIZE = 4096;
+
+		std::mutex mutex;
+		phmap::flat_hash_map<std::string, std::weak_ptr<const std::string>> strings;
+		size_t sweepSize = MIN_SWEEP_SIZE;
+	};
+
+	SharedString makeSharedString(ItemAttribute_t type, const std::string &value) {
+		// Written text is mostly unique, sharing it would only grow the pool
+		if (type == ItemAttribute_t::TEXT) {
+			return std::make_shared<const std::string>(value);
+		}
+
+		static SharedStringPool pool;
+		return pool.intern(value);
+	}
+}
+
+ItemAttribute::ItemAttribute(const ItemAttribute &other) :
+	attributeBits(other.attributeBits),
+	integers(other.integers),
+	strings(other.strings),
+	customAttributeMap(other.customAttributeMap ? std::make_unique<CustomAttributeMap>(*other.customAttributeMap) : nullptr) { }
+
+ItemAttribute &ItemAttribute::operator=(const ItemAttribute &other) {
+	if (this != &other) {
+		*this = ItemAttribute(other);
+	}
+	return *this;
+}
+
 /*
 =============================
 * ItemAttribute class (Attributes methods)
@@ -18,52 +74,20 @@
 */
 const std::string &ItemAttribute::getAttributeString(ItemAttribute_t type) const {
 	static std::string emptyString;
-	if (!isAttributeString(type)) {
-		return emptyString;
-	}
-
-	auto attribute = getAttribute(type);
-	if (!attribute) {
+	if (!isAttributeString(type) || !hasAttribute(type)) {
 		return emptyString;
 	}
 
-	return *attribute->getString().get();
+	return *strings[getIndex(STRING_BITS, type)];
 }
 
 const int64_t &ItemAttribute::getAttributeValue(ItemAttribute_t type) const {
 	static int64_t emptyInt;
-	if (!isAttributeInteger(type)) {
-		return emptyInt;
-	}
-
-	auto attribute = getAttribute(type);
-	if (!attribute) {
+	if (!isAttributeInteger(type) || !hasAttribute(type)) {
 		return emptyInt;
 	}
 
-	return attribute->getInteger();
-}
-
-const Attributes* ItemAttribute::getAttribute(ItemAttribute_t type) const {
-	if (hasAttribute(type)) {
-		for (const Attributes &attribute : attributeVector) {
-			if (attribute.getAttributeType() == type) {
-				return &attribute;
-			}
-		}
-	}
-	return nullptr;
-}
-
-Attributes &ItemAttribute::getAttributesByType(ItemAttribute_t type) {
-	for (Attributes &attribute : attributeVector) {
-		if (attribute.getAttributeType() == type) {
-			return attribute;
-		}
-	}
-
-	attributeVector.emplace_back(type);
-	return attributeVector.back();
+	return integers[getIndex(~STRING_BITS, type)];
 }
 
 void ItemAttribute::setAttribute(ItemAttribute_t type, int64_t value) {
@@ -71,7 +95,14 @@ void ItemAttribute::setAttribute(ItemAttribute_t type, int64_t value) {
 		return;
 	}
 
-	getAttributesByType(type).setValue(value);
+	const size_t index = getIndex(~STRING_BITS, type);
+	if (hasAttribute(type)) {
+		integers[index] = value;
+		return;
+	}
+
+	integers.insert(integers.begin() + static_cast<ptrdiff_t>(index), value);
+	attributeBits |= getBit(type);
 }
 
 void ItemAttribute::setAttribute(ItemAttribute_t type, const std::string &value) {
@@ -83,18 +114,30 @@ void ItemAttribute::setAttribute(ItemAttribute_t type, const std::string &value)
 		return;
 	}
 
-	getAttributesByType(type).setValue(value);
+	const size_t index = getIndex(STRING_BITS, type);
+	if (hasAttribute(type)) {
+		if (*strings[index] != value) {
+			strings[index] = makeSharedString(type, value);
+		}
+		return;
+	}
+
+	strings.insert(strings.begin() + static_cast<ptrdiff_t>(index), makeSharedString(type, value));
+	attributeBits |= getBit(type);
 }
 
 bool ItemAttribute::removeAttribute(ItemAttribute_t type) {
-	for (auto it = attributeVector.begin(); it != attributeVector.end(); ++it) {
-		if (it->getAttributeType() == type) {
-			*it = std::move(attributeVector.back());
-			attributeVector.pop_back();
-			return true;
-		}
+	if (!hasAttribute(type)) {
+		return false;
 	}
-	return false;
+
+	if (isAttributeString(type)) {
+		strings.erase(strings.begin() + static_cast<ptrdiff_t>(getIndex(STRING_BITS, type)));
+	} else {
+		integers.erase(integers.begin() + static_cast<ptrdiff_t>(getIndex(~STRING_BITS, type)));
+	}
+	attributeBits &= ~getBit(type);
+	return true;
 }
 
 /*
@@ -102,8 +145,9 @@ bool ItemAttribute::removeAttribute(ItemAttribute_t type) {
 * CustomAttribute map methods
 =============================
 */
-const std::map<std::string, CustomAttribute, std::less<>> &ItemAttribute::getCustomAttributeMap() const {
-	return customAttributeMap;
+const CustomAttributeMap &ItemAttribute::getCustomAttributeMap() const {
+	static const CustomAttributeMap emptyMap;
+	return customAttributeMap ? *customAttributeMap : emptyMap;
 }
 
 /*
@@ -112,42 +156,44 @@ const std::map<std::string, CustomAttribute, std::less<>> &ItemAttribute::getCus
 =============================
 */
 const CustomAttribute* ItemAttribute::getCustomAttribute(const std::string &attributeName) const {
-	if (customAttributeMap.contains(asLowerCaseString(attributeName))) {
-		return &customAttributeMap.at(asLowerCaseString(attributeName));
+	if (!customAttributeMap) {
+		return nullptr;
 	}
-	return nullptr;
+
+	const auto it = customAttributeMap->find(asLowerCaseString(attributeName));
+	return it != customAttributeMap->end() ? &it->second : nullptr;
 }
 
 void ItemAttribute::setCustomAttribute(const std::string &key, const int64_t value) {
-	CustomAttribute attribute(key, value);
-	customAttributeMap[asLowerCaseString(key)] = attribute;
+	addCustomAttribute(key, CustomAttribute(key, value));
 }
 
 void ItemAttribute::setCustomAttribute(const std::string &key, const std::string &value) {
-	CustomAttribute attribute(key, value);
-	customAttributeMap[asLowerCaseString(key)] = attribute;
+	addCustomAttribute(key, CustomAttribute(key, value));
 }
 
 void ItemAttribute::setCustomAttribute(const std::string &key, const double value) {
-	CustomAttribute attribute(key, value);
-	customAttributeMap[asLowerCaseString(key)] = attribute;
+	addCustomAttribute(key, CustomAttribute(key, value));
 }
 
 void ItemAttribute::setCustomAttribute(const std::string &key, const bool value) {
-	CustomAttribute attribute(key, value);
-	customAttributeMap[asLowerCaseString(key)] = attribute;
+	addCustomAttribute(key, CustomAttribute(key, value));
 }
 
 void ItemAttribute::addCustomAttribute(const std::string &key, const CustomAttribute &customAttribute) {
-	customAttributeMap[asLowerCaseString(key)] = customAttribute;
+	if (!customAttributeMap) {
+		customAttributeMap = std::make_unique<CustomAttributeMap>();
+	}
+	(*customAttributeMap)[asLowerCaseString(key)] = customAttribute;
 }
 
 bool ItemAttribute::removeCustomAttribute(const std::string &attributeName) {
-	auto it = customAttributeMap.find(asLowerCaseString(attributeName));
-	if (it == customAttributeMap.end()) {
+	if (!customAttributeMap || customAttributeMap->erase(asLowerCaseString(attributeName)) == 0) {
 		return false;
 	}
 
-	customAttributeMap.erase(it);
+	if (customAttributeMap->empty()) {
+		customAttributeMap.reset();
+	}
 	return true;
 }
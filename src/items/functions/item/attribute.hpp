@@ -15,7 +15,7 @@
 
 class ItemAttributeHelper {
 public:
-	bool isAttributeInteger(ItemAttribute_t type) const {
+	constexpr bool isAttributeInteger(ItemAttribute_t type) const {
 		switch (type) {
 			case ItemAttribute_t::STORE:
 			case ItemAttribute_t::ACTIONID:
@@ -47,7 +47,7 @@ public:
 		}
 	}
 
-	bool isAttributeString(ItemAttribute_t type) const {
+	constexpr bool isAttributeString(ItemAttribute_t type) const {
 		switch (type) {
 			case ItemAttribute_t::DESCRIPTION:
 			case ItemAttribute_t::TEXT:
@@ -65,75 +65,26 @@ public:
 	}
 };
 
-class Attributes : public ItemAttributeHelper {
-public:
-	explicit Attributes(ItemAttribute_t type) :
-		type(type), value(getDefaultValueForType(type)) { }
-	~Attributes() = default;
-
-	Attributes(const Attributes &i) :
-		type(i.type), value(i.value) { }
-	Attributes(Attributes &&attribute) noexcept :
-		type(attribute.type), value(std::move(attribute.value)) { }
-
-	Attributes &operator=(Attributes &&other) noexcept {
-		type = other.type;
-		value = std::move(other.value);
-		return *this;
-	}
-
-	const ItemAttribute_t &getAttributeType() const {
-		return type;
-	}
-
-	std::variant<int64_t, std::shared_ptr<std::string>> getDefaultValueForType(ItemAttribute_t attributeType) const {
-		ItemAttributeHelper helper;
-		if (helper.isAttributeInteger(attributeType)) {
-			return 0;
-		} else if (helper.isAttributeString(attributeType)) {
-			return std::make_shared<std::string>();
-		} else {
-			return {};
-		}
-	}
-
-	void setValue(int64_t newValue) {
-		if (std::holds_alternative<int64_t>(value)) {
-			value = newValue;
-		}
-	}
-	void setValue(const std::string &newValue) {
-		if (std::holds_alternative<std::shared_ptr<std::string>>(value)) {
-			value = std::make_shared<std::string>(newValue);
-		}
-	}
-	const int64_t &getInteger() const {
-		if (std::holds_alternative<int64_t>(value)) {
-			return std::get<int64_t>(value);
-		}
-		static int64_t emptyValue;
-		return emptyValue;
-	}
-
-	const std::shared_ptr<std::string> getString() const {
-		if (std::holds_alternative<std::shared_ptr<std::string>>(value)) {
-			return std::get<std::shared_ptr<std::string>>(value);
-		}
-		static std::shared_ptr<std::string> emptyPtr;
-		return emptyPtr;
-	}
-
-private:
-	ItemAttribute_t type;
-	std::variant<int64_t, std::shared_ptr<std::string>> value;
-};
+// Text attributes share one copy of each distinct value, see ItemAttribute::setAttribute
+using SharedString = std::shared_ptr<const std::string>;
+using CustomAttributeMap = phmap::flat_hash_map<std::string, CustomAttribute>;
 
+/**
+ * Attributes of one item. A bit per ItemAttribute_t tells which are set, and the values
+ * are packed in type order, so finding one is a bit test and a popcount instead of a
+ * scan. Text other than TEXT itself is interned: writers, descriptions and names that
+ * repeat over thousands of items point to the same string.
+ */
 class ItemAttribute : public ItemAttributeHelper {
 public:
 	ItemAttribute() = default;
+	ItemAttribute(const ItemAttribute &other);
+	ItemAttribute &operator=(const ItemAttribute &other);
+	ItemAttribute(ItemAttribute &&) noexcept = default;
+	ItemAttribute &operator=(ItemAttribute &&) noexcept = default;
 
 	// CustomAttribute map methods
-	const std::map<std::string, CustomAttribute, std::less<>> &getCustomAttributeMap() const;
+	const CustomAttributeMap &getCustomAttributeMap() const;
 	// CustomAttribute object methods
 	const CustomAttribute* getCustomAttribute(const std::string &attributeName) const;
 
@@ -152,24 +103,38 @@ public:
 	const std::string &getAttributeString(ItemAttribute_t type) const;
 	const int64_t &getAttributeValue(ItemAttribute_t type) const;
 
-	const std::vector<Attributes> &getAttributeVector() const {
-		return attributeVector;
+	// One bit per ItemAttribute_t that is set
+	uint64_t getAttributeBits() const {
+		return attributeBits;
 	}
 
 	bool hasAttribute(ItemAttribute_t type) const {
-		for (const auto &attr : attributeVector) {
-			if (attr.getAttributeType() == type) {
-				return true;
-			}
-		}
-		return false;
+		return (attributeBits & getBit(type)) != 0;
+	}
+
+private:
+	static constexpr uint64_t getBit(ItemAttribute_t type) {
+		return type < 64 ? uint64_t { 1 } << type : 0;
 	}
 
-	const Attributes* getAttribute(ItemAttribute_t type) const;
+	static constexpr uint64_t STRING_BITS = [] {
+		uint64_t bits = 0;
+		for (uint64_t type = 0; type < 64; ++type) {
+			if (ItemAttributeHelper().isAttributeString(static_cast<ItemAttribute_t>(type))) {
+				bits |= uint64_t { 1 } << type;
+			}
+		}
+		return bits;
+	}();
 
-	Attributes &getAttributesByType(ItemAttribute_t type);
+	// Position of the value of type among the values of the attributes in mask
+	size_t getIndex(uint64_t mask, ItemAttribute_t type) const {
+		return static_cast<size_t>(std::popcount(attributeBits & mask & (getBit(type) - 1)));
+	}
 
-private:
-	std::map<std::string, CustomAttribute, std::less<>> customAttributeMap;
-	std::vector<Attributes> attributeVector;
+	uint64_t attributeBits = 0;
+	std::vector<int64_t> integers;
+	std::vector<SharedString> strings;
+	// Few items have custom attributes, the others do not pay for an empty map
+	std::unique_ptr<CustomAttributeMap> customAttributeMap;
 };
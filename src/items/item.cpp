@@ -37,29 +37,29 @@ std::shared_ptr<Item> Item::CreateItem(const uint16_t type, uint16_t count /*= 0
 
 	if (it.id != 0) {
 		if (it.isDepot()) {
-			newItem = std::make_shared<DepotLocker>(type, 4);
+			newItem = makePooled<DepotLocker, ItemPool>(type, 4);
 		} else if (it.isRewardChest()) {
-			newItem = std::make_shared<RewardChest>(type);
+			newItem = makePooled<RewardChest, ItemPool>(type);
 		} else if (it.isContainer()) {
-			newItem = std::make_shared<Container>(type);
+			newItem = makePooled<Container, ItemPool>(type);
 		} else if (it.isTeleport()) {
-			newItem = std::make_shared<Teleport>(type);
+			newItem = makePooled<Teleport, ItemPool>(type);
 		} else if (it.isMagicField()) {
-			newItem = std::make_shared<MagicField>(type);
+			newItem = makePooled<MagicField, ItemPool>(type);
 		} else if (it.isDoor()) {
-			newItem = std::make_shared<Door>(type);
+			newItem = makePooled<Door, ItemPool>(type);
 		} else if (it.isTrashHolder()) {
-			newItem = std::make_shared<TrashHolder>(type);
+			newItem = makePooled<TrashHolder, ItemPool>(type);
 		} else if (it.isMailbox()) {
-			newItem = std::make_shared<Mailbox>(type);
+			newItem = makePooled<Mailbox, ItemPool>(type);
 		} else if (it.isBed()) {
-			newItem = std::make_shared<BedItem>(type);
+			newItem = makePooled<BedItem, ItemPool>(type);
 		} else {
 			auto itemMap = ItemTransformationMap.find(static_cast<ItemID_t>(it.id));
 			if (itemMap != ItemTransformationMap.end()) {
-				newItem = std::make_shared<Item>(itemMap->second, count);
+				newItem = makePooled<Item, ItemPool>(itemMap->second, count);
 			} else {
-				newItem = std::make_shared<Item>(type, count);
+				newItem = makePooled<Item, ItemPool>(type, count);
 			}
 		}
 	} else if (type > 0 && itemPosition) {
@@ -139,7 +139,7 @@ std::shared_ptr<Container> Item::CreateItemAsContainer(const uint16_t type, uint
 		return nullptr;
 	}
 
-	std::shared_ptr<Container> newItem = std::make_shared<Container>(type, size);
+	std::shared_ptr<Container> newItem = makePooled<Container, ItemPool>(type, size);
 	return newItem;
 }
 
@@ -238,19 +238,15 @@ bool Item::equals(std::shared_ptr<Item> compareItem) const {
 		return false;
 	}
 
-	for (const auto &attribute : getAttributeVector()) {
-		for (const auto &compareAttribute : compareItem->getAttributeVector()) {
-			if (attribute.getAttributeType() != compareAttribute.getAttributeType()) {
-				continue;
-			}
-
-			if (isAttributeInteger(attribute.getAttributeType()) && attribute.getInteger() != compareAttribute.getInteger()) {
-				return false;
-			}
+	// Attributes set on both items must match
+	for (uint64_t bits = getAttributeBits() & compareItem->getAttributeBits(); bits != 0; bits &= bits - 1) {
+		const auto type = static_cast<ItemAttribute_t>(std::countr_zero(bits));
+		if (isAttributeInteger(type) && getInteger(type) != compareItem->getInteger(type)) {
+			return false;
+		}
 
-			if (isAttributeString(attribute.getAttributeType()) && attribute.getString() != compareAttribute.getString()) {
-				return false;
-			}
+		if (isAttributeString(type) && getString(type) != compareItem->getString(type)) {
+			return false;
 		}
 	}
 
@@ -942,7 +938,7 @@ void Item::serializeAttr(PropWriteStream &propWriteStream) const {
 
 	// Serialize custom attributes, only serialize if the map not is empty
 	if (hasCustomAttribute()) {
-		auto customAttributeMap = getCustomAttributeMap();
+		const auto &customAttributeMap = getCustomAttributeMap();
 		propWriteStream.write<uint8_t>(ATTR_CUSTOM);
 		propWriteStream.write<uint64_t>(customAttributeMap.size());
 		for (const auto &[attributeKey, customAttribute] : customAttributeMap) {
@@ -3128,18 +3124,16 @@ bool Item::hasMarketAttributes() const {
 		return true;
 	}
 
-	for (const auto &attribute : getAttributeVector()) {
-		if (attribute.getAttributeType() == ItemAttribute_t::CHARGES && static_cast<uint16_t>(attribute.getInteger()) != items[id].charges) {
-			return false;
-		}
+	if (hasAttribute(ItemAttribute_t::CHARGES) && static_cast<uint16_t>(getInteger(ItemAttribute_t::CHARGES)) != items[id].charges) {
+		return false;
+	}
 
-		if (attribute.getAttributeType() == ItemAttribute_t::DURATION && static_cast<uint32_t>(attribute.getInteger()) != getDefaultDuration()) {
-			return false;
-		}
+	if (hasAttribute(ItemAttribute_t::DURATION) && static_cast<uint32_t>(getInteger(ItemAttribute_t::DURATION)) != getDefaultDuration()) {
+		return false;
+	}
 
-		if (attribute.getAttributeType() == ItemAttribute_t::TIER && static_cast<uint8_t>(attribute.getInteger()) != getTier()) {
-			return false;
-		}
+	if (hasAttribute(ItemAttribute_t::TIER) && static_cast<uint8_t>(getInteger(ItemAttribute_t::TIER)) != getTier()) {
+		return false;
 	}
 
 	if (hasImbuements()) {
@@ -17,6 +17,7 @@
 #include "lua/scripts/luascript.hpp"
 #include "utils/tools.hpp"
 #include "io/fileloader.hpp"
+#include "lib/memory/pool_allocator.hpp"
 
 class Creature;
 class Player;
@@ -31,7 +32,12 @@ class BedItem;
 class Imbuement;
 class Item;
 
-// This class ItemProperties that serves as an interface to access and modify attributes of an item. The item's attributes are stored in an instance of ItemAttribute. The class ItemProperties has methods to get and set integer and string attributes, check if an attribute exists, remove an attribute, get the underlying attribute bits, and get a vector of attributes. It also has methods to get and set custom attributes, which are stored in a std::map<std::string, CustomAttribute, std::less<>>. The class has a data member attributePtr of type std::unique_ptr<ItemAttribute> that stores a pointer to the item's attributes methods.
+// Items of every kind are allocated from this pool, see makePooled
+struct ItemPool {
+	static constexpr std::string_view name = "items";
+};
+
+// This class ItemProperties that serves as an interface to access and modify attributes of an item. The item's attributes are stored in an instance of ItemAttribute. The class ItemProperties has methods to get and set integer and string attributes, check if an attribute exists, remove an attribute, get the underlying attribute bits, and get a vector of attributes. It also has methods to get and set custom attributes, which are stored in a flat hash map keyed by their lowercase name. The class has a data member attributePtr of type std::unique_ptr<ItemAttribute> that stores a pointer to the item's attributes methods.
 class ItemProperties {
 public:
 	template <typename T>
@@ -76,8 +82,8 @@ public:
 	}
 
 	// Custom Attributes
-	const std::map<std::string, CustomAttribute, std::less<>> &getCustomAttributeMap() const {
-		static std::map<std::string, CustomAttribute, std::less<>> map = {};
+	const CustomAttributeMap &getCustomAttributeMap() const {
+		static CustomAttributeMap map = {};
 		if (!attributePtr) {
 			return map;
 		}
@@ -172,13 +178,12 @@ protected:
 		return attributePtr;
 	}
 
-	const std::vector<Attributes> &getAttributeVector() const {
-		static std::vector<Attributes> emptyVector = {};
+	uint64_t getAttributeBits() const {
 		if (!attributePtr) {
-			return emptyVector;
+			return 0;
 		}
 
-		return attributePtr->getAttributeVector();
+		return attributePtr->getAttributeBits();
 	}
 
 	const int64_t &getInteger(ItemAttribute_t type) const {
@@ -212,6 +217,15 @@ private:
 	friend class Item;
 };
 
+// Position of an item inside the Decay timing wheel, lets Decay unlink it in O(1) without touching the attributes
+struct DecayHandle {
+	int64_t timestamp = 0;
+	uint32_t index = 0;
+	uint16_t slot = 0;
+	uint8_t level = 0;
+	bool active = false;
+};
+
 class Item : virtual public Thing, public ItemProperties, public SharedObject {
 public:
 	// Factory member to create item of right type based on type
@@ -689,6 +703,8 @@ protected:
 	bool isLootTrackeable = false;
 	bool decayDisabled = false;
 
+	DecayHandle decayHandle;
+
 private:
 	void setImbuement(uint8_t slot, uint16_t imbuementId, uint32_t duration);
 	// Don't add variables here, use the ItemAttribute class.
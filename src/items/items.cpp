@@ -11,7 +11,9 @@
 
 #include "items/functions/item/item_parse.hpp"
 #include "items/items.hpp"
+#include "creatures/combat/condition.hpp"
 #include "game/game.hpp"
+#include "io/fileloader.hpp"
 #include "utils/pugicast.hpp"
 
 Items::Items() = default;
@@ -63,7 +65,15 @@ ItemTypes_t Items::getLootType(const std::string &strValue) {
 
 bool Items::reload() {
 	clear();
-	loadFromProtobuf();
+	// A server started from the items snapshot never parsed appearances.dat
+	if (g_game().appearances.object_size() == 0) {
+		const std::string appearancesFile = g_configManager().getString(CORE_DIRECTORY) + "/items/appearances.dat";
+		if (g_game().loadAppearanceProtobuf(appearancesFile) != ERROR_NONE) {
+			return false;
+		}
+	} else {
+		loadFromProtobuf();
+	}
 
 	if (!loadFromXml()) {
 		return false;
@@ -228,6 +238,190 @@ bool Items::loadFromXml() {
 	return true;
 }
 
+namespace {
+	// Plain ItemType fields, stored as is by the items snapshot
+	template <typename ItemTypeRef>
+	auto snapshotFields(ItemTypeRef &itemType) {
+		return std::tie(
+			itemType.group, itemType.type, itemType.id,
+			itemType.levelDoor, itemType.decayTime, itemType.wieldInfo, itemType.minReqLevel, itemType.minReqMagicLevel, itemType.charges, itemType.buyPrice, itemType.sellPrice,
+			itemType.weight, itemType.maxHitChance, itemType.decayTo, itemType.attack, itemType.defense, itemType.extraDefense, itemType.armor, itemType.rotateTo, itemType.runeMagLevel, itemType.runeLevel, itemType.wrapableTo,
+			itemType.combatType, itemType.animationType,
+			itemType.transformToOnUse[0], itemType.transformToOnUse[1], itemType.transformToFree, itemType.destroyTo, itemType.maxTextLen, itemType.writeOnceItemId, itemType.transformEquipTo, itemType.transformDeEquipTo,
+			itemType.maxItems, itemType.slotPosition, itemType.speed, itemType.wareId, itemType.bedPartOf, itemType.m_transformOnUse,
+			itemType.magicEffect, itemType.bedPartnerDir, itemType.bedPart, itemType.weaponType, itemType.ammoType, itemType.shootType, itemType.corpseType, itemType.fluidSource, itemType.floorChange,
+			itemType.upgradeClassification, itemType.alwaysOnTopOrder, itemType.lightLevel, itemType.lightColor, itemType.shootRange, itemType.imbuementSlot, itemType.stackSize, itemType.hitChance,
+			itemType.wearOut, itemType.clockExpire, itemType.expire, itemType.expireStop,
+			itemType.forceUse, itemType.hasHeight, itemType.walkStack, itemType.blockSolid, itemType.blockPickupable, itemType.blockProjectile, itemType.blockPathFind,
+			itemType.showDuration, itemType.showCharges, itemType.showAttributes, itemType.replaceable, itemType.pickupable, itemType.rotatable, itemType.wrapable, itemType.wrapContainer,
+			itemType.multiUse, itemType.moveable, itemType.canReadText, itemType.canWriteText, itemType.isVertical, itemType.isHorizontal, itemType.isHangable, itemType.allowDistRead,
+			itemType.lookThrough, itemType.stopTime, itemType.showCount, itemType.stackable, itemType.isPodium, itemType.isCorpse, itemType.loaded, itemType.spellbook, itemType.isWrapKit
+		);
+	}
+
+	template <typename ItemTypeRef>
+	auto snapshotStrings(ItemTypeRef &itemType) {
+		return std::tie(itemType.name, itemType.article, itemType.pluralName, itemType.description, itemType.runeSpellName, itemType.vocationString, itemType.m_primaryType);
+	}
+}
+
+// Abilities has no pointers, it is stored as a single block
+static_assert(std::is_trivially_copyable_v<Abilities>);
+
+void Items::serialize(PropWriteStream &propWriteStream) const {
+	propWriteStream.write<uint32_t>(static_cast<uint32_t>(items.size()));
+	for (const ItemType &itemType : items) {
+		std::apply([&propWriteStream](const auto &... fields) { (propWriteStream.write(fields), ...); }, snapshotFields(itemType));
+		std::apply([&propWriteStream](const auto &... strings) { (propWriteStream.writeString(strings), ...); }, snapshotStrings(itemType));
+
+		propWriteStream.write<uint8_t>(itemType.abilities != nullptr);
+		if (itemType.abilities) {
+			propWriteStream.write<Abilities>(*itemType.abilities);
+		}
+
+		// Field conditions are rebuilt the same way ItemParse::parseField creates them
+		propWriteStream.write<uint8_t>(itemType.conditionDamage != nullptr);
+		if (itemType.conditionDamage) {
+			const auto &damageList = itemType.conditionDamage->getDamageList();
+			propWriteStream.write<ConditionId_t>(itemType.conditionDamage->getId());
+			propWriteStream.write<ConditionType_t>(itemType.conditionDamage->getType());
+			propWriteStream.write<uint32_t>(static_cast<uint32_t>(damageList.size()));
+			for (const IntervalInfo &intervalInfo : damageList) {
+				propWriteStream.write<int32_t>(intervalInfo.interval);
+				propWriteStream.write<int32_t>(intervalInfo.value);
+			}
+		}
+
+		propWriteStream.write<uint8_t>(static_cast<uint8_t>(itemType.imbuementTypes.size()));
+		for (const auto &[imbuementType, maxTier] : itemType.imbuementTypes) {
+			propWriteStream.write<ImbuementTypes_t>(imbuementType);
+			propWriteStream.write<uint16_t>(maxTier);
+		}
+	}
+
+	propWriteStream.write<uint32_t>(static_cast<uint32_t>(ladders.size()));
+	for (uint16_t ladderId : ladders) {
+		propWriteStream.write<uint16_t>(ladderId);
+	}
+
+	propWriteStream.write<uint32_t>(static_cast<uint32_t>(dummys.size()));
+	for (const auto &[dummyId, rate] : dummys) {
+		propWriteStream.write<uint16_t>(dummyId);
+		propWriteStream.write<uint16_t>(rate);
+	}
+
+	propWriteStream.write<uint32_t>(static_cast<uint32_t>(nameToItems.size()));
+	for (const auto &[name, id] : nameToItems) {
+		propWriteStream.writeString(name);
+		propWriteStream.write<uint16_t>(id);
+	}
+}
+
+bool Items::unserialize(PropStream &propStream) {
+	clear();
+
+	uint32_t count;
+	if (!propStream.read<uint32_t>(count)) {
+		return false;
+	}
+
+	items.resize(count);
+	for (ItemType &itemType : items) {
+		if (!std::apply([&propStream](auto &... fields) { return (propStream.read(fields) && ...); }, snapshotFields(itemType))) {
+			return false;
+		}
+		if (!std::apply([&propStream](auto &... strings) { return (propStream.readString(strings) && ...); }, snapshotStrings(itemType))) {
+			return false;
+		}
+
+		uint8_t hasAbilities;
+		if (!propStream.read<uint8_t>(hasAbilities)) {
+			return false;
+		}
+		if (hasAbilities && !propStream.read<Abilities>(itemType.getAbilities())) {
+			return false;
+		}
+
+		uint8_t hasConditionDamage;
+		if (!propStream.read<uint8_t>(hasConditionDamage)) {
+			return false;
+		}
+		if (hasConditionDamage) {
+			ConditionId_t conditionId;
+			ConditionType_t conditionType;
+			uint32_t damageCount;
+			if (!propStream.read<ConditionId_t>(conditionId) || !propStream.read<ConditionType_t>(conditionType) || !propStream.read<uint32_t>(damageCount)) {
+				return false;
+			}
+
+			const auto conditionDamage = std::make_shared<ConditionDamage>(conditionId, conditionType);
+			for (uint32_t i = 0; i < damageCount; ++i) {
+				int32_t interval, value;
+				if (!propStream.read<int32_t>(interval) || !propStream.read<int32_t>(value)) {
+					return false;
+				}
+				conditionDamage->addDamage(1, interval, value);
+			}
+
+			conditionDamage->setParam(CONDITION_PARAM_FIELD, 1);
+			if (conditionDamage->getTotalDamage() > 0) {
+				conditionDamage->setParam(CONDITION_PARAM_FORCEUPDATE, 1);
+			}
+			itemType.conditionDamage = conditionDamage;
+		}
+
+		uint8_t imbuementCount;
+		if (!propStream.read<uint8_t>(imbuementCount)) {
+			return false;
+		}
+		for (uint8_t i = 0; i < imbuementCount; ++i) {
+			ImbuementTypes_t imbuementType;
+			uint16_t maxTier;
+			if (!propStream.read<ImbuementTypes_t>(imbuementType) || !propStream.read<uint16_t>(maxTier)) {
+				return false;
+			}
+			itemType.imbuementTypes[imbuementType] = maxTier;
+		}
+	}
+
+	if (!propStream.read<uint32_t>(count)) {
+		return false;
+	}
+	ladders.reserve(count);
+	for (uint32_t i = 0; i < count; ++i) {
+		uint16_t ladderId;
+		if (!propStream.read<uint16_t>(ladderId)) {
+			return false;
+		}
+		ladders.push_back(ladderId);
+	}
+
+	if (!propStream.read<uint32_t>(count)) {
+		return false;
+	}
+	for (uint32_t i = 0; i < count; ++i) {
+		uint16_t dummyId, rate;
+		if (!propStream.read<uint16_t>(dummyId) || !propStream.read<uint16_t>(rate)) {
+			return false;
+		}
+		dummys[dummyId] = rate;
+	}
+
+	if (!propStream.read<uint32_t>(count)) {
+		return false;
+	}
+	nameToItems.reserve(count);
+	for (uint32_t i = 0; i < count; ++i) {
+		std::string name;
+		uint16_t id;
+		if (!propStream.readString(name) || !propStream.read<uint16_t>(id)) {
+			return false;
+		}
+		nameToItems.emplace(std::move(name), id);
+	}
+	return true;
+}
+
 void Items::buildInventoryList() {
 	inventory.reserve(items.size());
 	for (const auto &type : items) {
@@ -101,6 +101,8 @@ private:
 };
 
 class ConditionDamage;
+class PropStream;
+class PropWriteStream;
 
 class ItemType {
 public:
@@ -382,6 +384,10 @@ public:
 	bool loadFromXml();
 	void parseItemNode(const pugi::xml_node &itemNode, uint16_t id);
 
+	// Item types as left by loadFromProtobuf and loadFromXml, used by the items snapshot
+	void serialize(PropWriteStream &propWriteStream) const;
+	bool unserialize(PropStream &propStream);
+
 	void buildInventoryList();
 	const InventoryVector &getInventory() const {
 		return inventory;
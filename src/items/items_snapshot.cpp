@@ -0,0 +1,181 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2022 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include "items/items_snapshot.hpp"
+#include "config/configmanager.hpp"
+#include "game/game.hpp"
+#include "io/fileloader.hpp"
+#include "items/item.hpp"
+
+namespace {
+	constexpr uint32_t SNAPSHOT_MAGIC = 0x50534943; // "CISP"
+	// Bump whenever Items::serialize changes what it writes
+	constexpr uint32_t SNAPSHOT_VERSION = 2;
+
+	constexpr uint64_t FNV_OFFSET = 0xcbf29ce484222325ULL;
+
+	uint64_t fnv1a(std::string_view bytes, uint64_t hash = FNV_OFFSET) {
+		for (char byte : bytes) {
+			hash ^= static_cast<uint8_t>(byte);
+			hash *= 0x100000001b3ULL;
+		}
+		return hash;
+	}
+
+	void writeIds(PropWriteStream &propWriteStream, const std::vector<uint16_t> &ids) {
+		propWriteStream.write<uint32_t>(static_cast<uint32_t>(ids.size()));
+		for (uint16_t id : ids) {
+			propWriteStream.write<uint16_t>(id);
+		}
+	}
+
+	bool readIds(PropStream &propStream, std::vector<uint16_t> &ids) {
+		uint32_t count;
+		if (!propStream.read<uint32_t>(count) || propStream.size() < count * sizeof(uint16_t)) {
+			return false;
+		}
+
+		ids.resize(count);
+		for (uint16_t &id : ids) {
+			propStream.read<uint16_t>(id);
+		}
+		return true;
+	}
+}
+
+ItemsSnapshot::ItemsSnapshot(std::string itemsFolder) :
+	appearancesFile(itemsFolder + "/appearances.dat"),
+	itemsFile(itemsFolder + "/items.xml"),
+	snapshotFile(itemsFolder + "/items.snapshot") { }
+
+bool ItemsSnapshot::hashFile(const std::string &file, uint64_t &hash) {
+	std::error_code error;
+	mio::mmap_source source;
+	source.map(file, error);
+	if (error) {
+		// Empty files can't be mapped, they still have a hash
+		if (!std::filesystem::exists(file)) {
+			return false;
+		}
+		hash = 0;
+		return true;
+	}
+
+	hash = fnv1a({ source.data(), source.size() });
+	return true;
+}
+
+uint64_t ItemsSnapshot::hashBuild() {
+	uint64_t hash = fnv1a(__DATE__ " " __TIME__);
+#if defined(GIT_RETRIEVED_STATE) && GIT_RETRIEVED_STATE
+	hash = fnv1a(GIT_HEAD_SHA1, hash);
+#endif
+
+	// The executable is relinked by every build, even when only the item loaders changed and this file
+	// was not recompiled. Outside Linux it isn't looked up and only the date of this file counts
+	std::error_code error;
+	const auto executable = std::filesystem::read_symlink("/proc/self/exe", error);
+	if (error) {
+		return hash;
+	}
+	const auto size = std::filesystem::file_size(executable, error);
+	const auto writeTime = std::filesystem::last_write_time(executable, error);
+	if (!error) {
+		hash = fnv1a(fmt::format("{}:{}", size, writeTime.time_since_epoch().count()), hash);
+	}
+	return hash;
+}
+
+bool ItemsSnapshot::load() {
+	loaded = false;
+
+	Header current {};
+	current.magic = SNAPSHOT_MAGIC;
+	current.version = SNAPSHOT_VERSION;
+	current.buildHash = hashBuild();
+	current.abilitiesSize = sizeof(Abilities);
+	current.oldProtocol = g_configManager().getBoolean(OLD_PROTOCOL);
+	current.registeredAppearances = g_configManager().getBoolean(WARN_UNSAFE_SCRIPTS);
+	if (!hashFile(appearancesFile, current.appearancesHash) || !hashFile(itemsFile, current.itemsHash)) {
+		// Let the regular loaders report the missing file
+		return false;
+	}
+	header = current;
+
+	if (!std::filesystem::exists(snapshotFile)) {
+		g_logger().info("[ItemsSnapshot::load] - No items snapshot, it will be built after loading the item files");
+		return false;
+	}
+
+	std::error_code error;
+	mio::mmap_source source;
+	source.map(snapshotFile, error);
+	if (error) {
+		g_logger().warn("[ItemsSnapshot::load] - Failed to map {}: {}", snapshotFile, error.message());
+		return false;
+	}
+
+	PropStream propStream;
+	propStream.init(source.data(), source.size());
+
+	Header stored;
+	if (!propStream.read<Header>(stored) || stored != current) {
+		g_logger().info("[ItemsSnapshot::load] - Item files or server build changed since the items snapshot was built, it will be rebuilt");
+		return false;
+	}
+
+	std::vector<uint16_t> magicEffects, distanceEffects, lookTypes;
+	if (!Item::items.unserialize(propStream) || !readIds(propStream, magicEffects) || !readIds(propStream, distanceEffects) || !readIds(propStream, lookTypes)) {
+		g_logger().warn("[ItemsSnapshot::load] - Items snapshot {} is corrupted, it will be rebuilt", snapshotFile);
+		Item::items.clear();
+		return false;
+	}
+
+	g_game().setRegisteredAppearances(std::move(magicEffects), std::move(distanceEffects), std::move(lookTypes));
+	loaded = true;
+	return true;
+}
+
+bool ItemsSnapshot::save() const {
+	if (!header) {
+		return false;
+	}
+
+	PropWriteStream propWriteStream;
+	propWriteStream.write<Header>(*header);
+	Item::items.serialize(propWriteStream);
+	writeIds(propWriteStream, g_game().getRegisteredMagicEffects());
+	writeIds(propWriteStream, g_game().getRegisteredDistanceEffects());
+	writeIds(propWriteStream, g_game().getRegisteredLookTypes());
+
+	size_t size;
+	const char* data = propWriteStream.getStream(size);
+
+	// Written aside and renamed, a server stopped halfway never leaves a truncated snapshot behind
+	const std::string temporaryFile = snapshotFile + ".tmp";
+	std::ofstream file(temporaryFile, std::ios::binary | std::ios::trunc);
+	file.write(data, static_cast<std::streamsize>(size));
+	file.close();
+	if (!file) {
+		g_logger().warn("[ItemsSnapshot::save] - Failed to write {}", temporaryFile);
+		return false;
+	}
+
+	std::error_code error;
+	std::filesystem::rename(temporaryFile, snapshotFile, error);
+	if (error) {
+		g_logger().warn("[ItemsSnapshot::save] - Failed to replace {}: {}", snapshotFile, error.message());
+		return false;
+	}
+
+	g_logger().debug("[ItemsSnapshot::save] - Wrote items snapshot {} ({} bytes)", snapshotFile, size);
+	return true;
+}
@@ -0,0 +1,56 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2022 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+/**
+ * Compiled copy of the item types built from appearances.dat and items.xml.
+ * The file is keyed by the hash of both sources, of the options changing what
+ * the loaders keep and of the server build, a snapshot that doesn't match is
+ * ignored and rebuilt after the sources are parsed again.
+ */
+class ItemsSnapshot {
+public:
+	// Files are looked up in the core items folder
+	explicit ItemsSnapshot(std::string itemsFolder);
+
+	// Fills Item::items and the appearances registered in Game, false when the snapshot is missing or outdated
+	bool load();
+	// Writes the item types currently loaded, keyed by the sources hashed by load()
+	bool save() const;
+
+	bool isLoaded() const {
+		return loaded;
+	}
+
+private:
+	struct Header {
+		uint32_t magic;
+		uint32_t version;
+		uint64_t appearancesHash;
+		uint64_t itemsHash;
+		uint64_t buildHash;
+		uint32_t abilitiesSize;
+		uint8_t oldProtocol;
+		uint8_t registeredAppearances;
+
+		bool operator==(const Header &) const = default;
+	};
+
+	static bool hashFile(const std::string &file, uint64_t &hash);
+	// Changes with every build of the server, the serialized layout can't be trusted across them
+	static uint64_t hashBuild();
+
+	std::string appearancesFile;
+	std::string itemsFile;
+	std::string snapshotFile;
+
+	std::optional<Header> header;
+	bool loaded = false;
+};
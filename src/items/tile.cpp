@@ -956,6 +956,7 @@ void Tile::addThing(int32_t, std::shared_ptr<Thing> thing) {
 			return /*RETURNVALUE_NOTPOSSIBLE*/;
 		}
 
+		invalidateItemsEncoding();
 		item->setParent(static_self_cast<Tile>());
 
 		const ItemType &itemType = Item::items[item->getID()];
@@ -1054,6 +1055,7 @@ void Tile::updateThing(std::shared_ptr<Thing> thing, uint16_t itemId, uint32_t c
 
 	const ItemType &oldType = Item::items[item->getID()];
 	const ItemType &newType = Item::items[itemId];
+	invalidateItemsEncoding();
 	resetTileFlags(item);
 	item->setID(itemId);
 	item->setSubType(count);
@@ -1119,6 +1121,7 @@ void Tile::replaceThing(uint32_t index, std::shared_ptr<Thing> thing) {
 	}
 
 	if (isInserted) {
+		invalidateItemsEncoding();
 		item->setParent(static_self_cast<Tile>());
 
 		resetTileFlags(oldItem);
@@ -1156,6 +1159,7 @@ void Tile::removeThing(std::shared_ptr<Thing> thing, uint32_t count) {
 		return;
 	}
 
+	invalidateItemsEncoding();
 	if (item == ground) {
 		ground->resetParent();
 		ground = nullptr;
@@ -1538,6 +1542,7 @@ void Tile::internalAddThing(uint32_t, std::shared_ptr<Thing> thing) {
 			return;
 		}
 
+		invalidateItemsEncoding();
 		const ItemType &itemType = Item::items[item->getID()];
 		if (itemType.isGroundTile()) {
 			if (ground == nullptr) {
@@ -1575,6 +1580,7 @@ void Tile::internalAddThing(uint32_t, std::shared_ptr<Thing> thing) {
 }
 
 void Tile::updateTileFlags(std::shared_ptr<Item> item) {
+	invalidateItemsEncoding();
 	resetTileFlags(item);
 	setTileFlags(item);
 }
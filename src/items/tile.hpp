@@ -99,6 +99,27 @@ private:
 	uint32_t downItemCount = 0;
 };
 
+/**
+ * Client bytes of the ground and items of a tile, as written by ProtocolGame::AddItem.
+ * They don't depend on the viewer, so every player describing the tile splices the same bytes;
+ * creatures are always encoded per player.
+ */
+struct TileItemsEncoding {
+	// Tile items version the bytes were encoded from, 0 means they must be encoded again
+	uint32_t version = 0;
+	// Encoded ground + top items, followed by the encoded down items
+	uint8_t topCount = 0;
+	uint8_t downCount = 0;
+	// End offset of each encoded item inside bytes
+	std::vector<uint16_t> offsets;
+	std::vector<uint8_t> bytes;
+};
+
+// Tiles are allocated from this pool, see makePooled
+struct TilePool {
+	static constexpr std::string_view name = "tiles";
+};
+
 class Tile : public Cylinder, public SharedObject {
 public:
 	static const std::shared_ptr<Tile> &nullptr_tile;
@@ -246,6 +267,23 @@ public:
 	}
 	void setGround(std::shared_ptr<Item> item) {
 		ground = item;
+		invalidateItemsEncoding();
+	}
+
+	uint32_t getItemsVersion() const {
+		return itemsVersion;
+	}
+	// Must be called whenever the client visible state of the ground or items changes
+	void invalidateItemsEncoding() {
+		if (++itemsVersion == 0) {
+			itemsVersion = 1;
+		}
+	}
+	TileItemsEncoding &getItemsEncoding(bool oldProtocol) {
+		if (!itemsEncoding) {
+			itemsEncoding = std::make_unique<std::array<TileItemsEncoding, 2>>();
+		}
+		return (*itemsEncoding)[oldProtocol ? 1 : 0];
 	}
 
 private:
@@ -263,7 +301,10 @@ protected:
 	std::shared_ptr<Item> ground = nullptr;
 	Position tilePos;
 	uint32_t flags = 0;
+	uint32_t itemsVersion = 1;
 	phmap::flat_hash_set<std::shared_ptr<Zone>> zones;
+	// Allocated on the first description, one entry per client protocol
+	std::unique_ptr<std::array<TileItemsEncoding, 2>> itemsEncoding;
 };
 
 // Used for walkable tiles, where there is high likeliness of
@@ -333,8 +333,7 @@ bool Weapon::executeUseWeapon(std::shared_ptr<Player> player, const LuaVariant &
 	lua_State* L = getScriptInterface()->getLuaState();
 
 	getScriptInterface()->pushFunction(getScriptId());
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 	getScriptInterface()->pushVariant(L, var);
 
 	return getScriptInterface()->callFunction(2);
@@ -226,6 +226,9 @@ public:
 	std::string getScriptTypeName() const override {
 		return "onUseWeapon";
 	}
+	std::string getEventKind() const override {
+		return "weapon";
+	}
 
 	void configureWeapon(const ItemType &it) override;
 
@@ -251,6 +254,9 @@ public:
 	std::string getScriptTypeName() const override {
 		return "onUseWeapon";
 	}
+	std::string getEventKind() const override {
+		return "weapon";
+	}
 
 	void configureWeapon(const ItemType &it) override;
 	bool interruptSwing() const override {
@@ -280,6 +286,9 @@ public:
 	std::string getScriptTypeName() const override {
 		return "onUseWeapon";
 	}
+	std::string getEventKind() const override {
+		return "weapon";
+	}
 
 	void configureWeapon(const ItemType &it) override;
 
@@ -0,0 +1,101 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2022 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include "lib/logging/log_queue.hpp"
+
+LogQueue::LogQueue(size_t capacity, bool dropOnOverflow, Writer writer, DropReporter dropReporter) :
+	dropOnOverflow(dropOnOverflow),
+	writer(std::move(writer)),
+	dropReporter(std::move(dropReporter)),
+	entries(std::max<size_t>(capacity, 1)) {
+	thread = std::thread([this] { run(); });
+}
+
+LogQueue::~LogQueue() {
+	{
+		std::scoped_lock lock(mutex);
+		stopping = true;
+	}
+	notEmpty.notify_one();
+	notFull.notify_all();
+	thread.join();
+}
+
+bool LogQueue::push(int level, std::string message) {
+	std::unique_lock lock(mutex);
+	if (count == entries.size() && !dropOnOverflow) {
+		notFull.wait(lock, [this] { return count < entries.size() || stopping; });
+	}
+	if (count == entries.size() || stopping) {
+		dropped.fetch_add(1, std::memory_order_relaxed);
+		droppedTotal.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	auto &entry = entries[(head + count) % entries.size()];
+	entry.level = level;
+	entry.message = std::move(message);
+	++count;
+
+	lock.unlock();
+	notEmpty.notify_one();
+	return true;
+}
+
+void LogQueue::flush() {
+	std::unique_lock lock(mutex);
+	drained.wait(lock, [this] { return (count == 0 && !writing) || stopping; });
+}
+
+void LogQueue::run() {
+	std::vector<Entry> batch;
+	batch.reserve(entries.size());
+
+	std::unique_lock lock(mutex);
+	while (true) {
+		notEmpty.wait(lock, [this] { return count > 0 || stopping; });
+		if (count == 0) {
+			// Stopping with nothing left to write
+			break;
+		}
+
+		// The whole buffer is taken at once, callers get their room back before the slow writes
+		for (; count > 0; --count) {
+			batch.emplace_back(std::move(entries[head]));
+			head = (head + 1) % entries.size();
+		}
+		writing = true;
+		lock.unlock();
+		notFull.notify_all();
+
+		for (const auto &[level, message] : batch) {
+			writer(level, message);
+		}
+		batch.clear();
+		reportDropped();
+
+		lock.lock();
+		writing = false;
+		if (count == 0) {
+			drained.notify_all();
+		}
+	}
+	lock.unlock();
+	reportDropped();
+	drained.notify_all();
+}
+
+void LogQueue::reportDropped() {
+	if (!dropReporter || dropped.load(std::memory_order_relaxed) == 0) {
+		return;
+	}
+	dropReporter(dropped.exchange(0, std::memory_order_relaxed));
+}
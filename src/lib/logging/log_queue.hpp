@@ -0,0 +1,68 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2022 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+/**
+ * Bounded ring buffer of formatted messages written by a thread of its own, so the
+ * threads that log never wait on the terminal or the disk. When the buffer is full the
+ * caller either waits for room or the message is dropped and counted.
+ */
+class LogQueue {
+public:
+	using Writer = std::function<void(int level, std::string_view message)>;
+	// Called by the writing thread with the messages dropped while it was busy
+	using DropReporter = std::function<void(uint64_t dropped)>;
+
+	LogQueue(size_t capacity, bool dropOnOverflow, Writer writer, DropReporter dropReporter = nullptr);
+	// Writes what is still queued before returning
+	~LogQueue();
+
+	LogQueue(const LogQueue &) = delete;
+	LogQueue &operator=(const LogQueue &) = delete;
+
+	// False when the message was dropped
+	bool push(int level, std::string message);
+	// Waits until every message queued so far is written
+	void flush();
+	// Messages dropped since the queue was created
+	uint64_t getDroppedCount() const {
+		return droppedTotal.load(std::memory_order_relaxed);
+	}
+
+private:
+	struct Entry {
+		int level = 0;
+		std::string message;
+	};
+
+	void run();
+	void reportDropped();
+
+	const bool dropOnOverflow;
+	const Writer writer;
+	const DropReporter dropReporter;
+
+	std::mutex mutex;
+	std::condition_variable notEmpty;
+	std::condition_variable notFull;
+	std::condition_variable drained;
+
+	std::vector<Entry> entries;
+	size_t head = 0;
+	size_t count = 0;
+	bool writing = false;
+	bool stopping = false;
+
+	// Dropped since the last report, and since the start
+	std::atomic<uint64_t> dropped = 0;
+	std::atomic<uint64_t> droppedTotal = 0;
+
+	std::thread thread;
+};
@@ -0,0 +1,43 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2022 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include "lib/logging/log_rate_limiter.hpp"
+
+void LogRateLimiter::setLimit(uint32_t messagesPerSecond) {
+	limit.store(messagesPerSecond, std::memory_order_relaxed);
+}
+
+bool LogRateLimiter::allow(const void* site, uint64_t &suppressed, std::chrono::steady_clock::time_point now) {
+	const uint32_t messagesPerSecond = limit.load(std::memory_order_relaxed);
+	if (messagesPerSecond == 0) {
+		return true;
+	}
+
+	std::scoped_lock lock(mutex);
+	if (sites.size() >= MAX_SITES && !sites.contains(site)) {
+		sites.clear();
+	}
+
+	auto &[windowStart, count, held] = sites[site];
+	if (now - windowStart >= std::chrono::seconds(1)) {
+		windowStart = now;
+		count = 0;
+	}
+
+	if (count >= messagesPerSecond) {
+		++held;
+		return false;
+	}
+
+	++count;
+	suppressed = std::exchange(held, 0);
+	return true;
+}
@@ -0,0 +1,41 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2022 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+/**
+ * Caps how many messages each call site may log per second. A site is told how many
+ * of its messages were held back the next time one gets through, so a message spammed
+ * by a misbehaving script shows up once per second with a count instead of thousands
+ * of times.
+ */
+class LogRateLimiter {
+public:
+	// 0 lets every message through
+	void setLimit(uint32_t messagesPerSecond);
+
+	// Whether one more message of the site fits in its current second. When it does,
+	// suppressed is set to the messages of the site held back since the last one
+	bool allow(const void* site, uint64_t &suppressed, std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+
+private:
+	// Sites are format strings, the table only grows this big with runtime built formats
+	static constexpr size_t MAX_SITES = 4096;
+
+	struct Site {
+		std::chrono::steady_clock::time_point windowStart;
+		uint32_t count = 0;
+		uint64_t suppressed = 0;
+	};
+
+	std::atomic<uint32_t> limit = 0;
+
+	std::mutex mutex;
+	phmap::flat_hash_map<const void*, Site> sites;
+};
@@ -20,6 +20,11 @@ LogWithSpdLog::LogWithSpdLog() {
 #endif
 }
 
+LogWithSpdLog::~LogWithSpdLog() {
+	// Writes whatever is still queued
+	queue.reset();
+}
+
 Logger &LogWithSpdLog::getInstance() {
 	return inject<Logger>();
 }
@@ -35,6 +40,58 @@ std::string LogWithSpdLog::getLevel() const {
 	return std::string { level.begin(), level.end() };
 }
 
+void LogWithSpdLog::setAsync(size_t queueSize, bool dropOnOverflow) {
+	if (queue || queueSize == 0) {
+		return;
+	}
+
+	queue = std::make_unique<LogQueue>(
+		queueSize, dropOnOverflow,
+		[](int level, std::string_view message) {
+			spdlog::log(static_cast<spdlog::level::level_enum>(level), message);
+		},
+		[](uint64_t dropped) {
+			spdlog::warn("[LogWithSpdLog] - Log queue was full, {} messages dropped", dropped);
+		}
+	);
+	debug("Logging through a queue of {} messages, {} when full.", queueSize, dropOnOverflow ? "dropping" : "blocking");
+}
+
+uint64_t LogWithSpdLog::getDroppedMessages() const {
+	return queue ? queue->getDroppedCount() : 0;
+}
+
+void LogWithSpdLog::setRateLimit(uint32_t messagesPerSecond) {
+	rateLimiter.setLimit(messagesPerSecond);
+}
+
+bool LogWithSpdLog::shouldLog(const std::string &lvl, const void* site, uint64_t &suppressed) {
+	const auto level = spdlog::level::from_str(lvl);
+	if (!spdlog::default_logger_raw()->should_log(level)) {
+		return false;
+	}
+	// Critical messages usually come right before the server goes down, they are never held back
+	return level == spdlog::level::critical || rateLimiter.allow(site, suppressed);
+}
+
 void LogWithSpdLog::log(const std::string lvl, const fmt::basic_string_view<char> msg) const {
-	spdlog::log(spdlog::level::from_str(lvl), msg);
+	const auto level = spdlog::level::from_str(lvl);
+	if (!spdlog::default_logger_raw()->should_log(level)) {
+		return;
+	}
+
+	if (!queue) {
+		spdlog::log(level, msg);
+		return;
+	}
+
+	if (level == spdlog::level::critical) {
+		// Written before returning, after everything logged ahead of it
+		queue->flush();
+		spdlog::log(level, msg);
+		spdlog::default_logger_raw()->flush();
+		return;
+	}
+
+	queue->push(static_cast<int>(level), std::string(msg.data(), msg.size()));
 }
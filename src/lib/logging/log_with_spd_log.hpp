@@ -9,18 +9,30 @@
 #pragma once
 
 #include "lib/logging/logger.hpp"
+#include "lib/logging/log_queue.hpp"
+#include "lib/logging/log_rate_limiter.hpp"
 
 class LogWithSpdLog final : public Logger {
 public:
 	LogWithSpdLog();
-	~LogWithSpdLog() override = default;
+	~LogWithSpdLog() override;
 
 	static Logger &getInstance();
 
 	void setLevel(const std::string &name) override;
 	[[nodiscard]] std::string getLevel() const override;
 
+	void setAsync(size_t queueSize, bool dropOnOverflow) override;
+	[[nodiscard]] uint64_t getDroppedMessages() const override;
+	void setRateLimit(uint32_t messagesPerSecond) override;
+	bool shouldLog(const std::string &lvl, const void* site, uint64_t &suppressed) override;
+
 	void log(std::string lvl, fmt::basic_string_view<char> msg) const override;
+
+private:
+	// Set once at startup, messages are written by the caller until then
+	std::unique_ptr<LogQueue> queue;
+	LogRateLimiter rateLimiter;
 };
 
 constexpr auto g_logger = LogWithSpdLog::getInstance;
@@ -46,34 +46,49 @@ public:
 	[[nodiscard]] virtual std::string getLevel() const = 0;
 	virtual void log(std::string lvl, fmt::basic_string_view<char> msg) const = 0;
 
+	// Hands messages to a background thread through a queue of queueSize messages, when it is
+	// full the caller waits or the message is dropped. Loggers without a queue ignore it
+	virtual void setAsync(size_t /*queueSize*/, bool /*dropOnOverflow*/) { }
+	// Messages the queue dropped so far, loggers without a queue never drop
+	[[nodiscard]] virtual uint64_t getDroppedMessages() const {
+		return 0;
+	}
+	// Messages per second let through from each call site, 0 for no limit
+	virtual void setRateLimit(uint32_t /*messagesPerSecond*/) { }
+	// Lets the logger skip a message before it is formatted. The site is the format string of the
+	// call, suppressed is set to how many messages of the site were skipped since the last one
+	virtual bool shouldLog(const std::string & /*lvl*/, const void* /*site*/, uint64_t & /*suppressed*/) {
+		return true;
+	}
+
 	template <typename... Args>
 	void trace(const fmt::format_string<Args...> &fmt, Args &&... args) {
-		trace(fmt::format(fmt, std::forward<Args>(args)...));
+		logFormatted(LOG_LEVEL_TRACE, fmt, std::forward<Args>(args)...);
 	}
 
 	template <typename... Args>
 	void debug(const fmt::format_string<Args...> &fmt, Args &&... args) {
-		debug(fmt::format(fmt, std::forward<Args>(args)...));
+		logFormatted(LOG_LEVEL_DEBUG, fmt, std::forward<Args>(args)...);
 	}
 
 	template <typename... Args>
 	void info(fmt::format_string<Args...> fmt, Args &&... args) {
-		info(fmt::format(fmt, std::forward<Args>(args)...));
+		logFormatted(LOG_LEVEL_INFO, fmt, std::forward<Args>(args)...);
 	}
 
 	template <typename... Args>
 	void warn(const fmt::format_string<Args...> &fmt, Args &&... args) {
-		warn(fmt::format(fmt, std::forward<Args>(args)...));
+		logFormatted(LOG_LEVEL_WARNING, fmt, std::forward<Args>(args)...);
 	}
 
 	template <typename... Args>
 	void error(const fmt::format_string<Args...> fmt, Args &&... args) {
-		error(fmt::format(fmt, std::forward<Args>(args)...));
+		logFormatted(LOG_LEVEL_ERROR, fmt, std::forward<Args>(args)...);
 	}
 
 	template <typename... Args>
 	void critical(const fmt::format_string<Args...> fmt, Args &&... args) {
-		critical(fmt::format(fmt, std::forward<Args>(args)...));
+		logFormatted(LOG_LEVEL_CRITICAL, fmt, std::forward<Args>(args)...);
 	}
 
 	template <typename T>
@@ -105,4 +120,19 @@ public:
 	void critical(const T &msg) {
 		log(LOG_LEVEL_CRITICAL, msg);
 	}
+
+private:
+	template <typename... Args>
+	void logFormatted(const std::string &lvl, const fmt::format_string<Args...> &fmt, Args &&... args) {
+		uint64_t suppressed = 0;
+		if (!shouldLog(lvl, fmt::string_view(fmt).data(), suppressed)) {
+			return;
+		}
+
+		auto message = fmt::format(fmt, std::forward<Args>(args)...);
+		if (suppressed > 0) {
+			fmt::format_to(std::back_inserter(message), " ({} similar messages suppressed)", suppressed);
+		}
+		log(lvl, message);
+	}
 };
@@ -0,0 +1,93 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2022 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include "lib/memory/pool_allocator.hpp"
+#include "lib/metrics/metrics.hpp"
+
+namespace {
+	constexpr size_t CHUNK_SIZE = 64 * 1024;
+
+	size_t roundBlockSize(size_t size) {
+		const size_t blockSize = std::max(size, sizeof(void*));
+		return (blockSize + PoolArena::BLOCK_ALIGNMENT - 1) & ~(PoolArena::BLOCK_ALIGNMENT - 1);
+	}
+}
+
+namespace {
+	struct Arenas {
+		std::mutex mutex;
+		phmap::flat_hash_map<std::string, std::unique_ptr<PoolArena>> byName;
+	};
+
+	// Never destroyed: objects released while the process exits still free into their arena
+	Arenas &arenas() {
+		static auto &instance = *new Arenas();
+		return instance;
+	}
+}
+
+PoolArena &PoolArena::get(std::string_view pool, size_t size) {
+	const size_t blockSize = roundBlockSize(size);
+	auto &[mutex, byName] = arenas();
+	std::scoped_lock lock(mutex);
+	auto &arena = byName[fmt::format("{}:{}", pool, blockSize)];
+	if (!arena) {
+		arena.reset(new PoolArena(pool, blockSize));
+	}
+	return *arena;
+}
+
+void PoolArena::exportMetrics(Metrics &metrics) {
+	auto &[mutex, byName] = arenas();
+	std::scoped_lock lock(mutex);
+	for (const auto &[name, arena] : byName) {
+		const Metrics::Labels labels { { "pool", arena->pool }, { "size", std::to_string(arena->blockSize) } };
+		metrics.counter("canary_pool_allocations_total", "Objects allocated from a memory pool", labels).set(arena->allocations.load(std::memory_order_relaxed));
+		metrics.gauge("canary_pool_blocks", "Memory pool blocks holding a live object", labels).set(arena->blocksInUse.load(std::memory_order_relaxed));
+		metrics.gauge("canary_pool_reserved_bytes", "Bytes of the chunks reserved by a memory pool", labels).set(arena->reservedBytes.load(std::memory_order_relaxed));
+	}
+}
+
+PoolArena::PoolArena(std::string_view pool, size_t blockSize) :
+	pool(pool),
+	blockSize(blockSize),
+	blocksPerChunk(std::max<size_t>(CHUNK_SIZE / blockSize, 1)) { }
+
+void* PoolArena::allocate() {
+	allocations.fetch_add(1, std::memory_order_relaxed);
+	blocksInUse.fetch_add(1, std::memory_order_relaxed);
+
+	std::scoped_lock lock(mutex);
+	if (!freeBlocks) {
+		auto &chunk = chunks.emplace_back(new std::byte[blockSize * blocksPerChunk]);
+		reservedBytes.fetch_add(static_cast<int64_t>(blockSize * blocksPerChunk), std::memory_order_relaxed);
+
+		// Linked back to front, so the blocks of a chunk are handed out in address order
+		for (size_t i = blocksPerChunk; i-- > 0;) {
+			auto* block = reinterpret_cast<FreeBlock*>(chunk.get() + i * blockSize);
+			block->next = freeBlocks;
+			freeBlocks = block;
+		}
+	}
+
+	FreeBlock* block = freeBlocks;
+	freeBlocks = block->next;
+	return block;
+}
+
+void PoolArena::deallocate(void* block) noexcept {
+	blocksInUse.fetch_sub(1, std::memory_order_relaxed);
+
+	std::scoped_lock lock(mutex);
+	auto* freeBlock = static_cast<FreeBlock*>(block);
+	freeBlock->next = freeBlocks;
+	freeBlocks = freeBlock;
+}
@@ -0,0 +1,104 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2022 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+class Metrics;
+
+/**
+ * Fixed size blocks carved out of large chunks, one arena per pool and block size.
+ * Freed blocks go back to the free list of their arena and are reused by the next
+ * object of the same size, so objects that are created and destroyed all the time
+ * neither go through the general heap nor leave it fragmented. Arenas and their
+ * chunks are kept for the lifetime of the process, so their usage is counted here
+ * and copied to the metrics registry, which is gone before the last objects are freed.
+ */
+class PoolArena {
+public:
+	static constexpr size_t BLOCK_ALIGNMENT = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+	static constexpr size_t MAX_BLOCK_SIZE = 1024;
+
+	// The arena of the pool for blocks of at least size bytes, created on first use
+	static PoolArena &get(std::string_view pool, size_t size);
+	// Publishes the usage of every arena into the registry
+	static void exportMetrics(Metrics &metrics);
+
+	PoolArena(const PoolArena &) = delete;
+	PoolArena &operator=(const PoolArena &) = delete;
+
+	void* allocate();
+	void deallocate(void* block) noexcept;
+
+private:
+	PoolArena(std::string_view pool, size_t blockSize);
+
+	struct FreeBlock {
+		FreeBlock* next;
+	};
+
+	const std::string pool;
+	const size_t blockSize;
+	const size_t blocksPerChunk;
+
+	std::mutex mutex;
+	FreeBlock* freeBlocks = nullptr;
+	std::vector<std::unique_ptr<std::byte[]>> chunks;
+
+	std::atomic<uint64_t> allocations = 0;
+	std::atomic<int64_t> blocksInUse = 0;
+	std::atomic<int64_t> reservedBytes = 0;
+};
+
+/**
+ * Allocator for std::allocate_shared that takes single objects from the arenas of
+ * the Tag pool. The shared_ptr control block is allocated together with the object,
+ * so both come from one block. Tag must have a static name.
+ */
+template <typename T, typename Tag>
+class PoolAllocator {
+public:
+	using value_type = T;
+
+	PoolAllocator() noexcept = default;
+	template <typename U>
+	PoolAllocator(const PoolAllocator<U, Tag> &) noexcept { }
+
+	T* allocate(size_t n) {
+		if (n != 1 || !POOLED) {
+			return std::allocator<T>().allocate(n);
+		}
+		return static_cast<T*>(arena().allocate());
+	}
+
+	void deallocate(T* pointer, size_t n) noexcept {
+		if (n != 1 || !POOLED) {
+			std::allocator<T>().deallocate(pointer, n);
+			return;
+		}
+		arena().deallocate(pointer);
+	}
+
+	template <typename U>
+	bool operator==(const PoolAllocator<U, Tag> &) const noexcept {
+		return true;
+	}
+
+private:
+	static constexpr bool POOLED = sizeof(T) <= PoolArena::MAX_BLOCK_SIZE && alignof(T) <= PoolArena::BLOCK_ALIGNMENT;
+
+	static PoolArena &arena() {
+		static PoolArena &typeArena = PoolArena::get(Tag::name, sizeof(T));
+		return typeArena;
+	}
+};
+
+template <typename T, typename Tag, typename... Args>
+std::shared_ptr<T> makePooled(Args &&... args) {
+	return std::allocate_shared<T>(PoolAllocator<T, Tag>(), std::forward<Args>(args)...);
+}
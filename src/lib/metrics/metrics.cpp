@@ -0,0 +1,135 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2022 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include "lib/metrics/metrics.hpp"
+#include "lib/di/container.hpp"
+
+namespace {
+	std::string formatLabels(const Metrics::Labels &labels) {
+		if (labels.empty()) {
+			return {};
+		}
+
+		std::string result = "{";
+		for (const auto &[name, value] : labels) {
+			if (result.size() > 1) {
+				result += ',';
+			}
+			result += name;
+			result += "=\"";
+			for (char c : value) {
+				if (c == '\\' || c == '"') {
+					result += '\\';
+					result += c;
+				} else if (c == '\n') {
+					result += "\\n";
+				} else {
+					result += c;
+				}
+			}
+			result += '"';
+		}
+		result += '}';
+		return result;
+	}
+
+	// Adds the le label of a histogram bucket to the series labels
+	std::string bucketLabels(const std::string &labels, const std::string &bound) {
+		if (labels.empty()) {
+			return fmt::format("{{le=\"{}\"}}", bound);
+		}
+		return fmt::format("{},le=\"{}\"}}", labels.substr(0, labels.size() - 1), bound);
+	}
+}
+
+MetricHistogram::MetricHistogram(std::vector<double> bounds) :
+	bounds(std::move(bounds)), buckets(std::make_unique<std::atomic<uint64_t>[]>(this->bounds.size() + 1)) { }
+
+void MetricHistogram::observe(double value) {
+	const auto bucket = static_cast<size_t>(std::ranges::lower_bound(bounds, value) - bounds.begin());
+	buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+	count.fetch_add(1, std::memory_order_relaxed);
+	sum.fetch_add(value, std::memory_order_relaxed);
+}
+
+const std::vector<double> &Metrics::durationBuckets() {
+	static const std::vector<double> bounds = { 0.0001, 0.00025, 0.0005, 0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1, 2.5, 5, 10 };
+	return bounds;
+}
+
+Metrics &Metrics::getInstance() {
+	return inject<Metrics>();
+}
+
+MetricCounter &Metrics::counter(const std::string &name, const std::string &help, const Labels &labels) {
+	return getOrCreate<MetricCounter>(name, help, Type::Counter, labels);
+}
+
+MetricGauge &Metrics::gauge(const std::string &name, const std::string &help, const Labels &labels) {
+	return getOrCreate<MetricGauge>(name, help, Type::Gauge, labels);
+}
+
+MetricHistogram &Metrics::histogram(const std::string &name, const std::string &help, const std::vector<double> &bounds, const Labels &labels) {
+	return getOrCreate<MetricHistogram>(name, help, Type::Histogram, labels, bounds);
+}
+
+template <typename T, typename... Args>
+T &Metrics::getOrCreate(const std::string &name, const std::string &help, Type type, const Labels &labels, Args &&... args) {
+	std::scoped_lock lock(mutex);
+	auto it = familyIndex.find(name);
+	if (it == familyIndex.end()) {
+		it = familyIndex.emplace(name, families.size()).first;
+		families.push_back({ name, help, type, {} });
+	} else if (families[it->second].type != type) {
+		throw std::invalid_argument(fmt::format("Metric '{}' was already registered with another type", name));
+	}
+
+	Family &family = families[it->second];
+	std::string formattedLabels = formatLabels(labels);
+	for (const auto &series : family.series) {
+		if (series.labels == formattedLabels) {
+			return *std::get<std::unique_ptr<T>>(series.metric);
+		}
+	}
+
+	auto metric = std::make_unique<T>(std::forward<Args>(args)...);
+	T &result = *metric;
+	family.series.push_back({ std::move(formattedLabels), std::move(metric) });
+	return result;
+}
+
+std::string Metrics::serialize() const {
+	static constexpr std::array<std::string_view, 3> typeNames = { "counter", "gauge", "histogram" };
+
+	fmt::memory_buffer out;
+	std::scoped_lock lock(mutex);
+	for (const auto &family : families) {
+		fmt::format_to(std::back_inserter(out), "# HELP {} {}\n# TYPE {} {}\n", family.name, family.help, family.name, typeNames[static_cast<uint8_t>(family.type)]);
+		for (const auto &series : family.series) {
+			if (const auto counter = std::get_if<std::unique_ptr<MetricCounter>>(&series.metric)) {
+				fmt::format_to(std::back_inserter(out), "{}{} {}\n", family.name, series.labels, (*counter)->get());
+			} else if (const auto gauge = std::get_if<std::unique_ptr<MetricGauge>>(&series.metric)) {
+				fmt::format_to(std::back_inserter(out), "{}{} {}\n", family.name, series.labels, (*gauge)->get());
+			} else if (const auto histogram = std::get_if<std::unique_ptr<MetricHistogram>>(&series.metric)) {
+				const auto &bounds = (*histogram)->getBounds();
+				uint64_t cumulative = 0;
+				for (size_t bucket = 0; bucket <= bounds.size(); ++bucket) {
+					cumulative += (*histogram)->getBucketCount(bucket);
+					const std::string bound = bucket < bounds.size() ? fmt::format("{}", bounds[bucket]) : "+Inf";
+					fmt::format_to(std::back_inserter(out), "{}_bucket{} {}\n", family.name, bucketLabels(series.labels, bound), cumulative);
+				}
+				fmt::format_to(std::back_inserter(out), "{}_sum{} {}\n", family.name, series.labels, (*histogram)->getSum());
+				fmt::format_to(std::back_inserter(out), "{}_count{} {}\n", family.name, series.labels, (*histogram)->getCount());
+			}
+		}
+	}
+	return fmt::to_string(out);
+}
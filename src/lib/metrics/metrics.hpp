@@ -0,0 +1,141 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2022 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+class MetricCounter {
+public:
+	void add(uint64_t amount = 1) {
+		value.fetch_add(amount, std::memory_order_relaxed);
+	}
+	// Publishes a total counted somewhere else, it must never go down
+	void set(uint64_t total) {
+		value.store(total, std::memory_order_relaxed);
+	}
+
+	uint64_t get() const {
+		return value.load(std::memory_order_relaxed);
+	}
+
+private:
+	std::atomic<uint64_t> value = 0;
+};
+
+class MetricGauge {
+public:
+	void set(int64_t newValue) {
+		value.store(newValue, std::memory_order_relaxed);
+	}
+	void add(int64_t amount = 1) {
+		value.fetch_add(amount, std::memory_order_relaxed);
+	}
+	void sub(int64_t amount = 1) {
+		value.fetch_sub(amount, std::memory_order_relaxed);
+	}
+
+	int64_t get() const {
+		return value.load(std::memory_order_relaxed);
+	}
+
+private:
+	std::atomic<int64_t> value = 0;
+};
+
+/**
+ * Counts observations into fixed buckets. Observing only touches atomics,
+ * the buckets are cumulated when the metrics are written.
+ */
+class MetricHistogram {
+public:
+	explicit MetricHistogram(std::vector<double> bounds);
+
+	void observe(double value);
+
+	// Seconds elapsed since start, the unit every duration histogram uses
+	void observeSince(std::chrono::steady_clock::time_point start) {
+		observe(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+	}
+
+	const std::vector<double> &getBounds() const {
+		return bounds;
+	}
+	// One count per bound plus the +Inf bucket, not cumulative
+	uint64_t getBucketCount(size_t bucket) const {
+		return buckets[bucket].load(std::memory_order_relaxed);
+	}
+	uint64_t getCount() const {
+		return count.load(std::memory_order_relaxed);
+	}
+	double getSum() const {
+		return sum.load(std::memory_order_relaxed);
+	}
+
+private:
+	const std::vector<double> bounds;
+	std::unique_ptr<std::atomic<uint64_t>[]> buckets;
+	std::atomic<uint64_t> count = 0;
+	std::atomic<double> sum = 0;
+};
+
+/**
+ * Registry of the runtime telemetry, written in the Prometheus text format.
+ * Metrics are registered once, usually into a function local static reference,
+ * and live as long as the registry. Updating them never takes a lock.
+ */
+class Metrics {
+public:
+	using Labels = std::vector<std::pair<std::string, std::string>>;
+
+	// Latency buckets from 100 microseconds to 10 seconds
+	static const std::vector<double> &durationBuckets();
+
+	Metrics() = default;
+
+	// Singleton - ensures we don't accidentally copy it
+	Metrics(const Metrics &) = delete;
+	void operator=(const Metrics &) = delete;
+
+	static Metrics &getInstance();
+
+	// Registering an existing name and labels returns the metric already registered
+	MetricCounter &counter(const std::string &name, const std::string &help, const Labels &labels = {});
+	MetricGauge &gauge(const std::string &name, const std::string &help, const Labels &labels = {});
+	MetricHistogram &histogram(const std::string &name, const std::string &help, const std::vector<double> &bounds, const Labels &labels = {});
+
+	std::string serialize() const;
+
+private:
+	enum class Type : uint8_t {
+		Counter,
+		Gauge,
+		Histogram,
+	};
+
+	struct Series {
+		std::string labels;
+		std::variant<std::unique_ptr<MetricCounter>, std::unique_ptr<MetricGauge>, std::unique_ptr<MetricHistogram>> metric;
+	};
+
+	struct Family {
+		std::string name;
+		std::string help;
+		Type type;
+		std::vector<Series> series;
+	};
+
+	template <typename T, typename... Args>
+	T &getOrCreate(const std::string &name, const std::string &help, Type type, const Labels &labels, Args &&... args);
+
+	mutable std::mutex mutex;
+	// Kept in registration order, so related metrics stay together in the output
+	std::vector<Family> families;
+	phmap::flat_hash_map<std::string, size_t> familyIndex;
+};
+
+constexpr auto g_metrics = Metrics::getInstance;
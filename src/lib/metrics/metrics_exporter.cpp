@@ -0,0 +1,154 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2022 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include "lib/metrics/metrics_exporter.hpp"
+#include "lib/metrics/metrics.hpp"
+#include "lib/di/container.hpp"
+
+namespace {
+	// One scrape per connection, the answer closes it
+	class MetricsSession : public std::enable_shared_from_this<MetricsSession> {
+	public:
+		MetricsSession(asio::ip::tcp::socket &&socket, const Metrics &metrics) :
+			socket(std::move(socket)), metrics(metrics) { }
+
+		void start() {
+			asio::async_read_until(socket, request, "\r\n\r\n", [self = shared_from_this()](const std::error_code &error, size_t) {
+				if (!error) {
+					self->respond();
+				}
+			});
+		}
+
+	private:
+		void respond() {
+			std::string requestLine;
+			std::istream stream(&request);
+			std::getline(stream, requestLine);
+
+			if (requestLine.starts_with("GET /metrics ") || requestLine.starts_with("GET / ")) {
+				const std::string body = metrics.serialize();
+				response = fmt::format("HTTP/1.1 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\nContent-Length: {}\r\nConnection: close\r\n\r\n{}", body.size(), body);
+			} else {
+				response = "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+			}
+
+			asio::async_write(socket, asio::buffer(response), [self = shared_from_this()](const std::error_code &, size_t) {
+				std::error_code error;
+				self->socket.shutdown(asio::ip::tcp::socket::shutdown_both, error);
+			});
+		}
+
+		asio::ip::tcp::socket socket;
+		const Metrics &metrics;
+		asio::streambuf request;
+		std::string response;
+	};
+}
+
+MetricsExporter::MetricsExporter(Metrics &metrics, Logger &logger) :
+	metrics(metrics), logger(logger), acceptor(ioContext), fileTimer(ioContext) { }
+
+MetricsExporter::~MetricsExporter() {
+	stop();
+}
+
+MetricsExporter &MetricsExporter::getInstance() {
+	return inject<MetricsExporter>();
+}
+
+void MetricsExporter::start(const std::string &host, uint16_t port, const std::string &file, std::chrono::milliseconds fileInterval) {
+	if (thread.joinable()) {
+		return;
+	}
+
+	if (port != 0) {
+		try {
+			const asio::ip::tcp::endpoint endpoint(asio::ip::make_address(host), port);
+			acceptor.open(endpoint.protocol());
+			acceptor.set_option(asio::ip::tcp::acceptor::reuse_address(true));
+			acceptor.bind(endpoint);
+			acceptor.listen();
+			accept();
+			logger.info("Serving metrics on http://{}:{}/metrics", host, port);
+		} catch (const std::system_error &e) {
+			logger.error("[MetricsExporter::start] - Could not listen on {}:{}, error: {}", host, port, e.what());
+		}
+	}
+
+	this->file = file;
+	this->fileInterval = std::max(fileInterval, std::chrono::milliseconds(1000));
+	if (!file.empty()) {
+		scheduleFileWrite();
+		logger.info("Writing metrics to {} every {} milliseconds", file, this->fileInterval.count());
+	}
+
+	if (!acceptor.is_open() && file.empty()) {
+		return;
+	}
+
+	thread = std::thread([this] {
+		ioContext.run();
+	});
+}
+
+void MetricsExporter::stop() {
+	if (!thread.joinable()) {
+		return;
+	}
+
+	ioContext.stop();
+	thread.join();
+}
+
+void MetricsExporter::accept() {
+	acceptor.async_accept([this](const std::error_code &error, asio::ip::tcp::socket socket) {
+		if (error == asio::error::operation_aborted) {
+			return;
+		}
+
+		if (!error) {
+			std::make_shared<MetricsSession>(std::move(socket), metrics)->start();
+		}
+		accept();
+	});
+}
+
+void MetricsExporter::scheduleFileWrite() {
+	fileTimer.expires_after(fileInterval);
+	fileTimer.async_wait([this](const std::error_code &error) {
+		if (error) {
+			return;
+		}
+
+		writeFile();
+		scheduleFileWrite();
+	});
+}
+
+void MetricsExporter::writeFile() const {
+	// Readers never see a partial file
+	const std::string tempFile = file + ".tmp";
+	{
+		std::ofstream out(tempFile, std::ios::binary | std::ios::trunc);
+		if (!out) {
+			logger.error("[MetricsExporter::writeFile] - Could not open {}", tempFile);
+			return;
+		}
+		out << metrics.serialize();
+	}
+
+	std::error_code error;
+	std::filesystem::rename(tempFile, file, error);
+	if (error) {
+		logger.error("[MetricsExporter::writeFile] - Could not replace {}, error: {}", file, error.message());
+	}
+}
@@ -0,0 +1,52 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2022 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+#include "lib/logging/logger.hpp"
+
+class Metrics;
+
+/**
+ * Publishes the metrics registry from its own thread, so scrapes never wait on the
+ * dispatcher: over HTTP for Prometheus and/or by rewriting a file on an interval.
+ */
+class MetricsExporter {
+public:
+	MetricsExporter(Metrics &metrics, Logger &logger);
+	~MetricsExporter();
+
+	// Singleton - ensures we don't accidentally copy it
+	MetricsExporter(const MetricsExporter &) = delete;
+	void operator=(const MetricsExporter &) = delete;
+
+	static MetricsExporter &getInstance();
+
+	// A port of 0 disables the HTTP endpoint, an empty file disables the file output
+	void start(const std::string &host, uint16_t port, const std::string &file, std::chrono::milliseconds fileInterval);
+	void stop();
+
+private:
+	void accept();
+	void scheduleFileWrite();
+	void writeFile() const;
+
+	Metrics &metrics;
+	Logger &logger;
+
+	asio::io_context ioContext;
+	asio::ip::tcp::acceptor acceptor;
+	asio::steady_timer fileTimer;
+	std::thread thread;
+
+	std::string file;
+	std::chrono::milliseconds fileInterval {};
+};
+
+constexpr auto g_metricsExporter = MetricsExporter::getInstance;
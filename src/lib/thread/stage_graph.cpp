@@ -0,0 +1,138 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2022 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+#include "lib/thread/stage_graph.hpp"
+#include "lib/thread/thread_pool.hpp"
+
+StageGraph::StageGraph(ThreadPool &threadPool, Logger &logger) :
+	threadPool(threadPool), logger(logger) { }
+
+void StageGraph::add(const std::string &name, Affinity affinity, const std::vector<std::string> &dependencies, std::function<void()> load) {
+	if (stageIndex.contains(name)) {
+		throw std::invalid_argument(fmt::format("Stage '{}' was already added", name));
+	}
+
+	const size_t index = stages.size();
+	Stage &stage = stages.emplace_back();
+	stage.name = name;
+	stage.affinity = affinity;
+	stage.load = std::move(load);
+	for (const auto &dependency : dependencies) {
+		auto it = stageIndex.find(dependency);
+		if (it == stageIndex.end()) {
+			throw std::invalid_argument(fmt::format("Stage '{}' depends on unknown stage '{}'", name, dependency));
+		}
+		stages[it->second].dependents.push_back(index);
+		++stage.pendingDependencies;
+	}
+	stageIndex.emplace(name, index);
+}
+
+void StageGraph::run() {
+	startTime = std::chrono::steady_clock::now();
+	timings.clear();
+	timings.reserve(stages.size());
+
+	std::unique_lock lock(mutex);
+	for (size_t index = 0; index < stages.size(); ++index) {
+		if (stages[index].pendingDependencies == 0) {
+			schedule(index);
+		}
+	}
+
+	while (true) {
+		signal.wait(lock, [this] {
+			return !callerQueue.empty() || finished == stages.size() || (failure && poolRunning == 0);
+		});
+
+		if (failure) {
+			if (poolRunning == 0) {
+				std::rethrow_exception(failure);
+			}
+			// Don't start anything else, only wait for the running pool stages
+			callerQueue.clear();
+			continue;
+		}
+
+		if (finished == stages.size()) {
+			break;
+		}
+
+		const size_t index = callerQueue.front();
+		callerQueue.pop_front();
+		lock.unlock();
+		execute(index);
+		lock.lock();
+	}
+
+	const auto wallMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+	logReport(wallMs);
+}
+
+// Must be called with the mutex locked
+void StageGraph::schedule(size_t index) {
+	if (stages[index].affinity == Affinity::Caller) {
+		callerQueue.push_back(index);
+		signal.notify_all();
+		return;
+	}
+
+	++poolRunning;
+	threadPool.addLoad([this, index] {
+		execute(index);
+	});
+}
+
+void StageGraph::execute(size_t index) {
+	Stage &stage = stages[index];
+	const auto stageStart = std::chrono::steady_clock::now();
+	std::exception_ptr error;
+	try {
+		stage.load();
+	} catch (...) {
+		error = std::current_exception();
+	}
+	const auto stageEnd = std::chrono::steady_clock::now();
+
+	std::scoped_lock lock(mutex);
+	timings.push_back({ stage.name,
+						stage.affinity,
+						std::chrono::duration_cast<std::chrono::milliseconds>(stageStart - startTime).count(),
+						std::chrono::duration_cast<std::chrono::milliseconds>(stageEnd - stageStart).count() });
+	if (stage.affinity == Affinity::Pool) {
+		--poolRunning;
+	}
+
+	if (error) {
+		if (!failure) {
+			failure = error;
+		}
+	} else {
+		++finished;
+		if (!failure) {
+			for (size_t dependent : stage.dependents) {
+				if (--stages[dependent].pendingDependencies == 0) {
+					schedule(dependent);
+				}
+			}
+		}
+	}
+	signal.notify_all();
+}
+
+void StageGraph::logReport(int64_t wallMs) const {
+	int64_t stagesMs = 0;
+	logger.info("Startup stages:");
+	for (const auto &timing : timings) {
+		stagesMs += timing.durationMs;
+		logger.info("  {:<32} {:>6} ms (started at {:>6} ms, {})", timing.name, timing.durationMs, timing.startMs, timing.affinity == Affinity::Pool ? "thread pool" : "main");
+	}
+	logger.info("Loaded {} stages in {} milliseconds ({} milliseconds of stage time)", timings.size(), wallMs, stagesMs);
+}
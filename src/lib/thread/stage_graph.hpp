@@ -0,0 +1,75 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2022 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+#include "lib/logging/logger.hpp"
+
+class ThreadPool;
+
+/**
+ * Runs a set of load stages as soon as the stages they depend on are done.
+ * Pool stages run concurrently on the thread pool, caller stages run one at a
+ * time, in the order they became ready, on the thread that called run().
+ */
+class StageGraph {
+public:
+	enum class Affinity : uint8_t {
+		Pool,
+		Caller,
+	};
+
+	struct Timing {
+		std::string name;
+		Affinity affinity;
+		int64_t startMs;
+		int64_t durationMs;
+	};
+
+	StageGraph(ThreadPool &threadPool, Logger &logger);
+
+	// Dependencies must be added before the stages depending on them
+	void add(const std::string &name, Affinity affinity, const std::vector<std::string> &dependencies, std::function<void()> load);
+
+	// Blocks until every stage is done and logs the timing report.
+	// Rethrows the first stage failure once the stages already running finish.
+	void run();
+
+	const std::vector<Timing> &getTimings() const {
+		return timings;
+	}
+
+private:
+	struct Stage {
+		std::string name;
+		Affinity affinity;
+		std::function<void()> load;
+		std::vector<size_t> dependents;
+		size_t pendingDependencies = 0;
+	};
+
+	void schedule(size_t index);
+	void execute(size_t index);
+	void logReport(int64_t wallMs) const;
+
+	ThreadPool &threadPool;
+	Logger &logger;
+
+	std::vector<Stage> stages;
+	phmap::flat_hash_map<std::string, size_t> stageIndex;
+	std::vector<Timing> timings;
+
+	std::mutex mutex;
+	std::condition_variable signal;
+	std::deque<size_t> callerQueue;
+	size_t finished = 0;
+	size_t poolRunning = 0;
+	std::exception_ptr failure;
+	std::chrono::steady_clock::time_point startTime;
+};
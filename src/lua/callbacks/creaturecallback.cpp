@@ -36,18 +36,12 @@ bool CreatureCallback::startScriptInterface(int32_t scriptId) {
 }
 
 void CreatureCallback::pushSpecificCreature(std::shared_ptr<Creature> creature) {
-	if (std::shared_ptr<Npc> npc = creature->getNpc()) {
-		LuaScriptInterface::pushUserdata<Npc>(L, npc);
-	} else if (std::shared_ptr<Monster> monster = creature->getMonster()) {
-		LuaScriptInterface::pushUserdata<Monster>(L, monster);
-	} else if (std::shared_ptr<Player> player = creature->getPlayer()) {
-		LuaScriptInterface::pushUserdata<Player>(L, player);
-	} else {
+	if (!creature->getNpc() && !creature->getMonster() && !creature->getPlayer()) {
 		return;
 	}
 
 	params++;
-	LuaScriptInterface::setMetatable(L, -1, getCreatureClass(creature));
+	LuaScriptInterface::pushCreature(L, creature);
 }
 
 std::string CreatureCallback::getCreatureClass(std::shared_ptr<Creature> creature) {
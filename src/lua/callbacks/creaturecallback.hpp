@@ -30,8 +30,7 @@ public:
 
 	void pushCreature(std::shared_ptr<Creature> creature) {
 		params++;
-		LuaScriptInterface::pushUserdata<Creature>(L, creature);
-		LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+		LuaScriptInterface::pushCreature(L, creature);
 	}
 
 	void pushPosition(const Position &position, int32_t stackpos = 0) {
@@ -61,8 +61,7 @@ bool EventCallback::creatureOnChangeOutfit(std::shared_ptr<Creature> creature, c
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Creature>(L, creature);
-	LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+	LuaScriptInterface::pushCreature(L, creature);
 
 	LuaScriptInterface::pushOutfit(L, outfit);
 
@@ -85,14 +84,12 @@ ReturnValue EventCallback::creatureOnAreaCombat(std::shared_ptr<Creature> creatu
 	getScriptInterface()->pushFunction(getScriptId());
 
 	if (creature) {
-		LuaScriptInterface::pushUserdata<Creature>(L, creature);
-		LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+		LuaScriptInterface::pushCreature(L, creature);
 	} else {
 		lua_pushnil(L);
 	}
 
-	LuaScriptInterface::pushUserdata<Tile>(L, tile);
-	LuaScriptInterface::setMetatable(L, -1, "Tile");
+	LuaScriptInterface::pushUserdata<Tile>(L, tile, "Tile");
 
 	LuaScriptInterface::pushBoolean(L, aggressive);
 
@@ -125,14 +122,12 @@ ReturnValue EventCallback::creatureOnTargetCombat(std::shared_ptr<Creature> crea
 	getScriptInterface()->pushFunction(getScriptId());
 
 	if (creature) {
-		LuaScriptInterface::pushUserdata<Creature>(L, creature);
-		LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+		LuaScriptInterface::pushCreature(L, creature);
 	} else {
 		lua_pushnil(L);
 	}
 
-	LuaScriptInterface::pushUserdata<Creature>(L, target);
-	LuaScriptInterface::setCreatureMetatable(L, -1, target);
+	LuaScriptInterface::pushCreature(L, target);
 
 	ReturnValue returnValue;
 	if (getScriptInterface()->protectedCall(L, 2, 1) != 0) {
@@ -162,11 +157,9 @@ void EventCallback::creatureOnHear(std::shared_ptr<Creature> creature, std::shar
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Creature>(L, creature);
-	LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+	LuaScriptInterface::pushCreature(L, creature);
 
-	LuaScriptInterface::pushUserdata<Creature>(L, speaker);
-	LuaScriptInterface::setCreatureMetatable(L, -1, speaker);
+	LuaScriptInterface::pushCreature(L, speaker);
 
 	LuaScriptInterface::pushString(L, words);
 	lua_pushnumber(L, type);
@@ -190,15 +183,13 @@ void EventCallback::creatureOnDrainHealth(std::shared_ptr<Creature> creature, st
 	getScriptInterface()->pushFunction(getScriptId());
 
 	if (creature) {
-		LuaScriptInterface::pushUserdata<Creature>(L, creature);
-		LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+		LuaScriptInterface::pushCreature(L, creature);
 	} else {
 		lua_pushnil(L);
 	}
 
 	if (attacker) {
-		LuaScriptInterface::pushUserdata<Creature>(L, attacker);
-		LuaScriptInterface::setCreatureMetatable(L, -1, attacker);
+		LuaScriptInterface::pushCreature(L, attacker);
 	} else {
 		lua_pushnil(L);
 	}
@@ -241,11 +232,9 @@ bool EventCallback::partyOnJoin(std::shared_ptr<Party> party, std::shared_ptr<Pl
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Party>(L, party);
-	LuaScriptInterface::setMetatable(L, -1, "Party");
+	LuaScriptInterface::pushUserdata<Party>(L, party, "Party");
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	return getScriptInterface()->callFunction(2);
 }
@@ -265,11 +254,9 @@ bool EventCallback::partyOnLeave(std::shared_ptr<Party> party, std::shared_ptr<P
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Party>(L, party);
-	LuaScriptInterface::setMetatable(L, -1, "Party");
+	LuaScriptInterface::pushUserdata<Party>(L, party, "Party");
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	return getScriptInterface()->callFunction(2);
 }
@@ -288,8 +275,7 @@ bool EventCallback::partyOnDisband(std::shared_ptr<Party> party) const {
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Party>(L, party);
-	LuaScriptInterface::setMetatable(L, -1, "Party");
+	LuaScriptInterface::pushUserdata<Party>(L, party, "Party");
 
 	return getScriptInterface()->callFunction(1);
 }
@@ -306,8 +292,7 @@ void EventCallback::partyOnShareExperience(std::shared_ptr<Party> party, uint64_
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Party>(L, party);
-	LuaScriptInterface::setMetatable(L, -1, "Party");
+	LuaScriptInterface::pushUserdata<Party>(L, party, "Party");
 
 	lua_pushnumber(L, exp);
 
@@ -337,8 +322,7 @@ bool EventCallback::playerOnBrowseField(std::shared_ptr<Player> player, const Po
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	LuaScriptInterface::pushPosition(L, position);
 
@@ -360,15 +344,12 @@ void EventCallback::playerOnLook(std::shared_ptr<Player> player, const Position
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	if (std::shared_ptr<Creature> creature = thing->getCreature()) {
-		LuaScriptInterface::pushUserdata<Creature>(L, creature);
-		LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+		LuaScriptInterface::pushCreature(L, creature);
 	} else if (std::shared_ptr<Item> item = thing->getItem()) {
-		LuaScriptInterface::pushUserdata<Item>(L, item);
-		LuaScriptInterface::setItemMetatable(L, -1, item);
+		LuaScriptInterface::pushItem(L, item);
 	} else {
 		lua_pushnil(L);
 	}
@@ -394,11 +375,9 @@ void EventCallback::playerOnLookInBattleList(std::shared_ptr<Player> player, std
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
-	LuaScriptInterface::pushUserdata<Creature>(L, creature);
-	LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+	LuaScriptInterface::pushCreature(L, creature);
 
 	lua_pushnumber(L, lookDistance);
 
@@ -420,14 +399,11 @@ void EventCallback::playerOnLookInTrade(std::shared_ptr<Player> player, std::sha
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
-	LuaScriptInterface::pushUserdata<Player>(L, partner);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, partner, "Player");
 
-	LuaScriptInterface::pushUserdata<Item>(L, item);
-	LuaScriptInterface::setItemMetatable(L, -1, item);
+	LuaScriptInterface::pushItem(L, item);
 
 	lua_pushnumber(L, lookDistance);
 
@@ -449,11 +425,9 @@ bool EventCallback::playerOnLookInShop(std::shared_ptr<Player> player, const Ite
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
-	LuaScriptInterface::pushUserdata<const ItemType>(L, itemType);
-	LuaScriptInterface::setMetatable(L, -1, "ItemType");
+	LuaScriptInterface::pushUserdata<const ItemType>(L, itemType, "ItemType");
 
 	lua_pushnumber(L, count);
 
@@ -475,11 +449,9 @@ void EventCallback::playerOnRemoveCount(std::shared_ptr<Player> player, std::sha
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
-	LuaScriptInterface::pushUserdata<Item>(L, item);
-	LuaScriptInterface::setItemMetatable(L, -1, item);
+	LuaScriptInterface::pushItem(L, item);
 
 	getScriptInterface()->callFunction(2);
 }
@@ -504,8 +476,7 @@ bool EventCallback::playerOnMoveItem(std::shared_ptr<Player> player, std::shared
 
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	LuaScriptInterface::pushThing(L, item);
 
@@ -534,11 +505,9 @@ void EventCallback::playerOnItemMoved(std::shared_ptr<Player> player, std::share
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
-	LuaScriptInterface::pushUserdata<Item>(L, item);
-	LuaScriptInterface::setItemMetatable(L, -1, item);
+	LuaScriptInterface::pushItem(L, item);
 
 	lua_pushnumber(L, count);
 	LuaScriptInterface::pushPosition(L, fromPosition);
@@ -565,8 +534,7 @@ void EventCallback::playerOnChangeZone(std::shared_ptr<Player> player, ZoneType_
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	lua_pushnumber(L, zone);
 	getScriptInterface()->callVoidFunction(2);
@@ -587,11 +555,9 @@ bool EventCallback::playerOnMoveCreature(std::shared_ptr<Player> player, std::sh
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
-	LuaScriptInterface::pushUserdata<Creature>(L, creature);
-	LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+	LuaScriptInterface::pushCreature(L, creature);
 
 	LuaScriptInterface::pushPosition(L, fromPosition);
 	LuaScriptInterface::pushPosition(L, toPosition);
@@ -614,8 +580,7 @@ void EventCallback::playerOnReportRuleViolation(std::shared_ptr<Player> player,
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	LuaScriptInterface::pushString(L, targetName);
 
@@ -643,8 +608,7 @@ void EventCallback::playerOnReportBug(std::shared_ptr<Player> player, const std:
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	LuaScriptInterface::pushString(L, message);
 	LuaScriptInterface::pushPosition(L, position);
@@ -668,8 +632,7 @@ bool EventCallback::playerOnTurn(std::shared_ptr<Player> player, Direction direc
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	lua_pushnumber(L, direction);
 
@@ -691,14 +654,11 @@ bool EventCallback::playerOnTradeRequest(std::shared_ptr<Player> player, std::sh
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
-	LuaScriptInterface::pushUserdata<Player>(L, target);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, target, "Player");
 
-	LuaScriptInterface::pushUserdata<Item>(L, item);
-	LuaScriptInterface::setItemMetatable(L, -1, item);
+	LuaScriptInterface::pushItem(L, item);
 
 	return getScriptInterface()->callFunction(3);
 }
@@ -718,17 +678,13 @@ bool EventCallback::playerOnTradeAccept(std::shared_ptr<Player> player, std::sha
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
-	LuaScriptInterface::pushUserdata<Player>(L, target);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, target, "Player");
 
-	LuaScriptInterface::pushUserdata<Item>(L, item);
-	LuaScriptInterface::setItemMetatable(L, -1, item);
+	LuaScriptInterface::pushItem(L, item);
 
-	LuaScriptInterface::pushUserdata<Item>(L, targetItem);
-	LuaScriptInterface::setItemMetatable(L, -1, targetItem);
+	LuaScriptInterface::pushItem(L, targetItem);
 
 	return getScriptInterface()->callFunction(4);
 }
@@ -748,12 +704,10 @@ void EventCallback::playerOnGainExperience(std::shared_ptr<Player> player, std::
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	if (target) {
-		LuaScriptInterface::pushUserdata<Creature>(L, target);
-		LuaScriptInterface::setCreatureMetatable(L, -1, target);
+		LuaScriptInterface::pushCreature(L, target);
 	} else {
 		lua_pushnil(L);
 	}
@@ -786,8 +740,7 @@ void EventCallback::playerOnLoseExperience(std::shared_ptr<Player> player, uint6
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	lua_pushnumber(L, exp);
 
@@ -816,8 +769,7 @@ void EventCallback::playerOnGainSkillTries(std::shared_ptr<Player> player, skill
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	lua_pushnumber(L, skill);
 	lua_pushnumber(L, tries);
@@ -847,19 +799,16 @@ void EventCallback::playerOnCombat(std::shared_ptr<Player> player, std::shared_p
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	if (target) {
-		LuaScriptInterface::pushUserdata<Creature>(L, target);
-		LuaScriptInterface::setMetatable(L, -1, "Creature");
+		LuaScriptInterface::pushUserdata<Creature>(L, target, "Creature");
 	} else {
 		lua_pushnil(L);
 	}
 
 	if (item) {
-		LuaScriptInterface::pushUserdata<Item>(L, item);
-		LuaScriptInterface::setMetatable(L, -1, "Item");
+		LuaScriptInterface::pushUserdata<Item>(L, item, "Item");
 	} else {
 		lua_pushnil(L);
 	}
@@ -909,8 +858,7 @@ void EventCallback::playerOnRequestQuestLog(std::shared_ptr<Player> player) cons
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	getScriptInterface()->callVoidFunction(1);
 }
@@ -930,8 +878,7 @@ void EventCallback::playerOnRequestQuestLine(std::shared_ptr<Player> player, uin
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	lua_pushnumber(L, questId);
 
@@ -950,11 +897,9 @@ void EventCallback::playerOnInventoryUpdate(std::shared_ptr<Player> player, std:
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
-	LuaScriptInterface::pushUserdata<Item>(L, item);
-	LuaScriptInterface::setItemMetatable(L, -1, item);
+	LuaScriptInterface::pushItem(L, item);
 
 	lua_pushnumber(L, slot);
 	LuaScriptInterface::pushBoolean(L, equip);
@@ -974,11 +919,9 @@ bool EventCallback::playerOnRotateItem(std::shared_ptr<Player> player, std::shar
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
-	LuaScriptInterface::pushUserdata<Item>(L, item);
-	LuaScriptInterface::setItemMetatable(L, -1, item);
+	LuaScriptInterface::pushItem(L, item);
 
 	LuaScriptInterface::pushPosition(L, position);
 
@@ -1000,8 +943,7 @@ void EventCallback::playerOnStorageUpdate(std::shared_ptr<Player> player, const
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	lua_pushnumber(L, key);
 	lua_pushnumber(L, value);
@@ -1027,11 +969,9 @@ void EventCallback::monsterOnDropLoot(std::shared_ptr<Monster> monster, std::sha
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Monster>(L, monster);
-	LuaScriptInterface::setMetatable(L, -1, "Monster");
+	LuaScriptInterface::pushUserdata<Monster>(L, monster, "Monster");
 
-	LuaScriptInterface::pushUserdata<Container>(L, corpse);
-	LuaScriptInterface::setMetatable(L, -1, "Container");
+	LuaScriptInterface::pushUserdata<Container>(L, corpse, "Container");
 
 	return getScriptInterface()->callVoidFunction(2);
 }
@@ -1051,11 +991,9 @@ void EventCallback::monsterPostDropLoot(std::shared_ptr<Monster> monster, std::s
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Monster>(L, monster);
-	LuaScriptInterface::setMetatable(L, -1, "Monster");
+	LuaScriptInterface::pushUserdata<Monster>(L, monster, "Monster");
 
-	LuaScriptInterface::pushUserdata<Container>(L, corpse);
-	LuaScriptInterface::setMetatable(L, -1, "Container");
+	LuaScriptInterface::pushUserdata<Container>(L, corpse, "Container");
 
 	return getScriptInterface()->callVoidFunction(2);
 }
@@ -1075,8 +1013,7 @@ void EventCallback::monsterOnSpawn(std::shared_ptr<Monster> monster, const Posit
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Monster>(L, monster);
-	LuaScriptInterface::setMetatable(L, -1, "Monster");
+	LuaScriptInterface::pushUserdata<Monster>(L, monster, "Monster");
 	LuaScriptInterface::pushPosition(L, position);
 
 	if (getScriptInterface()->protectedCall(L, 2, 1) != 0) {
@@ -1104,8 +1041,7 @@ void EventCallback::npcOnSpawn(std::shared_ptr<Npc> npc, const Position &positio
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Npc>(L, npc);
-	LuaScriptInterface::setMetatable(L, -1, "Npc");
+	LuaScriptInterface::pushUserdata<Npc>(L, npc, "Npc");
 	LuaScriptInterface::pushPosition(L, position);
 
 	if (getScriptInterface()->protectedCall(L, 2, 1) != 0) {
@@ -1132,11 +1068,9 @@ bool EventCallback::zoneBeforeCreatureEnter(std::shared_ptr<Zone> zone, std::sha
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Zone>(L, zone);
-	LuaScriptInterface::setMetatable(L, -1, "Zone");
+	LuaScriptInterface::pushUserdata<Zone>(L, zone, "Zone");
 
-	LuaScriptInterface::pushUserdata<Creature>(L, creature);
-	LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+	LuaScriptInterface::pushCreature(L, creature);
 
 	return getScriptInterface()->callFunction(2);
 }
@@ -1156,11 +1090,9 @@ bool EventCallback::zoneBeforeCreatureLeave(std::shared_ptr<Zone> zone, std::sha
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Zone>(L, zone);
-	LuaScriptInterface::setMetatable(L, -1, "Zone");
+	LuaScriptInterface::pushUserdata<Zone>(L, zone, "Zone");
 
-	LuaScriptInterface::pushUserdata<Creature>(L, creature);
-	LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+	LuaScriptInterface::pushCreature(L, creature);
 
 	return getScriptInterface()->callFunction(2);
 }
@@ -1180,11 +1112,9 @@ void EventCallback::zoneAfterCreatureEnter(std::shared_ptr<Zone> zone, std::shar
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Zone>(L, zone);
-	LuaScriptInterface::setMetatable(L, -1, "Zone");
+	LuaScriptInterface::pushUserdata<Zone>(L, zone, "Zone");
 
-	LuaScriptInterface::pushUserdata<Creature>(L, creature);
-	LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+	LuaScriptInterface::pushCreature(L, creature);
 
 	getScriptInterface()->callVoidFunction(2);
 }
@@ -1204,11 +1134,9 @@ void EventCallback::zoneAfterCreatureLeave(std::shared_ptr<Zone> zone, std::shar
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Zone>(L, zone);
-	LuaScriptInterface::setMetatable(L, -1, "Zone");
+	LuaScriptInterface::pushUserdata<Zone>(L, zone, "Zone");
 
-	LuaScriptInterface::pushUserdata<Creature>(L, creature);
-	LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+	LuaScriptInterface::pushCreature(L, creature);
 
 	getScriptInterface()->callVoidFunction(2);
 }
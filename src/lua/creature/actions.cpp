@@ -210,23 +210,20 @@ ReturnValue Actions::canUseFar(std::shared_ptr<Creature> creature, const Positio
 }
 
 std::shared_ptr<Action> Actions::getAction(std::shared_ptr<Item> item) {
-	if (item->hasAttribute(ItemAttribute_t::UNIQUEID)) {
-		auto it = uniqueItemMap.find(item->getAttribute<uint16_t>(ItemAttribute_t::UNIQUEID));
-		if (it != uniqueItemMap.end()) {
-			return it->second;
+	if (!uniqueItemMap.empty() && item->hasAttribute(ItemAttribute_t::UNIQUEID)) {
+		if (const auto action = uniqueItemMap.find(item->getAttribute<uint16_t>(ItemAttribute_t::UNIQUEID))) {
+			return *action;
 		}
 	}
 
-	if (item->hasAttribute(ItemAttribute_t::ACTIONID)) {
-		auto it = actionItemMap.find(item->getAttribute<uint16_t>(ItemAttribute_t::ACTIONID));
-		if (it != actionItemMap.end()) {
-			return it->second;
+	if (!actionItemMap.empty() && item->hasAttribute(ItemAttribute_t::ACTIONID)) {
+		if (const auto action = actionItemMap.find(item->getAttribute<uint16_t>(ItemAttribute_t::ACTIONID))) {
+			return *action;
 		}
 	}
 
-	auto it = useItemMap.find(item->getID());
-	if (it != useItemMap.end()) {
-		return it->second;
+	if (const auto action = useItemMap.find(item->getID())) {
+		return *action;
 	}
 
 	if (auto iteratePositions = actionPositionMap.find(item->getPosition());
@@ -526,8 +523,7 @@ bool Action::executeUse(std::shared_ptr<Player> player, std::shared_ptr<Item> it
 
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	LuaScriptInterface::pushThing(L, item);
 	LuaScriptInterface::pushPosition(L, fromPosition);
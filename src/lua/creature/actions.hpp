@@ -12,6 +12,7 @@
 #include "lua/scripts/scripts.hpp"
 #include "declarations.hpp"
 #include "lua/scripts/luascript.hpp"
+#include "utils/idtable.hpp"
 
 class Action;
 class Position;
@@ -108,6 +109,9 @@ private:
 	std::string getScriptTypeName() const override {
 		return "onUse";
 	}
+	std::string getEventKind() const override {
+		return "action";
+	}
 
 	std::function<bool(
 		std::shared_ptr<Player> player, std::shared_ptr<Item> item,
@@ -160,15 +164,7 @@ public:
 
 private:
 	bool hasPosition(Position position) const {
-		if (auto it = actionPositionMap.find(position);
-			it != actionPositionMap.end()) {
-			return true;
-		}
-		return false;
-	}
-
-	[[nodiscard]] std::map<Position, std::shared_ptr<Action>> getPositionsMap() const {
-		return actionPositionMap;
+		return actionPositionMap.contains(position);
 	}
 
 	void setPosition(Position position, std::shared_ptr<Action> action) {
@@ -176,11 +172,7 @@ private:
 	}
 
 	bool hasItemId(uint16_t itemId) const {
-		if (auto it = useItemMap.find(itemId);
-			it != useItemMap.end()) {
-			return true;
-		}
-		return false;
+		return useItemMap.contains(itemId);
 	}
 
 	void setItemId(uint16_t itemId, const std::shared_ptr<Action> action) {
@@ -188,11 +180,7 @@ private:
 	}
 
 	bool hasUniqueId(uint16_t uniqueId) const {
-		if (auto it = uniqueItemMap.find(uniqueId);
-			it != uniqueItemMap.end()) {
-			return true;
-		}
-		return false;
+		return uniqueItemMap.contains(uniqueId);
 	}
 
 	void setUniqueId(uint16_t uniqueId, const std::shared_ptr<Action> action) {
@@ -200,11 +188,7 @@ private:
 	}
 
 	bool hasActionId(uint16_t actionId) const {
-		if (auto it = actionItemMap.find(actionId);
-			it != actionItemMap.end()) {
-			return true;
-		}
-		return false;
+		return actionItemMap.contains(actionId);
 	}
 
 	void setActionId(uint16_t actionId, const std::shared_ptr<Action> action) {
@@ -214,11 +198,12 @@ private:
 	ReturnValue internalUseItem(std::shared_ptr<Player> player, const Position &pos, uint8_t index, std::shared_ptr<Item> item, bool isHotkey);
 	static void showUseHotkeyMessage(std::shared_ptr<Player> player, std::shared_ptr<Item> item, uint32_t count);
 
-	using ActionUseMap = std::map<uint16_t, std::shared_ptr<Action>>;
+	// Indexed by the id itself, see stdext::id_table
+	using ActionUseMap = stdext::id_table<std::shared_ptr<Action>>;
 	ActionUseMap useItemMap;
 	ActionUseMap uniqueItemMap;
 	ActionUseMap actionItemMap;
-	std::map<Position, std::shared_ptr<Action>> actionPositionMap;
+	phmap::flat_hash_map<Position, std::shared_ptr<Action>> actionPositionMap;
 
 	std::shared_ptr<Action> getAction(std::shared_ptr<Item> item);
 };
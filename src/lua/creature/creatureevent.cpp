@@ -186,8 +186,7 @@ bool CreatureEvent::executeOnLogin(std::shared_ptr<Player> player) const {
 	lua_State* L = getScriptInterface()->getLuaState();
 
 	getScriptInterface()->pushFunction(getScriptId());
-	LuaScriptInterface::pushUserdata(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata(L, player, "Player");
 	return getScriptInterface()->callFunction(1);
 }
 
@@ -206,8 +205,7 @@ bool CreatureEvent::executeOnLogout(std::shared_ptr<Player> player) const {
 	lua_State* L = getScriptInterface()->getLuaState();
 
 	getScriptInterface()->pushFunction(getScriptId());
-	LuaScriptInterface::pushUserdata(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata(L, player, "Player");
 	return getScriptInterface()->callFunction(1);
 }
 
@@ -226,8 +224,7 @@ bool CreatureEvent::executeOnThink(std::shared_ptr<Creature> creature, uint32_t
 	lua_State* L = getScriptInterface()->getLuaState();
 
 	getScriptInterface()->pushFunction(getScriptId());
-	LuaScriptInterface::pushUserdata<Creature>(L, creature);
-	LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+	LuaScriptInterface::pushCreature(L, creature);
 	lua_pushnumber(L, interval);
 
 	return getScriptInterface()->callFunction(2);
@@ -249,12 +246,10 @@ bool CreatureEvent::executeOnPrepareDeath(std::shared_ptr<Creature> creature, st
 
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Creature>(L, creature);
-	LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+	LuaScriptInterface::pushCreature(L, creature);
 
 	if (killer) {
-		LuaScriptInterface::pushUserdata<Creature>(L, killer);
-		LuaScriptInterface::setCreatureMetatable(L, -1, killer);
+		LuaScriptInterface::pushCreature(L, killer);
 	} else {
 		lua_pushnil(L);
 	}
@@ -277,21 +272,18 @@ bool CreatureEvent::executeOnDeath(std::shared_ptr<Creature> creature, std::shar
 	lua_State* L = getScriptInterface()->getLuaState();
 
 	getScriptInterface()->pushFunction(getScriptId());
-	LuaScriptInterface::pushUserdata<Creature>(L, creature);
-	LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+	LuaScriptInterface::pushCreature(L, creature);
 
 	LuaScriptInterface::pushThing(L, corpse);
 
 	if (killer) {
-		LuaScriptInterface::pushUserdata<Creature>(L, killer);
-		LuaScriptInterface::setCreatureMetatable(L, -1, killer);
+		LuaScriptInterface::pushCreature(L, killer);
 	} else {
 		lua_pushnil(L);
 	}
 
 	if (mostDamageKiller) {
-		LuaScriptInterface::pushUserdata<Creature>(L, mostDamageKiller);
-		LuaScriptInterface::setCreatureMetatable(L, -1, mostDamageKiller);
+		LuaScriptInterface::pushCreature(L, mostDamageKiller);
 	} else {
 		lua_pushnil(L);
 	}
@@ -317,8 +309,7 @@ bool CreatureEvent::executeAdvance(std::shared_ptr<Player> player, skills_t skil
 	lua_State* L = getScriptInterface()->getLuaState();
 
 	getScriptInterface()->pushFunction(getScriptId());
-	LuaScriptInterface::pushUserdata(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata(L, player, "Player");
 	lua_pushnumber(L, static_cast<uint32_t>(skill));
 	lua_pushnumber(L, oldLevel);
 	lua_pushnumber(L, newLevel);
@@ -341,10 +332,8 @@ void CreatureEvent::executeOnKill(std::shared_ptr<Creature> creature, std::share
 	lua_State* L = getScriptInterface()->getLuaState();
 
 	getScriptInterface()->pushFunction(getScriptId());
-	LuaScriptInterface::pushUserdata<Creature>(L, creature);
-	LuaScriptInterface::setCreatureMetatable(L, -1, creature);
-	LuaScriptInterface::pushUserdata<Creature>(L, target);
-	LuaScriptInterface::setCreatureMetatable(L, -1, target);
+	LuaScriptInterface::pushCreature(L, creature);
+	LuaScriptInterface::pushCreature(L, target);
 	LuaScriptInterface::pushBoolean(L, lastHit);
 	getScriptInterface()->callVoidFunction(3);
 }
@@ -365,8 +354,7 @@ void CreatureEvent::executeModalWindow(std::shared_ptr<Player> player, uint32_t
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata(L, player, "Player");
 
 	lua_pushnumber(L, modalWindowId);
 	lua_pushnumber(L, buttonId);
@@ -390,8 +378,7 @@ bool CreatureEvent::executeTextEdit(std::shared_ptr<Player> player, std::shared_
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata(L, player, "Player");
 
 	LuaScriptInterface::pushThing(L, item);
 	LuaScriptInterface::pushString(L, text);
@@ -415,11 +402,9 @@ void CreatureEvent::executeHealthChange(std::shared_ptr<Creature> creature, std:
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata(L, creature);
-	LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+	LuaScriptInterface::pushCreature(L, creature);
 	if (attacker) {
-		LuaScriptInterface::pushUserdata(L, attacker);
-		LuaScriptInterface::setCreatureMetatable(L, -1, attacker);
+		LuaScriptInterface::pushCreature(L, attacker);
 	} else {
 		lua_pushnil(L);
 	}
@@ -460,11 +445,9 @@ void CreatureEvent::executeManaChange(std::shared_ptr<Creature> creature, std::s
 	lua_State* L = getScriptInterface()->getLuaState();
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata(L, creature);
-	LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+	LuaScriptInterface::pushCreature(L, creature);
 	if (attacker) {
-		LuaScriptInterface::pushUserdata(L, attacker);
-		LuaScriptInterface::setCreatureMetatable(L, -1, attacker);
+		LuaScriptInterface::pushCreature(L, attacker);
 	} else {
 		lua_pushnil(L);
 	}
@@ -501,8 +484,7 @@ void CreatureEvent::executeExtendedOpcode(std::shared_ptr<Player> player, uint8_
 
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	lua_pushnumber(L, opcode);
 	LuaScriptInterface::pushString(L, buffer);
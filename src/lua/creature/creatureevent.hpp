@@ -59,6 +59,9 @@ public:
 
 private:
 	std::string getScriptTypeName() const override;
+	std::string getEventKind() const override {
+		return "creatureevent";
+	}
 
 	std::string eventName;
 	CreatureEventType_t type = CREATURE_EVENT_NONE;
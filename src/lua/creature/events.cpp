@@ -170,8 +170,7 @@ void Events::eventMonsterOnSpawn(std::shared_ptr<Monster> monster, const Positio
 	lua_State* L = scriptInterface.getLuaState();
 	scriptInterface.pushFunction(info.monsterOnSpawn);
 
-	LuaScriptInterface::pushUserdata<Monster>(L, monster);
-	LuaScriptInterface::setMetatable(L, -1, "Monster");
+	LuaScriptInterface::pushUserdata<Monster>(L, monster, "Monster");
 	LuaScriptInterface::pushPosition(L, position);
 
 	if (scriptInterface.protectedCall(L, 2, 1) != 0) {
@@ -204,8 +203,7 @@ void Events::eventNpcOnSpawn(std::shared_ptr<Npc> npc, const Position &position)
 	lua_State* L = scriptInterface.getLuaState();
 	scriptInterface.pushFunction(info.npcOnSpawn);
 
-	LuaScriptInterface::pushUserdata<Npc>(L, npc);
-	LuaScriptInterface::setMetatable(L, -1, "Npc");
+	LuaScriptInterface::pushUserdata<Npc>(L, npc, "Npc");
 	LuaScriptInterface::pushPosition(L, position);
 
 	if (scriptInterface.protectedCall(L, 2, 1) != 0) {
@@ -237,8 +235,7 @@ bool Events::eventCreatureOnChangeOutfit(std::shared_ptr<Creature> creature, con
 	lua_State* L = scriptInterface.getLuaState();
 	scriptInterface.pushFunction(info.creatureOnChangeOutfit);
 
-	LuaScriptInterface::pushUserdata<Creature>(L, creature);
-	LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+	LuaScriptInterface::pushCreature(L, creature);
 
 	LuaScriptInterface::pushOutfit(L, outfit);
 
@@ -266,14 +263,12 @@ ReturnValue Events::eventCreatureOnAreaCombat(std::shared_ptr<Creature> creature
 	scriptInterface.pushFunction(info.creatureOnAreaCombat);
 
 	if (creature) {
-		LuaScriptInterface::pushUserdata<Creature>(L, creature);
-		LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+		LuaScriptInterface::pushCreature(L, creature);
 	} else {
 		lua_pushnil(L);
 	}
 
-	LuaScriptInterface::pushUserdata<Tile>(L, tile);
-	LuaScriptInterface::setMetatable(L, -1, "Tile");
+	LuaScriptInterface::pushUserdata<Tile>(L, tile, "Tile");
 
 	LuaScriptInterface::pushBoolean(L, aggressive);
 
@@ -311,14 +306,12 @@ ReturnValue Events::eventCreatureOnTargetCombat(std::shared_ptr<Creature> creatu
 	scriptInterface.pushFunction(info.creatureOnTargetCombat);
 
 	if (creature) {
-		LuaScriptInterface::pushUserdata<Creature>(L, creature);
-		LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+		LuaScriptInterface::pushCreature(L, creature);
 	} else {
 		lua_pushnil(L);
 	}
 
-	LuaScriptInterface::pushUserdata<Creature>(L, target);
-	LuaScriptInterface::setCreatureMetatable(L, -1, target);
+	LuaScriptInterface::pushCreature(L, target);
 
 	ReturnValue returnValue;
 	if (scriptInterface.protectedCall(L, 2, 1) != 0) {
@@ -353,11 +346,9 @@ void Events::eventCreatureOnHear(std::shared_ptr<Creature> creature, std::shared
 	lua_State* L = scriptInterface.getLuaState();
 	scriptInterface.pushFunction(info.creatureOnHear);
 
-	LuaScriptInterface::pushUserdata<Creature>(L, creature);
-	LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+	LuaScriptInterface::pushCreature(L, creature);
 
-	LuaScriptInterface::pushUserdata<Creature>(L, speaker);
-	LuaScriptInterface::setCreatureMetatable(L, -1, speaker);
+	LuaScriptInterface::pushCreature(L, speaker);
 
 	LuaScriptInterface::pushString(L, words);
 	lua_pushnumber(L, type);
@@ -385,15 +376,13 @@ void Events::eventCreatureOnDrainHealth(std::shared_ptr<Creature> creature, std:
 	scriptInterface.pushFunction(info.creatureOnDrainHealth);
 
 	if (creature) {
-		LuaScriptInterface::pushUserdata<Creature>(L, creature);
-		LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+		LuaScriptInterface::pushCreature(L, creature);
 	} else {
 		lua_pushnil(L);
 	}
 
 	if (attacker) {
-		LuaScriptInterface::pushUserdata<Creature>(L, attacker);
-		LuaScriptInterface::setCreatureMetatable(L, -1, attacker);
+		LuaScriptInterface::pushCreature(L, attacker);
 	} else {
 		lua_pushnil(L);
 	}
@@ -441,11 +430,9 @@ bool Events::eventPartyOnJoin(std::shared_ptr<Party> party, std::shared_ptr<Play
 	lua_State* L = scriptInterface.getLuaState();
 	scriptInterface.pushFunction(info.partyOnJoin);
 
-	LuaScriptInterface::pushUserdata<Party>(L, party);
-	LuaScriptInterface::setMetatable(L, -1, "Party");
+	LuaScriptInterface::pushUserdata<Party>(L, party, "Party");
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	return scriptInterface.callFunction(2);
 }
@@ -470,11 +457,9 @@ bool Events::eventPartyOnLeave(std::shared_ptr<Party> party, std::shared_ptr<Pla
 	lua_State* L = scriptInterface.getLuaState();
 	scriptInterface.pushFunction(info.partyOnLeave);
 
-	LuaScriptInterface::pushUserdata<Party>(L, party);
-	LuaScriptInterface::setMetatable(L, -1, "Party");
+	LuaScriptInterface::pushUserdata<Party>(L, party, "Party");
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	return scriptInterface.callFunction(2);
 }
@@ -498,8 +483,7 @@ bool Events::eventPartyOnDisband(std::shared_ptr<Party> party) {
 	lua_State* L = scriptInterface.getLuaState();
 	scriptInterface.pushFunction(info.partyOnDisband);
 
-	LuaScriptInterface::pushUserdata<Party>(L, party);
-	LuaScriptInterface::setMetatable(L, -1, "Party");
+	LuaScriptInterface::pushUserdata<Party>(L, party, "Party");
 
 	return scriptInterface.callFunction(1);
 }
@@ -521,8 +505,7 @@ void Events::eventPartyOnShareExperience(std::shared_ptr<Party> party, uint64_t
 	lua_State* L = scriptInterface.getLuaState();
 	scriptInterface.pushFunction(info.partyOnShareExperience);
 
-	LuaScriptInterface::pushUserdata<Party>(L, party);
-	LuaScriptInterface::setMetatable(L, -1, "Party");
+	LuaScriptInterface::pushUserdata<Party>(L, party, "Party");
 
 	lua_pushnumber(L, exp);
 
@@ -557,8 +540,7 @@ bool Events::eventPlayerOnBrowseField(std::shared_ptr<Player> player, const Posi
 	lua_State* L = scriptInterface.getLuaState();
 	scriptInterface.pushFunction(info.playerOnBrowseField);
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	LuaScriptInterface::pushPosition(L, position);
 
@@ -585,15 +567,12 @@ void Events::eventPlayerOnLook(std::shared_ptr<Player> player, const Position &p
 	lua_State* L = scriptInterface.getLuaState();
 	scriptInterface.pushFunction(info.playerOnLook);
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	if (std::shared_ptr<Creature> creature = thing->getCreature()) {
-		LuaScriptInterface::pushUserdata<Creature>(L, creature);
-		LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+		LuaScriptInterface::pushCreature(L, creature);
 	} else if (std::shared_ptr<Item> item = thing->getItem()) {
-		LuaScriptInterface::pushUserdata<Item>(L, item);
-		LuaScriptInterface::setItemMetatable(L, -1, item);
+		LuaScriptInterface::pushItem(L, item);
 	} else {
 		lua_pushnil(L);
 	}
@@ -624,11 +603,9 @@ void Events::eventPlayerOnLookInBattleList(std::shared_ptr<Player> player, std::
 	lua_State* L = scriptInterface.getLuaState();
 	scriptInterface.pushFunction(info.playerOnLookInBattleList);
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
-	LuaScriptInterface::pushUserdata<Creature>(L, creature);
-	LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+	LuaScriptInterface::pushCreature(L, creature);
 
 	lua_pushnumber(L, lookDistance);
 
@@ -655,14 +632,11 @@ void Events::eventPlayerOnLookInTrade(std::shared_ptr<Player> player, std::share
 	lua_State* L = scriptInterface.getLuaState();
 	scriptInterface.pushFunction(info.playerOnLookInTrade);
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
-	LuaScriptInterface::pushUserdata<Player>(L, partner);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, partner, "Player");
 
-	LuaScriptInterface::pushUserdata<Item>(L, item);
-	LuaScriptInterface::setItemMetatable(L, -1, item);
+	LuaScriptInterface::pushItem(L, item);
 
 	lua_pushnumber(L, lookDistance);
 
@@ -689,11 +663,9 @@ bool Events::eventPlayerOnLookInShop(std::shared_ptr<Player> player, const ItemT
 	lua_State* L = scriptInterface.getLuaState();
 	scriptInterface.pushFunction(info.playerOnLookInShop);
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
-	LuaScriptInterface::pushUserdata<const ItemType>(L, itemType);
-	LuaScriptInterface::setMetatable(L, -1, "ItemType");
+	LuaScriptInterface::pushUserdata<const ItemType>(L, itemType, "ItemType");
 
 	lua_pushnumber(L, count);
 
@@ -720,11 +692,9 @@ bool Events::eventPlayerOnRemoveCount(std::shared_ptr<Player> player, std::share
 	lua_State* L = scriptInterface.getLuaState();
 	scriptInterface.pushFunction(info.playerOnRemoveCount);
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
-	LuaScriptInterface::pushUserdata<Item>(L, item);
-	LuaScriptInterface::setItemMetatable(L, -1, item);
+	LuaScriptInterface::pushItem(L, item);
 
 	return scriptInterface.callFunction(2);
 }
@@ -749,11 +719,9 @@ bool Events::eventPlayerOnMoveItem(std::shared_ptr<Player> player, std::shared_p
 	lua_State* L = scriptInterface.getLuaState();
 	scriptInterface.pushFunction(info.playerOnMoveItem);
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
-	LuaScriptInterface::pushUserdata<Item>(L, item);
-	LuaScriptInterface::setItemMetatable(L, -1, item);
+	LuaScriptInterface::pushItem(L, item);
 
 	lua_pushnumber(L, count);
 	LuaScriptInterface::pushPosition(L, fromPosition);
@@ -785,11 +753,9 @@ void Events::eventPlayerOnItemMoved(std::shared_ptr<Player> player, std::shared_
 	lua_State* L = scriptInterface.getLuaState();
 	scriptInterface.pushFunction(info.playerOnItemMoved);
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
-	LuaScriptInterface::pushUserdata<Item>(L, item);
-	LuaScriptInterface::setItemMetatable(L, -1, item);
+	LuaScriptInterface::pushItem(L, item);
 
 	lua_pushnumber(L, count);
 	LuaScriptInterface::pushPosition(L, fromPosition);
@@ -821,8 +787,7 @@ void Events::eventPlayerOnChangeZone(std::shared_ptr<Player> player, ZoneType_t
 	lua_State* L = scriptInterface.getLuaState();
 	scriptInterface.pushFunction(info.playerOnChangeZone);
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	lua_pushnumber(L, zone);
 	scriptInterface.callVoidFunction(2);
@@ -848,11 +813,9 @@ bool Events::eventPlayerOnMoveCreature(std::shared_ptr<Player> player, std::shar
 	lua_State* L = scriptInterface.getLuaState();
 	scriptInterface.pushFunction(info.playerOnMoveCreature);
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
-	LuaScriptInterface::pushUserdata<Creature>(L, creature);
-	LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+	LuaScriptInterface::pushCreature(L, creature);
 
 	LuaScriptInterface::pushPosition(L, fromPosition);
 	LuaScriptInterface::pushPosition(L, toPosition);
@@ -880,8 +843,7 @@ void Events::eventPlayerOnReportRuleViolation(std::shared_ptr<Player> player, co
 	lua_State* L = scriptInterface.getLuaState();
 	scriptInterface.pushFunction(info.playerOnReportRuleViolation);
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	LuaScriptInterface::pushString(L, targetName);
 
@@ -914,8 +876,7 @@ bool Events::eventPlayerOnReportBug(std::shared_ptr<Player> player, const std::s
 	lua_State* L = scriptInterface.getLuaState();
 	scriptInterface.pushFunction(info.playerOnReportBug);
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	LuaScriptInterface::pushString(L, message);
 	LuaScriptInterface::pushPosition(L, position);
@@ -944,8 +905,7 @@ bool Events::eventPlayerOnTurn(std::shared_ptr<Player> player, Direction directi
 	lua_State* L = scriptInterface.getLuaState();
 	scriptInterface.pushFunction(info.playerOnTurn);
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	lua_pushnumber(L, direction);
 
@@ -972,14 +932,11 @@ bool Events::eventPlayerOnTradeRequest(std::shared_ptr<Player> player, std::shar
 	lua_State* L = scriptInterface.getLuaState();
 	scriptInterface.pushFunction(info.playerOnTradeRequest);
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
-	LuaScriptInterface::pushUserdata<Player>(L, target);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, target, "Player");
 
-	LuaScriptInterface::pushUserdata<Item>(L, item);
-	LuaScriptInterface::setItemMetatable(L, -1, item);
+	LuaScriptInterface::pushItem(L, item);
 
 	return scriptInterface.callFunction(3);
 }
@@ -1004,17 +961,13 @@ bool Events::eventPlayerOnTradeAccept(std::shared_ptr<Player> player, std::share
 	lua_State* L = scriptInterface.getLuaState();
 	scriptInterface.pushFunction(info.playerOnTradeAccept);
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
-	LuaScriptInterface::pushUserdata<Player>(L, target);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, target, "Player");
 
-	LuaScriptInterface::pushUserdata<Item>(L, item);
-	LuaScriptInterface::setItemMetatable(L, -1, item);
+	LuaScriptInterface::pushItem(L, item);
 
-	LuaScriptInterface::pushUserdata<Item>(L, targetItem);
-	LuaScriptInterface::setItemMetatable(L, -1, targetItem);
+	LuaScriptInterface::pushItem(L, targetItem);
 
 	return scriptInterface.callFunction(4);
 }
@@ -1040,12 +993,10 @@ void Events::eventPlayerOnGainExperience(std::shared_ptr<Player> player, std::sh
 	lua_State* L = scriptInterface.getLuaState();
 	scriptInterface.pushFunction(info.playerOnGainExperience);
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	if (target) {
-		LuaScriptInterface::pushUserdata<Creature>(L, target);
-		LuaScriptInterface::setCreatureMetatable(L, -1, target);
+		LuaScriptInterface::pushCreature(L, target);
 	} else {
 		lua_pushnil(L);
 	}
@@ -1083,8 +1034,7 @@ void Events::eventPlayerOnLoseExperience(std::shared_ptr<Player> player, uint64_
 	lua_State* L = scriptInterface.getLuaState();
 	scriptInterface.pushFunction(info.playerOnLoseExperience);
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	lua_pushnumber(L, exp);
 
@@ -1118,8 +1068,7 @@ void Events::eventPlayerOnGainSkillTries(std::shared_ptr<Player> player, skills_
 	lua_State* L = scriptInterface.getLuaState();
 	scriptInterface.pushFunction(info.playerOnGainSkillTries);
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	lua_pushnumber(L, skill);
 	lua_pushnumber(L, tries);
@@ -1154,19 +1103,16 @@ void Events::eventPlayerOnCombat(std::shared_ptr<Player> player, std::shared_ptr
 	lua_State* L = scriptInterface.getLuaState();
 	scriptInterface.pushFunction(info.playerOnCombat);
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	if (target) {
-		LuaScriptInterface::pushUserdata<Creature>(L, target);
-		LuaScriptInterface::setMetatable(L, -1, "Creature");
+		LuaScriptInterface::pushUserdata<Creature>(L, target, "Creature");
 	} else {
 		lua_pushnil(L);
 	}
 
 	if (item) {
-		LuaScriptInterface::pushUserdata<Item>(L, item);
-		LuaScriptInterface::setMetatable(L, -1, "Item");
+		LuaScriptInterface::pushUserdata<Item>(L, item, "Item");
 	} else {
 		lua_pushnil(L);
 	}
@@ -1211,8 +1157,7 @@ void Events::eventPlayerOnRequestQuestLog(std::shared_ptr<Player> player) {
 	lua_State* L = scriptInterface.getLuaState();
 	scriptInterface.pushFunction(info.playerOnRequestQuestLog);
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	scriptInterface.callVoidFunction(1);
 }
@@ -1237,8 +1182,7 @@ void Events::eventPlayerOnRequestQuestLine(std::shared_ptr<Player> player, uint1
 	lua_State* L = scriptInterface.getLuaState();
 	scriptInterface.pushFunction(info.playerOnRequestQuestLine);
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	lua_pushnumber(L, questId);
 
@@ -1262,11 +1206,9 @@ void Events::eventPlayerOnInventoryUpdate(std::shared_ptr<Player> player, std::s
 	lua_State* L = scriptInterface.getLuaState();
 	scriptInterface.pushFunction(info.playerOnInventoryUpdate);
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
-	LuaScriptInterface::pushUserdata<Item>(L, item);
-	LuaScriptInterface::setItemMetatable(L, -1, item);
+	LuaScriptInterface::pushItem(L, item);
 
 	lua_pushnumber(L, slot);
 	LuaScriptInterface::pushBoolean(L, equip);
@@ -1294,8 +1236,7 @@ void Events::eventOnStorageUpdate(std::shared_ptr<Player> player, const uint32_t
 	lua_State* L = scriptInterface.getLuaState();
 	scriptInterface.pushFunction(info.playerOnStorageUpdate);
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	lua_pushnumber(L, key);
 	lua_pushnumber(L, value);
@@ -1326,11 +1267,9 @@ void Events::eventMonsterOnDropLoot(std::shared_ptr<Monster> monster, std::share
 	lua_State* L = scriptInterface.getLuaState();
 	scriptInterface.pushFunction(info.monsterOnDropLoot);
 
-	LuaScriptInterface::pushUserdata<Monster>(L, monster);
-	LuaScriptInterface::setMetatable(L, -1, "Monster");
+	LuaScriptInterface::pushUserdata<Monster>(L, monster, "Monster");
 
-	LuaScriptInterface::pushUserdata<Container>(L, corpse);
-	LuaScriptInterface::setMetatable(L, -1, "Container");
+	LuaScriptInterface::pushUserdata<Container>(L, corpse, "Container");
 
 	return scriptInterface.callVoidFunction(2);
 }
@@ -122,29 +122,32 @@ bool MoveEvents::registerLuaEvent(const std::shared_ptr<MoveEvent> moveEvent) {
 	}
 }
 
-bool MoveEvents::registerEvent(const std::shared_ptr<MoveEvent> moveEvent, int32_t id, std::map<int32_t, MoveEventList> &moveListMap) const {
-	auto it = moveListMap.find(id);
-	if (it == moveListMap.end()) {
-		MoveEventList moveEventList;
-		moveEventList.moveEvent[moveEvent->getEventType()].push_back(moveEvent);
-		moveListMap[id] = moveEventList;
-		return true;
-	} else {
-		std::list<std::shared_ptr<MoveEvent>> &moveEventList = it->second.moveEvent[moveEvent->getEventType()];
-		for (const auto &existingMoveEvent : moveEventList) {
-			if (existingMoveEvent->getSlot() == moveEvent->getSlot()) {
-				g_logger().warn(
-					"[{}] duplicate move event found: {}, for script: {}",
-					__FUNCTION__,
-					id,
-					moveEvent->getScriptInterface()->getLoadingScriptName()
-				);
-				return false;
-			}
+bool MoveEvents::registerEvent(const std::shared_ptr<MoveEvent> moveEvent, int32_t id, MoveEventIdMap &moveListMap) const {
+	// Item ids, action ids and unique ids of items are all 16 bits
+	if (id < 0 || id > std::numeric_limits<uint16_t>::max()) {
+		g_logger().warn(
+			"[{}] invalid move event id: {}, for script: {}",
+			__FUNCTION__,
+			id,
+			moveEvent->getScriptInterface()->getLoadingScriptName()
+		);
+		return false;
+	}
+
+	auto &moveEventList = moveListMap[static_cast<uint32_t>(id)].moveEvent[moveEvent->getEventType()];
+	for (const auto &existingMoveEvent : moveEventList) {
+		if (existingMoveEvent->getSlot() == moveEvent->getSlot()) {
+			g_logger().warn(
+				"[{}] duplicate move event found: {}, for script: {}",
+				__FUNCTION__,
+				id,
+				moveEvent->getScriptInterface()->getLoadingScriptName()
+			);
+			return false;
 		}
-		moveEventList.push_back(moveEvent);
-		return true;
 	}
+	moveEventList.push_back(moveEvent);
+	return true;
 }
 
 std::shared_ptr<MoveEvent> MoveEvents::getEvent(const std::shared_ptr<Item> &item, MoveEvent_t eventType, Slots_t slot) {
@@ -185,11 +188,9 @@ std::shared_ptr<MoveEvent> MoveEvents::getEvent(const std::shared_ptr<Item> &ite
 			break;
 	}
 
-	if (item->hasAttribute(ItemAttribute_t::ACTIONID)) {
-		std::map<int32_t, MoveEventList>::iterator it = actionIdMap.find(item->getAttribute<uint16_t>(ItemAttribute_t::ACTIONID));
-		if (it != actionIdMap.end()) {
-			std::list<std::shared_ptr<MoveEvent>> moveEventList = it->second.moveEvent[eventType];
-			for (const auto &moveEvent : moveEventList) {
+	if (!actionIdMap.empty() && item->hasAttribute(ItemAttribute_t::ACTIONID)) {
+		if (const auto moveEventList = actionIdMap.find(item->getAttribute<uint16_t>(ItemAttribute_t::ACTIONID))) {
+			for (const auto &moveEvent : moveEventList->moveEvent[eventType]) {
 				if ((moveEvent->getSlot() & slotp) != 0) {
 					return moveEvent;
 				}
@@ -197,10 +198,8 @@ std::shared_ptr<MoveEvent> MoveEvents::getEvent(const std::shared_ptr<Item> &ite
 		}
 	}
 
-	auto it = itemIdMap.find(item->getID());
-	if (it != itemIdMap.end()) {
-		std::list<std::shared_ptr<MoveEvent>> &moveEventList = it->second.moveEvent[eventType];
-		for (const auto &moveEvent : moveEventList) {
+	if (const auto moveEventList = itemIdMap.find(item->getID())) {
+		for (const auto &moveEvent : moveEventList->moveEvent[eventType]) {
 			if ((moveEvent->getSlot() & slotp) != 0) {
 				return moveEvent;
 			}
@@ -210,38 +209,32 @@ std::shared_ptr<MoveEvent> MoveEvents::getEvent(const std::shared_ptr<Item> &ite
 }
 
 std::shared_ptr<MoveEvent> MoveEvents::getEvent(const std::shared_ptr<Item> &item, MoveEvent_t eventType) {
-	std::map<int32_t, MoveEventList>::iterator it;
-	if (item->hasAttribute(ItemAttribute_t::UNIQUEID)) {
-		it = uniqueIdMap.find(item->getAttribute<uint16_t>(ItemAttribute_t::UNIQUEID));
-		if (it != uniqueIdMap.end()) {
-			std::list<std::shared_ptr<MoveEvent>> &moveEventList = it->second.moveEvent[eventType];
-			if (!moveEventList.empty()) {
-				return *moveEventList.begin();
+	// Most items have neither an unique id nor an action id, they only cost the item id lookup
+	if (!uniqueIdMap.empty() && item->hasAttribute(ItemAttribute_t::UNIQUEID)) {
+		if (const auto moveEventList = uniqueIdMap.find(item->getAttribute<uint16_t>(ItemAttribute_t::UNIQUEID))) {
+			if (const auto &moveEvents = moveEventList->moveEvent[eventType]; !moveEvents.empty()) {
+				return moveEvents.front();
 			}
 		}
 	}
 
-	if (item->hasAttribute(ItemAttribute_t::ACTIONID)) {
-		it = actionIdMap.find(item->getAttribute<uint16_t>(ItemAttribute_t::ACTIONID));
-		if (it != actionIdMap.end()) {
-			std::list<std::shared_ptr<MoveEvent>> &moveEventList = it->second.moveEvent[eventType];
-			if (!moveEventList.empty()) {
-				return *moveEventList.begin();
+	if (!actionIdMap.empty() && item->hasAttribute(ItemAttribute_t::ACTIONID)) {
+		if (const auto moveEventList = actionIdMap.find(item->getAttribute<uint16_t>(ItemAttribute_t::ACTIONID))) {
+			if (const auto &moveEvents = moveEventList->moveEvent[eventType]; !moveEvents.empty()) {
+				return moveEvents.front();
 			}
 		}
 	}
 
-	it = itemIdMap.find(item->getID());
-	if (it != itemIdMap.end()) {
-		std::list<std::shared_ptr<MoveEvent>> &moveEventList = it->second.moveEvent[eventType];
-		if (!moveEventList.empty()) {
-			return *moveEventList.begin();
+	if (const auto moveEventList = itemIdMap.find(item->getID())) {
+		if (const auto &moveEvents = moveEventList->moveEvent[eventType]; !moveEvents.empty()) {
+			return moveEvents.front();
 		}
 	}
 	return nullptr;
 }
 
-bool MoveEvents::registerEvent(const std::shared_ptr<MoveEvent> moveEvent, const Position &position, std::map<Position, MoveEventList> &moveListMap) const {
+bool MoveEvents::registerEvent(const std::shared_ptr<MoveEvent> moveEvent, const Position &position, phmap::flat_hash_map<Position, MoveEventList> &moveListMap) const {
 	auto it = moveListMap.find(position);
 	if (it == moveListMap.end()) {
 		MoveEventList moveEventList;
@@ -249,7 +242,7 @@ bool MoveEvents::registerEvent(const std::shared_ptr<MoveEvent> moveEvent, const
 		moveListMap[position] = moveEventList;
 		return true;
 	} else {
-		std::list<std::shared_ptr<MoveEvent>> &moveEventList = it->second.moveEvent[moveEvent->getEventType()];
+		auto &moveEventList = it->second.moveEvent[moveEvent->getEventType()];
 		if (!moveEventList.empty()) {
 			g_logger().warn(
 				"[{}] duplicate move event found: {}, for script {}",
@@ -266,11 +259,14 @@ bool MoveEvents::registerEvent(const std::shared_ptr<MoveEvent> moveEvent, const
 }
 
 std::shared_ptr<MoveEvent> MoveEvents::getEvent(const std::shared_ptr<Tile> &tile, MoveEvent_t eventType) {
+	if (positionsMap.empty()) {
+		return nullptr;
+	}
+
 	if (auto it = positionsMap.find(tile->getPosition());
 		it != positionsMap.end()) {
-		std::list<std::shared_ptr<MoveEvent>> &moveEventList = it->second.moveEvent[eventType];
-		if (!moveEventList.empty()) {
-			return *moveEventList.begin();
+		if (const auto &moveEvents = it->second.moveEvent[eventType]; !moveEvents.empty()) {
+			return moveEvents.front();
 		}
 	}
 	return nullptr;
@@ -709,8 +705,7 @@ bool MoveEvent::executeStep(const std::shared_ptr<Creature> &creature, std::shar
 	lua_State* L = getScriptInterface()->getLuaState();
 
 	getScriptInterface()->pushFunction(getScriptId());
-	LuaScriptInterface::pushUserdata<Creature>(L, creature);
-	LuaScriptInterface::setCreatureMetatable(L, -1, creature);
+	LuaScriptInterface::pushCreature(L, creature);
 	LuaScriptInterface::pushThing(L, item);
 	LuaScriptInterface::pushPosition(L, pos);
 	LuaScriptInterface::pushPosition(L, fromPosition);
@@ -747,8 +742,7 @@ bool MoveEvent::executeEquip(const std::shared_ptr<Player> &player, const std::s
 	lua_State* L = getScriptInterface()->getLuaState();
 
 	getScriptInterface()->pushFunction(getScriptId());
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 	LuaScriptInterface::pushThing(L, item);
 	lua_pushnumber(L, onSlot);
 	LuaScriptInterface::pushBoolean(L, isCheck);
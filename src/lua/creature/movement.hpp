@@ -14,11 +14,12 @@
 #include "lua/functions/events/move_event_functions.hpp"
 #include "lua/scripts/scripts.hpp"
 #include "creatures/players/vocations/vocation.hpp"
+#include "utils/idtable.hpp"
 
 class MoveEvent;
 
 struct MoveEventList {
-	std::list<std::shared_ptr<MoveEvent>> moveEvent[MOVE_EVENT_LAST];
+	std::vector<std::shared_ptr<MoveEvent>> moveEvent[MOVE_EVENT_LAST];
 };
 
 using VocEquipMap = std::map<uint16_t, bool>;
@@ -41,64 +42,32 @@ public:
 	uint32_t onPlayerDeEquip(const std::shared_ptr<Player> &player, const std::shared_ptr<Item> &item, Slots_t slot);
 	uint32_t onItemMove(const std::shared_ptr<Item> &item, const std::shared_ptr<Tile> &tile, bool isAdd);
 
-	std::map<Position, MoveEventList> getPositionsMap() const {
-		return positionsMap;
-	}
-
 	bool hasPosition(Position position) const {
-		if (auto it = positionsMap.find(position);
-			it != positionsMap.end()) {
-			return true;
-		}
-		return false;
+		return positionsMap.contains(position);
 	}
 
 	void setPosition(Position position, MoveEventList moveEventList) {
 		positionsMap.try_emplace(position, moveEventList);
 	}
 
-	std::map<int32_t, MoveEventList> getItemIdMap() const {
-		return itemIdMap;
-	}
-
 	bool hasItemId(int32_t itemId) const {
-		if (auto it = itemIdMap.find(itemId);
-			it != itemIdMap.end()) {
-			return true;
-		}
-		return false;
+		return itemIdMap.contains(itemId);
 	}
 
 	void setItemId(int32_t itemId, MoveEventList moveEventList) {
 		itemIdMap.try_emplace(itemId, moveEventList);
 	}
 
-	std::map<int32_t, MoveEventList> getUniqueIdMap() const {
-		return uniqueIdMap;
-	}
-
 	bool hasUniqueId(int32_t uniqueId) const {
-		if (auto it = uniqueIdMap.find(uniqueId);
-			it != uniqueIdMap.end()) {
-			return true;
-		}
-		return false;
+		return uniqueIdMap.contains(uniqueId);
 	}
 
 	void setUniqueId(int32_t uniqueId, MoveEventList moveEventList) {
 		uniqueIdMap.try_emplace(uniqueId, moveEventList);
 	}
 
-	std::map<int32_t, MoveEventList> getActionIdMap() const {
-		return actionIdMap;
-	}
-
 	bool hasActionId(int32_t actionId) const {
-		if (auto it = actionIdMap.find(actionId);
-			it != actionIdMap.end()) {
-			return true;
-		}
-		return false;
+		return actionIdMap.contains(actionId);
 	}
 
 	void setActionId(int32_t actionId, MoveEventList moveEventList) {
@@ -115,19 +84,19 @@ public:
 	void clear();
 
 private:
-	void clearMap(std::map<int32_t, MoveEventList> &map) const;
-	void clearPosMap(std::map<Position, MoveEventList> &map);
+	using MoveEventIdMap = stdext::id_table<MoveEventList>;
 
-	bool registerEvent(const std::shared_ptr<MoveEvent> moveEvent, int32_t id, std::map<int32_t, MoveEventList> &moveListMap) const;
-	bool registerEvent(const std::shared_ptr<MoveEvent> moveEvent, const Position &position, std::map<Position, MoveEventList> &moveListMap) const;
+	bool registerEvent(const std::shared_ptr<MoveEvent> moveEvent, int32_t id, MoveEventIdMap &moveListMap) const;
+	bool registerEvent(const std::shared_ptr<MoveEvent> moveEvent, const Position &position, phmap::flat_hash_map<Position, MoveEventList> &moveListMap) const;
 	std::shared_ptr<MoveEvent> getEvent(const std::shared_ptr<Tile> &tile, MoveEvent_t eventType);
 
 	std::shared_ptr<MoveEvent> getEvent(const std::shared_ptr<Item> &item, MoveEvent_t eventType, Slots_t slot);
 
-	std::map<int32_t, MoveEventList> uniqueIdMap;
-	std::map<int32_t, MoveEventList> actionIdMap;
-	std::map<int32_t, MoveEventList> itemIdMap;
-	std::map<Position, MoveEventList> positionsMap;
+	// Item ids, action ids and unique ids are small, they index the events directly
+	MoveEventIdMap uniqueIdMap;
+	MoveEventIdMap actionIdMap;
+	MoveEventIdMap itemIdMap;
+	phmap::flat_hash_map<Position, MoveEventList> positionsMap;
 };
 
 constexpr auto g_moveEvents = MoveEvents::getInstance;
@@ -253,6 +222,9 @@ public:
 
 private:
 	std::string getScriptTypeName() const override;
+	std::string getEventKind() const override {
+		return "movement";
+	}
 
 	uint32_t slot = SLOTP_WHEREEVER;
 
@@ -18,11 +18,23 @@ TalkActions::~TalkActions() = default;
 
 void TalkActions::clear() {
 	talkActions.clear();
+	talkActionsByWord.clear();
 }
 
 bool TalkActions::registerLuaEvent(const TalkAction_ptr &talkAction) {
-	auto [iterator, inserted] = talkActions.try_emplace(talkAction->getWords(), talkAction);
-	return inserted;
+	const std::string &talkactionWords = talkAction->getWords();
+	auto [iterator, inserted] = talkActions.try_emplace(talkactionWords, talkAction);
+	if (!inserted) {
+		return false;
+	}
+
+	auto wordsList = talkactionWords.find(',') != std::string::npos ? split(talkactionWords) : std::vector<std::string> { talkactionWords };
+	for (const auto &word : wordsList) {
+		auto &candidates = talkActionsByWord[word];
+		auto position = std::ranges::upper_bound(candidates, talkactionWords, std::less {}, &TalkAction::getWords);
+		candidates.emplace(position, talkAction);
+	}
+	return true;
 }
 
 bool TalkActions::checkWord(std::shared_ptr<Player> player, SpeakClasses type, const std::string &words, const std::string_view &word, const TalkAction_ptr &talkActionPtr) const {
@@ -62,18 +74,20 @@ bool TalkActions::checkWord(std::shared_ptr<Player> player, SpeakClasses type, c
 }
 
 TalkActionResult_t TalkActions::checkPlayerCanSayTalkAction(std::shared_ptr<Player> player, SpeakClasses type, const std::string &words) const {
-	for (const auto &[talkactionWords, talkActionPtr] : talkActions) {
-		if (talkactionWords.find(',') != std::string::npos) {
-			auto wordsList = split(talkactionWords);
-			for (const auto &word : wordsList) {
-				if (checkWord(player, type, words, word, talkActionPtr)) {
-					return TALKACTION_BREAK;
-				}
-			}
-		} else {
-			if (checkWord(player, type, words, talkactionWords, talkActionPtr)) {
-				return TALKACTION_BREAK;
-			}
+	// Talkactions only match on the first word, so it alone picks the candidates
+	auto spacePos = std::ranges::find_if(words.begin(), words.end(), ::isspace);
+	const std::string firstWord = words.substr(0, spacePos - words.begin());
+
+	auto it = talkActionsByWord.find(firstWord);
+	if (it == talkActionsByWord.end()) {
+		return TALKACTION_CONTINUE;
+	}
+
+	// Copied, a talkaction may reload the talkactions
+	const std::vector<TalkAction_ptr> candidates = it->second;
+	for (const auto &talkActionPtr : candidates) {
+		if (checkWord(player, type, words, firstWord, talkActionPtr)) {
+			return TALKACTION_BREAK;
 		}
 	}
 	return TALKACTION_CONTINUE;
@@ -95,8 +109,7 @@ bool TalkAction::executeSay(std::shared_ptr<Player> player, const std::string &w
 
 	getScriptInterface()->pushFunction(getScriptId());
 
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	LuaScriptInterface::pushString(L, words);
 	LuaScriptInterface::pushString(L, param);
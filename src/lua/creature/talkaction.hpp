@@ -59,6 +59,9 @@ private:
 	std::string getScriptTypeName() const override {
 		return "onSay";
 	}
+	std::string getEventKind() const override {
+		return "talkaction";
+	}
 
 	std::string m_word;
 	std::string separator = "\"";
@@ -90,6 +93,8 @@ public:
 
 private:
 	std::map<std::string, std::shared_ptr<TalkAction>> talkActions;
+	// Every word of a talkaction leads to it, candidates keep the order of talkActions
+	phmap::flat_hash_map<std::string, std::vector<TalkAction_ptr>> talkActionsByWord;
 };
 
 constexpr auto g_talkActions = TalkActions::getInstance;
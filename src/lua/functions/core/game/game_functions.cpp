@@ -23,6 +23,7 @@
 #include "lua/creature/talkaction.hpp"
 #include "lua/functions/creatures/npc/npc_type_functions.hpp"
 #include "lua/scripts/lua_environment.hpp"
+#include "lua/scripts/lua_profiler.hpp"
 #include "lua/creature/events.hpp"
 #include "lua/callbacks/event_callback.hpp"
 #include "lua/callbacks/events_callbacks.hpp"
@@ -71,8 +72,7 @@ int GameFunctions::luaGameCreateMonsterType(lua_State* L) {
 			}
 		}
 
-		pushUserdata<MonsterType>(L, monsterType);
-		setMetatable(L, -1, "MonsterType");
+		pushUserdata<MonsterType>(L, monsterType, "MonsterType");
 	} else {
 		lua_pushnil(L);
 	}
@@ -105,8 +105,7 @@ int GameFunctions::luaGameGetSpectators(lua_State* L) {
 
 	int index = 0;
 	for (std::shared_ptr<Creature> creature : spectators) {
-		pushUserdata<Creature>(L, creature);
-		setCreatureMetatable(L, -1, creature);
+		pushCreature(L, creature);
 		lua_rawseti(L, -2, ++index);
 	}
 	return 1;
@@ -166,8 +165,7 @@ int GameFunctions::luaGameGetPlayers(lua_State* L) {
 
 	int index = 0;
 	for (const auto &playerEntry : g_game().getPlayers()) {
-		pushUserdata<Player>(L, playerEntry.second);
-		setMetatable(L, -1, "Player");
+		pushUserdata<Player>(L, playerEntry.second, "Player");
 		lua_rawseti(L, -2, ++index);
 	}
 	return 1;
@@ -212,8 +210,7 @@ int GameFunctions::luaGameGetMonsterTypes(lua_State* L) {
 	lua_createtable(L, type.size(), 0);
 
 	for (const auto [typeName, mType] : type) {
-		pushUserdata<MonsterType>(L, mType);
-		setMetatable(L, -1, "MonsterType");
+		pushUserdata<MonsterType>(L, mType, "MonsterType");
 		lua_setfield(L, -2, typeName.c_str());
 	}
 	return 1;
@@ -226,8 +223,7 @@ int GameFunctions::luaGameGetTowns(lua_State* L) {
 
 	int index = 0;
 	for (auto townEntry : towns) {
-		pushUserdata<Town>(L, townEntry.second);
-		setMetatable(L, -1, "Town");
+		pushUserdata<Town>(L, townEntry.second, "Town");
 		lua_rawseti(L, -2, ++index);
 	}
 	return 1;
@@ -240,8 +236,7 @@ int GameFunctions::luaGameGetHouses(lua_State* L) {
 
 	int index = 0;
 	for (auto houseEntry : houses) {
-		pushUserdata<House>(L, houseEntry.second);
-		setMetatable(L, -1, "House");
+		pushUserdata<House>(L, houseEntry.second, "House");
 		lua_rawseti(L, -2, ++index);
 	}
 	return 1;
@@ -361,12 +356,10 @@ int GameFunctions::luaGameCreateItem(lua_State* L) {
 
 		if (hasTable) {
 			lua_pushnumber(L, i);
-			pushUserdata<Item>(L, item);
-			setItemMetatable(L, -1, item);
+			pushItem(L, item);
 			lua_settable(L, -3);
 		} else {
-			pushUserdata<Item>(L, item);
-			setItemMetatable(L, -1, item);
+			pushItem(L, item);
 		}
 	}
 
@@ -407,8 +400,7 @@ int GameFunctions::luaGameCreateContainer(lua_State* L) {
 		container->setParent(VirtualCylinder::virtualCylinder);
 	}
 
-	pushUserdata<Container>(L, container);
-	setMetatable(L, -1, "Container");
+	pushUserdata<Container>(L, container, "Container");
 	return 1;
 }
 
@@ -443,8 +435,7 @@ int GameFunctions::luaGameCreateMonster(lua_State* L) {
 			}
 		}
 
-		pushUserdata<Monster>(L, monster);
-		setMetatable(L, -1, "Monster");
+		pushUserdata<Monster>(L, monster, "Monster");
 	} else {
 		if (isSummon) {
 			monster->setMaster(nullptr);
@@ -462,8 +453,7 @@ int GameFunctions::luaGameGenerateNpc(lua_State* L) {
 		lua_pushnil(L);
 		return 1;
 	} else {
-		pushUserdata<Npc>(L, npc);
-		setMetatable(L, -1, "Npc");
+		pushUserdata<Npc>(L, npc, "Npc");
 	}
 	return 1;
 }
@@ -480,8 +470,7 @@ int GameFunctions::luaGameCreateNpc(lua_State* L) {
 	bool extended = getBoolean(L, 3, false);
 	bool force = getBoolean(L, 4, false);
 	if (g_game().placeCreature(npc, position, extended, force)) {
-		pushUserdata<Npc>(L, npc);
-		setMetatable(L, -1, "Npc");
+		pushUserdata<Npc>(L, npc, "Npc");
 	} else {
 		lua_pushnil(L);
 	}
@@ -503,8 +492,7 @@ int GameFunctions::luaGameCreateTile(lua_State* L) {
 		isDynamic = getBoolean(L, 4, false);
 	}
 
-	pushUserdata(L, g_game().map.getOrCreateTile(position, isDynamic));
-	setMetatable(L, -1, "Tile");
+	pushUserdata(L, g_game().map.getOrCreateTile(position, isDynamic), "Tile");
 	return 1;
 }
 
@@ -515,8 +503,7 @@ int GameFunctions::luaGameGetBestiaryCharm(lua_State* L) {
 
 	int index = 0;
 	for (const auto charmPtr : c_list) {
-		pushUserdata<Charm>(L, charmPtr);
-		setMetatable(L, -1, "Charm");
+		pushUserdata<Charm>(L, charmPtr, "Charm");
 		lua_rawseti(L, -2, ++index);
 	}
 	return 1;
@@ -525,8 +512,7 @@ int GameFunctions::luaGameGetBestiaryCharm(lua_State* L) {
 int GameFunctions::luaGameCreateBestiaryCharm(lua_State* L) {
 	// Game.createBestiaryCharm(id)
 	if (const std::shared_ptr<Charm> charm = g_iobestiary().getBestiaryCharm(static_cast<charmRune_t>(getNumber<int8_t>(L, 1, 0)), true)) {
-		pushUserdata<Charm>(L, charm);
-		setMetatable(L, -1, "Charm");
+		pushUserdata<Charm>(L, charm, "Charm");
 	} else {
 		lua_pushnil(L);
 	}
@@ -537,8 +523,7 @@ int GameFunctions::luaGameCreateItemClassification(lua_State* L) {
 	// Game.createItemClassification(id)
 	const ItemClassification* itemClassification = g_game().getItemsClassification(getNumber<uint8_t>(L, 1), true);
 	if (itemClassification) {
-		pushUserdata<const ItemClassification>(L, itemClassification);
-		setMetatable(L, -1, "ItemClassification");
+		pushUserdata<const ItemClassification>(L, itemClassification, "ItemClassification");
 	} else {
 		lua_pushnil(L);
 	}
@@ -617,8 +602,7 @@ int GameFunctions::luaGameGetOfflinePlayer(lua_State* L) {
 	if (!IOLoginData::loadPlayerById(offlinePlayer, playerId)) {
 		lua_pushnil(L);
 	} else {
-		pushUserdata<Player>(L, offlinePlayer);
-		setMetatable(L, -1, "Player");
+		pushUserdata<Player>(L, offlinePlayer, "Player");
 	}
 
 	return 1;
@@ -761,8 +745,7 @@ int GameFunctions::luaGameGetTalkActions(lua_State* L) {
 	lua_createtable(L, static_cast<int>(talkactionsMap.size()), 0);
 
 	for (const auto &[talkName, talkactionSharedPtr] : talkactionsMap) {
-		pushUserdata<TalkAction>(L, talkactionSharedPtr);
-		setMetatable(L, -1, "TalkAction");
+		pushUserdata<TalkAction>(L, talkactionSharedPtr, "TalkAction");
 		lua_setfield(L, -2, talkName.c_str());
 	}
 	return 1;
@@ -784,3 +767,33 @@ int GameFunctions::luaGameGetEventCallbacks(lua_State* L) {
 	lua_pop(L, 1);
 	return 1;
 }
+
+int GameFunctions::luaGameStartLuaProfiler(lua_State* L) {
+	// Game.startLuaProfiler([sampleInstructions = 1000])
+	if (g_luaProfiler().isRunning()) {
+		pushBoolean(L, false);
+		return 1;
+	}
+
+	g_luaProfiler().start(g_luaEnvironment().getLuaState(), getNumber<uint32_t>(L, 1, 1000));
+	pushBoolean(L, true);
+	return 1;
+}
+
+int GameFunctions::luaGameStopLuaProfiler(lua_State* L) {
+	// Game.stopLuaProfiler()
+	if (!g_luaProfiler().isRunning()) {
+		pushBoolean(L, false);
+		return 1;
+	}
+
+	g_luaProfiler().stop(g_luaEnvironment().getLuaState());
+	pushBoolean(L, true);
+	return 1;
+}
+
+int GameFunctions::luaGameDumpLuaProfile(lua_State* L) {
+	// Game.dumpLuaProfile(file)
+	pushBoolean(L, g_luaProfiler().dump(getString(L, 1)));
+	return 1;
+}
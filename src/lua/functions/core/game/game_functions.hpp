@@ -81,6 +81,10 @@ public:
 
 		registerMethod(L, "Game", "getTalkActions", GameFunctions::luaGameGetTalkActions);
 		registerMethod(L, "Game", "getEventCallbacks", GameFunctions::luaGameGetEventCallbacks);
+
+		registerMethod(L, "Game", "startLuaProfiler", GameFunctions::luaGameStartLuaProfiler);
+		registerMethod(L, "Game", "stopLuaProfiler", GameFunctions::luaGameStopLuaProfiler);
+		registerMethod(L, "Game", "dumpLuaProfile", GameFunctions::luaGameDumpLuaProfile);
 	}
 
 private:
@@ -150,4 +154,8 @@ private:
 
 	static int luaGameGetTalkActions(lua_State* L);
 	static int luaGameGetEventCallbacks(lua_State* L);
+
+	static int luaGameStartLuaProfiler(lua_State* L);
+	static int luaGameStopLuaProfiler(lua_State* L);
+	static int luaGameDumpLuaProfile(lua_State* L);
 };
@@ -666,27 +666,27 @@ int GlobalFunctions::luaAddEvent(lua_State* L) {
 		}
 	}
 
-	LuaTimerEventDesc eventDesc;
-	for (int i = 0; i < parameters - 2; ++i) { // -2 because addEvent needs at least two parameters
-		eventDesc.parameters.push_back(luaL_ref(globalState, LUA_REGISTRYINDEX));
-	}
-
 	uint32_t delay = std::max<uint32_t>(100, getNumber<uint32_t>(globalState, 2));
-	lua_pop(globalState, 1);
 
-	eventDesc.function = luaL_ref(globalState, LUA_REGISTRYINDEX);
-	eventDesc.scriptId = getScriptEnv()->getScriptId();
-	eventDesc.scriptName = getScriptEnv()->getScriptInterface()->getLoadingScriptName();
+	// The callback and its arguments share one registry reference
+	lua_createtable(globalState, parameters - 1, 0);
+	lua_pushvalue(globalState, 1);
+	lua_rawseti(globalState, -2, 1);
+	for (int i = 3; i <= parameters; ++i) {
+		lua_pushvalue(globalState, i);
+		lua_rawseti(globalState, -2, i - 1);
+	}
 
-	auto &lastTimerEventId = g_luaEnvironment().lastEventTimerId;
-	eventDesc.eventId = g_dispatcher().scheduleEvent(
-		delay,
-		std::bind(&LuaEnvironment::executeTimerEvent, &g_luaEnvironment(), lastTimerEventId),
-		"LuaEnvironment::executeTimerEvent"
-	);
+	LuaTimerEventDesc eventDesc;
+	eventDesc.callback = luaL_ref(globalState, LUA_REGISTRYINDEX);
+	eventDesc.arguments = std::max(0, parameters - 2); // -2 because addEvent needs at least two parameters
+	lua_pop(globalState, parameters);
 
-	g_luaEnvironment().timerEvents.emplace(lastTimerEventId, std::move(eventDesc));
-	lua_pushnumber(L, lastTimerEventId++);
+	ScriptEnvironment* env = getScriptEnv();
+	eventDesc.scriptId = env->getScriptId();
+	eventDesc.scriptName = env->getScriptInterface()->getFileById(eventDesc.scriptId);
+
+	lua_pushnumber(L, g_luaEnvironment().addTimerEvent(std::move(eventDesc), delay));
 	return 1;
 }
 
@@ -700,25 +700,7 @@ int GlobalFunctions::luaStopEvent(lua_State* L) {
 	}
 
 	uint32_t eventId = getNumber<uint32_t>(L, 1);
-
-	auto &timerEvents = g_luaEnvironment().timerEvents;
-	auto it = timerEvents.find(eventId);
-	if (it == timerEvents.end()) {
-		pushBoolean(L, false);
-		return 1;
-	}
-
-	LuaTimerEventDesc timerEventDesc = std::move(it->second);
-	timerEvents.erase(it);
-
-	g_dispatcher().stopEvent(timerEventDesc.eventId);
-	luaL_unref(globalState, LUA_REGISTRYINDEX, timerEventDesc.function);
-
-	for (auto parameter : timerEventDesc.parameters) {
-		luaL_unref(globalState, LUA_REGISTRYINDEX, parameter);
-	}
-
-	pushBoolean(L, true);
+	pushBoolean(L, g_luaEnvironment().stopTimerEvent(eventId));
 	return 1;
 }
 
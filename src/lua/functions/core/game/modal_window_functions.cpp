@@ -19,8 +19,7 @@ int ModalWindowFunctions::luaModalWindowCreate(lua_State* L) {
 	const std::string &title = getString(L, 3);
 	uint32_t id = getNumber<uint32_t>(L, 2);
 
-	pushUserdata<ModalWindow>(L, std::make_shared<ModalWindow>(id, title, message));
-	setMetatable(L, -1, "ModalWindow");
+	pushUserdata<ModalWindow>(L, std::make_shared<ModalWindow>(id, title, message), "ModalWindow");
 	return 1;
 }
 
@@ -11,8 +11,7 @@ int ZoneFunctions::luaZoneCreate(lua_State* L) {
 	if (!zone) {
 		zone = Zone::addZone(name);
 	}
-	pushUserdata<Zone>(L, zone);
-	setMetatable(L, -1, "Zone");
+	pushUserdata<Zone>(L, zone, "Zone");
 	return 1;
 }
 
@@ -135,8 +134,7 @@ int ZoneFunctions::luaZoneGetCreatures(lua_State* L) {
 	int index = 0;
 	for (auto creature : creatures) {
 		index++;
-		pushUserdata<Creature>(L, creature);
-		setMetatable(L, -1, "Creature");
+		pushUserdata<Creature>(L, creature, "Creature");
 		lua_rawseti(L, -2, index);
 	}
 	return 1;
@@ -156,8 +154,7 @@ int ZoneFunctions::luaZoneGetPlayers(lua_State* L) {
 	int index = 0;
 	for (auto player : players) {
 		index++;
-		pushUserdata<Player>(L, player);
-		setMetatable(L, -1, "Player");
+		pushUserdata<Player>(L, player, "Player");
 		lua_rawseti(L, -2, index);
 	}
 	return 1;
@@ -177,8 +174,7 @@ int ZoneFunctions::luaZoneGetMonsters(lua_State* L) {
 	int index = 0;
 	for (auto monster : monsters) {
 		index++;
-		pushUserdata<Monster>(L, monster);
-		setMetatable(L, -1, "Monster");
+		pushUserdata<Monster>(L, monster, "Monster");
 		lua_rawseti(L, -2, index);
 	}
 	return 1;
@@ -198,8 +194,7 @@ int ZoneFunctions::luaZoneGetNpcs(lua_State* L) {
 	int index = 0;
 	for (auto npc : npcs) {
 		index++;
-		pushUserdata<Npc>(L, npc);
-		setMetatable(L, -1, "Npc");
+		pushUserdata<Npc>(L, npc, "Npc");
 		lua_rawseti(L, -2, index);
 	}
 	return 1;
@@ -219,8 +214,7 @@ int ZoneFunctions::luaZoneGetItems(lua_State* L) {
 	int index = 0;
 	for (auto item : items) {
 		index++;
-		pushUserdata<Item>(L, item);
-		setMetatable(L, -1, "Item");
+		pushUserdata<Item>(L, item, "Item");
 		lua_rawseti(L, -2, index);
 	}
 	return 1;
@@ -289,8 +283,7 @@ int ZoneFunctions::luaZoneGetByName(lua_State* L) {
 		lua_pushnil(L);
 		return 1;
 	}
-	pushUserdata<Zone>(L, zone);
-	setMetatable(L, -1, "Zone");
+	pushUserdata<Zone>(L, zone, "Zone");
 	return 1;
 }
 
@@ -307,8 +300,7 @@ int ZoneFunctions::luaZoneGetByPosition(lua_State* L) {
 	lua_createtable(L, static_cast<int>(zones.size()), 0);
 	for (auto zone : zones) {
 		index++;
-		pushUserdata<Zone>(L, zone);
-		setMetatable(L, -1, "Zone");
+		pushUserdata<Zone>(L, zone, "Zone");
 		lua_rawseti(L, -2, index);
 	}
 	return 1;
@@ -321,8 +313,7 @@ int ZoneFunctions::luaZoneGetAll(lua_State* L) {
 	int index = 0;
 	for (auto zone : zones) {
 		index++;
-		pushUserdata<Zone>(L, zone);
-		setMetatable(L, -1, "Zone");
+		pushUserdata<Zone>(L, zone, "Zone");
 		lua_rawseti(L, -2, index);
 	}
 	return 1;
@@ -22,14 +22,12 @@ int KVFunctions::luaKVScoped(lua_State* L) {
 	if (isUserdata(L, 1)) {
 		auto scopedKV = getUserdataShared<KV>(L, 1);
 		auto newScope = scopedKV->scoped(key);
-		pushUserdata<KV>(L, newScope);
-		setMetatable(L, -1, "KV");
+		pushUserdata<KV>(L, newScope, "KV");
 		return 1;
 	}
 
 	auto scopedKV = g_kv().scoped(key);
-	pushUserdata<KV>(L, scopedKV);
-	setMetatable(L, -1, "KV");
+	pushUserdata<KV>(L, scopedKV, "KV");
 	return 1;
 }
 
@@ -15,8 +15,7 @@
 
 int NetworkMessageFunctions::luaNetworkMessageCreate(lua_State* L) {
 	// NetworkMessage()
-	pushUserdata<NetworkMessage>(L, std::make_shared<NetworkMessage>());
-	setMetatable(L, -1, "NetworkMessage");
+	pushUserdata<NetworkMessage>(L, std::make_shared<NetworkMessage>(), "NetworkMessage");
 	return 1;
 }
 
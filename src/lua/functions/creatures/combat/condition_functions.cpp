@@ -21,8 +21,7 @@ int ConditionFunctions::luaConditionCreate(lua_State* L) {
 
 	std::shared_ptr<Condition> condition = Condition::createCondition(conditionId, conditionType, 0, 0, false, subId);
 	if (condition) {
-		pushUserdata<Condition>(L, condition);
-		setMetatable(L, -1, "Condition");
+		pushUserdata<Condition>(L, condition, "Condition");
 	} else {
 		lua_pushnil(L);
 	}
@@ -97,8 +96,7 @@ int ConditionFunctions::luaConditionClone(lua_State* L) {
 	// condition:clone()
 	std::shared_ptr<Condition> condition = getUserdataShared<Condition>(L, 1);
 	if (condition) {
-		pushUserdata<Condition>(L, condition->clone());
-		setMetatable(L, -1, "Condition");
+		pushUserdata<Condition>(L, condition->clone(), "Condition");
 	} else {
 		lua_pushnil(L);
 	}
@@ -30,8 +30,7 @@ int SpellFunctions::luaSpellCreate(lua_State* L) {
 		std::shared_ptr<RuneSpell> rune = g_spells().getRuneSpell(id);
 
 		if (rune) {
-			pushUserdata<Spell>(L, rune);
-			setMetatable(L, -1, "Spell");
+			pushUserdata<Spell>(L, rune, "Spell");
 			return 1;
 		}
 
@@ -40,20 +39,17 @@ int SpellFunctions::luaSpellCreate(lua_State* L) {
 		std::string arg = getString(L, 2);
 		std::shared_ptr<InstantSpell> instant = g_spells().getInstantSpellByName(arg);
 		if (instant) {
-			pushUserdata<Spell>(L, instant);
-			setMetatable(L, -1, "Spell");
+			pushUserdata<Spell>(L, instant, "Spell");
 			return 1;
 		}
 		instant = g_spells().getInstantSpell(arg);
 		if (instant) {
-			pushUserdata<Spell>(L, instant);
-			setMetatable(L, -1, "Spell");
+			pushUserdata<Spell>(L, instant, "Spell");
 			return 1;
 		}
 		std::shared_ptr<RuneSpell> rune = g_spells().getRuneSpellByName(arg);
 		if (rune) {
-			pushUserdata<Spell>(L, rune);
-			setMetatable(L, -1, "Spell");
+			pushUserdata<Spell>(L, rune, "Spell");
 			return 1;
 		}
 
@@ -67,14 +63,12 @@ int SpellFunctions::luaSpellCreate(lua_State* L) {
 
 	if (spellType == SPELL_INSTANT) {
 		auto spell = std::make_shared<InstantSpell>(getScriptEnv()->getScriptInterface());
-		pushUserdata<Spell>(L, spell);
-		setMetatable(L, -1, "Spell");
+		pushUserdata<Spell>(L, spell, "Spell");
 		spell->spellType = SPELL_INSTANT;
 		return 1;
 	} else if (spellType == SPELL_RUNE) {
 		auto runeSpell = std::make_shared<RuneSpell>(getScriptEnv()->getScriptInterface());
-		pushUserdata<Spell>(L, runeSpell);
-		setMetatable(L, -1, "Spell");
+		pushUserdata<Spell>(L, runeSpell, "Spell");
 		runeSpell->spellType = SPELL_RUNE;
 		return 1;
 	}
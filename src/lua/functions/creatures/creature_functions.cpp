@@ -33,8 +33,7 @@ int CreatureFunctions::luaCreatureCreate(lua_State* L) {
 	}
 
 	if (creature) {
-		pushUserdata<Creature>(L, creature);
-		setCreatureMetatable(L, -1, creature);
+		pushCreature(L, creature);
 	} else {
 		lua_pushnil(L);
 	}
@@ -209,8 +208,7 @@ int CreatureFunctions::luaCreatureGetTarget(lua_State* L) {
 
 	std::shared_ptr<Creature> target = creature->getAttackedCreature();
 	if (target) {
-		pushUserdata<Creature>(L, target);
-		setCreatureMetatable(L, -1, target);
+		pushCreature(L, target);
 	} else {
 		lua_pushnil(L);
 	}
@@ -239,8 +237,7 @@ int CreatureFunctions::luaCreatureGetFollowCreature(lua_State* L) {
 
 	std::shared_ptr<Creature> followCreature = creature->getFollowCreature();
 	if (followCreature) {
-		pushUserdata<Creature>(L, followCreature);
-		setCreatureMetatable(L, -1, followCreature);
+		pushCreature(L, followCreature);
 	} else {
 		lua_pushnil(L);
 	}
@@ -273,8 +270,7 @@ int CreatureFunctions::luaCreatureGetMaster(lua_State* L) {
 		return 1;
 	}
 
-	pushUserdata<Creature>(L, master);
-	setCreatureMetatable(L, -1, master);
+	pushCreature(L, master);
 	return 1;
 }
 
@@ -433,8 +429,7 @@ int CreatureFunctions::luaCreatureGetTile(lua_State* L) {
 
 	std::shared_ptr<Tile> tile = creature->getTile();
 	if (tile) {
-		pushUserdata<Tile>(L, tile);
-		setMetatable(L, -1, "Tile");
+		pushUserdata<Tile>(L, tile, "Tile");
 	} else {
 		lua_pushnil(L);
 	}
@@ -862,8 +857,7 @@ int CreatureFunctions::luaCreatureGetSummons(lua_State* L) {
 	int index = 0;
 	for (const auto &summon : creature->getSummons()) {
 		if (summon) {
-			pushUserdata<Creature>(L, summon);
-			setCreatureMetatable(L, -1, summon);
+			pushCreature(L, summon);
 			lua_rawseti(L, -2, ++index);
 		}
 	}
@@ -977,8 +971,7 @@ int CreatureFunctions::luaCreatureGetZones(lua_State* L) {
 	int index = 0;
 	for (auto zone : zones) {
 		index++;
-		pushUserdata<Zone>(L, zone);
-		setMetatable(L, -1, "Zone");
+		pushUserdata<Zone>(L, zone, "Zone");
 		lua_rawseti(L, -2, index);
 	}
 	return 1;
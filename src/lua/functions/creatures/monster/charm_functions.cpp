@@ -20,8 +20,7 @@ int CharmFunctions::luaCharmCreate(lua_State* L) {
 		const auto charmList = g_game().getCharmList();
 		for (const auto charm : charmList) {
 			if (charm->id == charmid) {
-				pushUserdata<Charm>(L, charm);
-				setMetatable(L, -1, "Charm");
+				pushUserdata<Charm>(L, charm, "Charm");
 				pushBoolean(L, true);
 			}
 		}
@@ -32,8 +32,7 @@ int MonsterFunctions::luaMonsterCreate(lua_State* L) {
 	}
 
 	if (monster) {
-		pushUserdata<Monster>(L, monster);
-		setMetatable(L, -1, "Monster");
+		pushUserdata<Monster>(L, monster, "Monster");
 	} else {
 		lua_pushnil(L);
 	}
@@ -50,8 +49,7 @@ int MonsterFunctions::luaMonsterGetType(lua_State* L) {
 	// monster:getType()
 	std::shared_ptr<Monster> monster = getUserdataShared<Monster>(L, 1);
 	if (monster) {
-		pushUserdata<MonsterType>(L, monster->mType);
-		setMetatable(L, -1, "MonsterType");
+		pushUserdata<MonsterType>(L, monster->mType, "MonsterType");
 	} else {
 		lua_pushnil(L);
 	}
@@ -224,8 +222,7 @@ int MonsterFunctions::luaMonsterGetFriendList(lua_State* L) {
 
 	int index = 0;
 	for (std::shared_ptr<Creature> creature : friendList) {
-		pushUserdata<Creature>(L, creature);
-		setCreatureMetatable(L, -1, creature);
+		pushCreature(L, creature);
 		lua_rawseti(L, -2, ++index);
 	}
 	return 1;
@@ -283,8 +280,7 @@ int MonsterFunctions::luaMonsterGetTargetList(lua_State* L) {
 
 	int index = 0;
 	for (std::shared_ptr<Creature> creature : targetList) {
-		pushUserdata<Creature>(L, creature);
-		setCreatureMetatable(L, -1, creature);
+		pushCreature(L, creature);
 		lua_rawseti(L, -2, ++index);
 	}
 	return 1;
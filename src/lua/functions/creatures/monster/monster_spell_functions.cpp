@@ -14,8 +14,7 @@
 
 int MonsterSpellFunctions::luaCreateMonsterSpell(lua_State* L) {
 	const auto spell = std::make_shared<MonsterSpell>();
-	pushUserdata<MonsterSpell>(L, spell);
-	setMetatable(L, -1, "MonsterSpell");
+	pushUserdata<MonsterSpell>(L, spell, "MonsterSpell");
 	return 1;
 }
 
@@ -50,8 +50,7 @@ int MonsterTypeFunctions::luaMonsterTypeCreate(lua_State* L) {
 	}
 
 	if (monsterType) {
-		pushUserdata<MonsterType>(L, monsterType);
-		setMetatable(L, -1, "MonsterType");
+		pushUserdata<MonsterType>(L, monsterType, "MonsterType");
 	} else {
 		lua_pushnil(L);
 	}
@@ -37,8 +37,7 @@ int NpcFunctions::luaNpcCreate(lua_State* L) {
 	}
 
 	if (npc) {
-		pushUserdata<Npc>(L, npc);
-		setMetatable(L, -1, "Npc");
+		pushUserdata<Npc>(L, npc, "Npc");
 	} else {
 		lua_pushnil(L);
 	}
@@ -154,8 +153,7 @@ int NpcFunctions::luaNpcPlace(lua_State* L) {
 	bool extended = getBoolean(L, 3, false);
 	bool force = getBoolean(L, 4, true);
 	if (g_game().placeCreature(npc, position, extended, force)) {
-		pushUserdata<Npc>(L, npc);
-		setMetatable(L, -1, "Npc");
+		pushUserdata<Npc>(L, npc, "Npc");
 	} else {
 		lua_pushnil(L);
 	}
@@ -38,8 +38,7 @@ void NpcTypeFunctions::createNpcTypeShopLuaTable(lua_State* L, const std::vector
 int NpcTypeFunctions::luaNpcTypeCreate(lua_State* L) {
 	// NpcType(name)
 	const auto &npcType = g_npcs().getNpcType(getString(L, 1), true);
-	pushUserdata<NpcType>(L, npcType);
-	setMetatable(L, -1, "NpcType");
+	pushUserdata<NpcType>(L, npcType, "NpcType");
 	return 1;
 }
 
@@ -14,8 +14,7 @@
 
 int ShopFunctions::luaCreateShop(lua_State* L) {
 	// Shop() will create a new shop item
-	pushUserdata<Shop>(L, std::make_shared<Shop>());
-	setMetatable(L, -1, "Shop");
+	pushUserdata<Shop>(L, std::make_shared<Shop>(), "Shop");
 	return 1;
 }
 
@@ -19,8 +19,7 @@ int GroupFunctions::luaGroupCreate(lua_State* L) {
 
 	Group* group = g_game().groups.getGroup(id);
 	if (group) {
-		pushUserdata<Group>(L, group);
-		setMetatable(L, -1, "Group");
+		pushUserdata<Group>(L, group, "Group");
 	} else {
 		lua_pushnil(L);
 	}
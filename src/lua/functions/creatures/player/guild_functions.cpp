@@ -17,8 +17,7 @@ int GuildFunctions::luaGuildCreate(lua_State* L) {
 	uint32_t id = getNumber<uint32_t>(L, 2);
 	const auto guild = g_game().getGuild(id);
 	if (guild) {
-		pushUserdata<Guild>(L, guild);
-		setMetatable(L, -1, "Guild");
+		pushUserdata<Guild>(L, guild, "Guild");
 	} else {
 		lua_pushnil(L);
 	}
@@ -59,8 +58,7 @@ int GuildFunctions::luaGuildGetMembersOnline(lua_State* L) {
 
 	int index = 0;
 	for (std::shared_ptr<Player> player : members) {
-		pushUserdata<Player>(L, player);
-		setMetatable(L, -1, "Player");
+		pushUserdata<Player>(L, player, "Player");
 		lua_rawseti(L, -2, ++index);
 	}
 	return 1;
@@ -26,8 +26,7 @@ int MountFunctions::luaCreateMount(lua_State* L) {
 	}
 
 	if (mount) {
-		pushUserdata<Mount>(L, mount);
-		setMetatable(L, -1, "Mount");
+		pushUserdata<Mount>(L, mount, "Mount");
 	} else {
 		lua_pushnil(L);
 	}
@@ -27,8 +27,7 @@ int32_t PartyFunctions::luaPartyCreate(lua_State* L) {
 		party = Party::create(player);
 		g_game().updatePlayerShield(player);
 		player->sendCreatureSkull(player);
-		pushUserdata<Party>(L, party);
-		setMetatable(L, -1, "Party");
+		pushUserdata<Party>(L, party, "Party");
 	} else {
 		lua_pushnil(L);
 	}
@@ -59,8 +58,7 @@ int PartyFunctions::luaPartyGetLeader(lua_State* L) {
 
 	std::shared_ptr<Player> leader = party->getLeader();
 	if (leader) {
-		pushUserdata<Player>(L, leader);
-		setMetatable(L, -1, "Player");
+		pushUserdata<Player>(L, leader, "Player");
 	} else {
 		lua_pushnil(L);
 	}
@@ -90,8 +88,7 @@ int PartyFunctions::luaPartyGetMembers(lua_State* L) {
 	int index = 0;
 	lua_createtable(L, party->getMemberCount(), 0);
 	for (std::shared_ptr<Player> player : party->getMembers()) {
-		pushUserdata<Player>(L, player);
-		setMetatable(L, -1, "Player");
+		pushUserdata<Player>(L, player, "Player");
 		lua_rawseti(L, -2, ++index);
 	}
 	return 1;
@@ -116,8 +113,7 @@ int PartyFunctions::luaPartyGetInvitees(lua_State* L) {
 
 		int index = 0;
 		for (std::shared_ptr<Player> player : party->getInvitees()) {
-			pushUserdata<Player>(L, player);
-			setMetatable(L, -1, "Player");
+			pushUserdata<Player>(L, player, "Player");
 			lua_rawseti(L, -2, ++index);
 		}
 	} else {
@@ -137,8 +137,7 @@ int PlayerFunctions::luaPlayerCreate(lua_State* L) {
 	}
 
 	if (player) {
-		pushUserdata<Player>(L, player);
-		setMetatable(L, -1, "Player");
+		pushUserdata<Player>(L, player, "Player");
 	} else {
 		lua_pushnil(L);
 	}
@@ -349,8 +348,7 @@ int PlayerFunctions::luaPlayergetCharmMonsterType(lua_State* L) {
 		if (raceid > 0) {
 			const auto mtype = g_monsters().getMonsterTypeByRaceId(raceid);
 			if (mtype) {
-				pushUserdata<MonsterType>(L, mtype);
-				setMetatable(L, -1, "MonsterType");
+				pushUserdata<MonsterType>(L, mtype, "MonsterType");
 			} else {
 				lua_pushnil(L);
 			}
@@ -653,8 +651,7 @@ int PlayerFunctions::luaPlayerGetReward(lua_State* L) {
 	uint64_t rewardId = getNumber<uint64_t>(L, 2);
 	bool autoCreate = getBoolean(L, 3, false);
 	if (auto reward = player->getReward(rewardId, autoCreate)) {
-		pushUserdata<Item>(L, reward);
-		setItemMetatable(L, -1, reward);
+		pushItem(L, reward);
 	} else {
 		pushBoolean(L, false);
 	}
@@ -719,8 +716,7 @@ int PlayerFunctions::luaPlayerGetDepotLocker(lua_State* L) {
 	std::shared_ptr<DepotLocker> depotLocker = player->getDepotLocker(depotId);
 	if (depotLocker) {
 		depotLocker->setParent(player);
-		pushUserdata<Item>(L, depotLocker);
-		setItemMetatable(L, -1, depotLocker);
+		pushItem(L, depotLocker);
 	} else {
 		pushBoolean(L, false);
 	}
@@ -752,8 +748,7 @@ int PlayerFunctions::luaPlayerGetDepotChest(lua_State* L) {
 	std::shared_ptr<DepotChest> depotChest = player->getDepotChest(depotId, autoCreate);
 	if (depotChest) {
 		player->setLastDepotId(depotId);
-		pushUserdata<Item>(L, depotChest);
-		setItemMetatable(L, -1, depotChest);
+		pushItem(L, depotChest);
 	} else {
 		pushBoolean(L, false);
 	}
@@ -770,8 +765,7 @@ int PlayerFunctions::luaPlayerGetInbox(lua_State* L) {
 
 	std::shared_ptr<Inbox> inbox = player->getInbox();
 	if (inbox) {
-		pushUserdata<Item>(L, inbox);
-		setItemMetatable(L, -1, inbox);
+		pushItem(L, inbox);
 	} else {
 		pushBoolean(L, false);
 	}
@@ -1335,8 +1329,7 @@ int PlayerFunctions::luaPlayerGetItemById(lua_State* L) {
 
 	std::shared_ptr<Item> item = g_game().findItemOfType(player, itemId, deepSearch, subType);
 	if (item) {
-		pushUserdata<Item>(L, item);
-		setItemMetatable(L, -1, item);
+		pushItem(L, item);
 	} else {
 		lua_pushnil(L);
 	}
@@ -1347,8 +1340,7 @@ int PlayerFunctions::luaPlayerGetVocation(lua_State* L) {
 	// player:getVocation()
 	std::shared_ptr<Player> player = getUserdataShared<Player>(L, 1);
 	if (player) {
-		pushUserdata<Vocation>(L, player->getVocation());
-		setMetatable(L, -1, "Vocation");
+		pushUserdata<Vocation>(L, player->getVocation(), "Vocation");
 	} else {
 		lua_pushnil(L);
 	}
@@ -1452,8 +1444,7 @@ int PlayerFunctions::luaPlayerGetTown(lua_State* L) {
 	// player:getTown()
 	std::shared_ptr<Player> player = getUserdataShared<Player>(L, 1);
 	if (player) {
-		pushUserdata<Town>(L, player->getTown());
-		setMetatable(L, -1, "Town");
+		pushUserdata<Town>(L, player->getTown(), "Town");
 	} else {
 		lua_pushnil(L);
 	}
@@ -1492,8 +1483,7 @@ int PlayerFunctions::luaPlayerGetGuild(lua_State* L) {
 		return 1;
 	}
 
-	pushUserdata<Guild>(L, guild);
-	setMetatable(L, -1, "Guild");
+	pushUserdata<Guild>(L, guild, "Guild");
 	return 1;
 }
 
@@ -1571,8 +1561,7 @@ int PlayerFunctions::luaPlayerGetGroup(lua_State* L) {
 	// player:getGroup()
 	std::shared_ptr<Player> player = getUserdataShared<Player>(L, 1);
 	if (player) {
-		pushUserdata<Group>(L, player->getGroup());
-		setMetatable(L, -1, "Group");
+		pushUserdata<Group>(L, player->getGroup(), "Group");
 	} else {
 		lua_pushnil(L);
 	}
@@ -1730,6 +1719,23 @@ int PlayerFunctions::luaPlayerSetStorageValue(lua_State* L) {
 	return 1;
 }
 
+int PlayerFunctions::luaPlayerGetStorageValueRange(lua_State* L) {
+	// player:getStorageValueRange(firstKey, lastKey)
+	const auto player = getUserdataShared<Player>(L, 1);
+	if (!player) {
+		lua_pushnil(L);
+		return 1;
+	}
+
+	const auto values = player->getStorageValues(getNumber<uint32_t>(L, 2), getNumber<uint32_t>(L, 3));
+	lua_createtable(L, 0, static_cast<int>(values.size()));
+	for (const auto &[key, value] : values) {
+		lua_pushnumber(L, value);
+		lua_rawseti(L, -2, static_cast<int>(key));
+	}
+	return 1;
+}
+
 int PlayerFunctions::luaPlayerGetStorageValueByName(lua_State* L) {
 	// player:getStorageValueByName(name)
 	std::shared_ptr<Player> player = getUserdataShared<Player>(L, 1);
@@ -1839,12 +1845,10 @@ int PlayerFunctions::luaPlayerAddItem(lua_State* L) {
 
 		if (hasTable) {
 			lua_pushnumber(L, i);
-			pushUserdata<Item>(L, item);
-			setItemMetatable(L, -1, item);
+			pushItem(L, item);
 			lua_settable(L, -3);
 		} else {
-			pushUserdata<Item>(L, item);
-			setItemMetatable(L, -1, item);
+			pushItem(L, item);
 		}
 	}
 	return 1;
@@ -2197,8 +2201,7 @@ int PlayerFunctions::luaPlayerGetSlotItem(lua_State* L) {
 
 	std::shared_ptr<Item> item = thing->getItem();
 	if (item) {
-		pushUserdata<Item>(L, item);
-		setItemMetatable(L, -1, item);
+		pushItem(L, item);
 	} else {
 		lua_pushnil(L);
 	}
@@ -2215,8 +2218,7 @@ int PlayerFunctions::luaPlayerGetParty(lua_State* L) {
 
 	std::shared_ptr<Party> party = player->getParty();
 	if (party) {
-		pushUserdata<Party>(L, party);
-		setMetatable(L, -1, "Party");
+		pushUserdata<Party>(L, party, "Party");
 	} else {
 		lua_pushnil(L);
 	}
@@ -2895,8 +2897,7 @@ int PlayerFunctions::luaPlayerGetHouse(lua_State* L) {
 
 	const auto &house = g_game().map.houses.getHouseByPlayerId(player->getGUID());
 	if (house) {
-		pushUserdata<House>(L, house);
-		setMetatable(L, -1, "House");
+		pushUserdata<House>(L, house, "House");
 	} else {
 		lua_pushnil(L);
 	}
@@ -3021,8 +3022,7 @@ int PlayerFunctions::luaPlayerGetContainerById(lua_State* L) {
 
 	std::shared_ptr<Container> container = player->getContainerByID(getNumber<uint8_t>(L, 2));
 	if (container) {
-		pushUserdata<Container>(L, container);
-		setMetatable(L, -1, "Container");
+		pushUserdata<Container>(L, container, "Container");
 	} else {
 		lua_pushnil(L);
 	}
@@ -4102,7 +4102,6 @@ int PlayerFunctions::luaPlayerKV(lua_State* L) {
 		return 1;
 	}
 
-	pushUserdata<KV>(L, player->kv());
-	setMetatable(L, -1, "KV");
+	pushUserdata<KV>(L, player->kv(), "KV");
 	return 1;
 }
@@ -169,6 +169,7 @@ private:
 
 		registerMethod(L, "Player", "getStorageValue", PlayerFunctions::luaPlayerGetStorageValue);
 		registerMethod(L, "Player", "setStorageValue", PlayerFunctions::luaPlayerSetStorageValue);
+		registerMethod(L, "Player", "getStorageValueRange", PlayerFunctions::luaPlayerGetStorageValueRange);
 
 		registerMethod(L, "Player", "getStorageValueByName", PlayerFunctions::luaPlayerGetStorageValueByName);
 		registerMethod(L, "Player", "setStorageValueByName", PlayerFunctions::luaPlayerSetStorageValueByName);
@@ -510,6 +511,7 @@ private:
 
 	static int luaPlayerGetStorageValue(lua_State* L);
 	static int luaPlayerSetStorageValue(lua_State* L);
+	static int luaPlayerGetStorageValueRange(lua_State* L);
 	static int luaPlayerGetStorageValueByName(lua_State* L);
 	static int luaPlayerSetStorageValueByName(lua_State* L);
 
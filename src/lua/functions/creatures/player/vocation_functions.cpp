@@ -23,8 +23,7 @@ int VocationFunctions::luaVocationCreate(lua_State* L) {
 
 	Vocation* vocation = g_vocations().getVocation(vocationId);
 	if (vocation) {
-		pushUserdata<Vocation>(L, vocation);
-		setMetatable(L, -1, "Vocation");
+		pushUserdata<Vocation>(L, vocation, "Vocation");
 	} else {
 		lua_pushnil(L);
 	}
@@ -259,8 +258,7 @@ int VocationFunctions::luaVocationGetDemotion(lua_State* L) {
 
 	Vocation* demotedVocation = g_vocations().getVocation(fromId);
 	if (demotedVocation && demotedVocation != vocation) {
-		pushUserdata<Vocation>(L, demotedVocation);
-		setMetatable(L, -1, "Vocation");
+		pushUserdata<Vocation>(L, demotedVocation, "Vocation");
 	} else {
 		lua_pushnil(L);
 	}
@@ -283,8 +281,7 @@ int VocationFunctions::luaVocationGetPromotion(lua_State* L) {
 
 	Vocation* promotedVocation = g_vocations().getVocation(promotedId);
 	if (promotedVocation && promotedVocation != vocation) {
-		pushUserdata<Vocation>(L, promotedVocation);
-		setMetatable(L, -1, "Vocation");
+		pushUserdata<Vocation>(L, promotedVocation, "Vocation");
 	} else {
 		lua_pushnil(L);
 	}
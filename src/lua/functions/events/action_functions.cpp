@@ -17,8 +17,7 @@
 int ActionFunctions::luaCreateAction(lua_State* L) {
 	// Action()
 	auto action = std::make_shared<Action>(getScriptEnv()->getScriptInterface());
-	pushUserdata<Action>(L, action);
-	setMetatable(L, -1, "Action");
+	pushUserdata<Action>(L, action, "Action");
 	return 1;
 }
 
@@ -17,8 +17,7 @@ int CreatureEventFunctions::luaCreateCreatureEvent(lua_State* L) {
 	// CreatureEvent(eventName)
 	auto creatureEvent = std::make_shared<CreatureEvent>(getScriptEnv()->getScriptInterface());
 	creatureEvent->setName(getString(L, 2));
-	pushUserdata<CreatureEvent>(L, creatureEvent);
-	setMetatable(L, -1, "CreatureEvent");
+	pushUserdata<CreatureEvent>(L, creatureEvent, "CreatureEvent");
 	return 1;
 }
 
@@ -35,8 +35,7 @@ void EventCallbackFunctions::init(lua_State* luaState) {
 
 int EventCallbackFunctions::luaEventCallbackCreate(lua_State* luaState) {
 	const auto eventCallback = std::make_shared<EventCallback>(getScriptEnv()->getScriptInterface());
-	pushUserdata<EventCallback>(luaState, eventCallback);
-	setMetatable(luaState, -1, "EventCallback");
+	pushUserdata<EventCallback>(luaState, eventCallback, "EventCallback");
 	return 1;
 }
 
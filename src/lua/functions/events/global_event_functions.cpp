@@ -19,8 +19,7 @@ int GlobalEventFunctions::luaCreateGlobalEvent(lua_State* L) {
 	const auto global = std::make_shared<GlobalEvent>(getScriptEnv()->getScriptInterface());
 	global->setName(getString(L, 2));
 	global->setEventType(GLOBALEVENT_NONE);
-	pushUserdata<GlobalEvent>(L, global);
-	setMetatable(L, -1, "GlobalEvent");
+	pushUserdata<GlobalEvent>(L, global, "GlobalEvent");
 	return 1;
 }
 
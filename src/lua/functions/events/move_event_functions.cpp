@@ -16,8 +16,7 @@
 int MoveEventFunctions::luaCreateMoveEvent(lua_State* L) {
 	// MoveEvent()
 	const auto moveevent = std::make_shared<MoveEvent>(getScriptEnv()->getScriptInterface());
-	pushUserdata<MoveEvent>(L, moveevent);
-	setMetatable(L, -1, "MoveEvent");
+	pushUserdata<MoveEvent>(L, moveevent, "MoveEvent");
 	return 1;
 }
 
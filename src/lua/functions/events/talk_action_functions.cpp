@@ -22,8 +22,7 @@ int TalkActionFunctions::luaCreateTalkAction(lua_State* L) {
 
 	auto talkactionSharedPtr = std::make_shared<TalkAction>(getScriptEnv()->getScriptInterface());
 	talkactionSharedPtr->setWords(wordsVector);
-	pushUserdata<TalkAction>(L, talkactionSharedPtr);
-	setMetatable(L, -1, "TalkAction");
+	pushUserdata<TalkAction>(L, talkactionSharedPtr, "TalkAction");
 	return 1;
 }
 
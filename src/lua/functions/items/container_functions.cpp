@@ -19,8 +19,7 @@ int ContainerFunctions::luaContainerCreate(lua_State* L) {
 
 	std::shared_ptr<Container> container = getScriptEnv()->getContainerByUID(id);
 	if (container) {
-		pushUserdata(L, container);
-		setMetatable(L, -1, "Container");
+		pushUserdata(L, container, "Container");
 	} else {
 		lua_pushnil(L);
 	}
@@ -92,8 +91,7 @@ int ContainerFunctions::luaContainerGetItem(lua_State* L) {
 	uint32_t index = getNumber<uint32_t>(L, 2);
 	std::shared_ptr<Item> item = container->getItemByIndex(index);
 	if (item) {
-		pushUserdata<Item>(L, item);
-		setItemMetatable(L, -1, item);
+		pushItem(L, item);
 	} else {
 		lua_pushnil(L);
 	}
@@ -151,8 +149,7 @@ int ContainerFunctions::luaContainerAddItem(lua_State* L) {
 
 	ReturnValue ret = g_game().internalAddItem(container, item, index, flags);
 	if (ret == RETURNVALUE_NOERROR) {
-		pushUserdata<Item>(L, item);
-		setItemMetatable(L, -1, item);
+		pushItem(L, item);
 	} else {
 		reportErrorFunc(fmt::format("Cannot add item to container, error code: '{}'", getReturnMessage(ret)));
 	}
@@ -251,8 +248,7 @@ int ContainerFunctions::luaContainerGetItems(lua_State* L) {
 	int index = 0;
 	for (std::shared_ptr<Item> item : items) {
 		index++;
-		pushUserdata(L, item);
-		setItemMetatable(L, -1, item);
+		pushItem(L, item);
 		lua_rawseti(L, -2, index);
 	}
 	return 1;
@@ -19,8 +19,7 @@ int ImbuementFunctions::luaCreateImbuement(lua_State* L) {
 	Imbuement* imbuement = g_imbuements().getImbuement(imbuementId);
 
 	if (imbuement) {
-		pushUserdata<Imbuement>(L, imbuement);
-		setMetatable(L, -1, "Imbuement");
+		pushUserdata<Imbuement>(L, imbuement, "Imbuement");
 	} else {
 		lua_pushnil(L);
 	}
@@ -17,8 +17,7 @@ int ItemClassificationFunctions::luaItemClassificationCreate(lua_State* L) {
 	if (isNumber(L, 2)) {
 		const ItemClassification* itemClassification = g_game().getItemsClassification(getNumber<uint8_t>(L, 2), false);
 		if (itemClassification) {
-			pushUserdata<const ItemClassification>(L, itemClassification);
-			setMetatable(L, -1, "ItemClassification");
+			pushUserdata<const ItemClassification>(L, itemClassification, "ItemClassification");
 			pushBoolean(L, true);
 		}
 	}
@@ -25,8 +25,7 @@ int ItemFunctions::luaItemCreate(lua_State* L) {
 
 	std::shared_ptr<Item> item = getScriptEnv()->getItemByUID(id);
 	if (item) {
-		pushUserdata<Item>(L, item);
-		setItemMetatable(L, -1, item);
+		pushItem(L, item);
 	} else {
 		lua_pushnil(L);
 	}
@@ -103,8 +102,7 @@ int ItemFunctions::luaItemClone(lua_State* L) {
 	getScriptEnv()->addTempItem(clone);
 	clone->setParent(VirtualCylinder::virtualCylinder);
 
-	pushUserdata<Item>(L, clone);
-	setItemMetatable(L, -1, clone);
+	pushItem(L, clone);
 	return 1;
 }
 
@@ -150,8 +148,7 @@ int ItemFunctions::luaItemSplit(lua_State* L) {
 	splitItem->setParent(VirtualCylinder::virtualCylinder);
 	env->addTempItem(splitItem);
 
-	pushUserdata<Item>(L, splitItem);
-	setItemMetatable(L, -1, splitItem);
+	pushItem(L, splitItem);
 	return 1;
 }
 
@@ -316,8 +313,7 @@ int ItemFunctions::luaItemGetTile(lua_State* L) {
 
 	std::shared_ptr<Tile> tile = item->getTile();
 	if (tile) {
-		pushUserdata<Tile>(L, tile);
-		setMetatable(L, -1, "Tile");
+		pushUserdata<Tile>(L, tile, "Tile");
 	} else {
 		lua_pushnil(L);
 	}
@@ -403,6 +399,9 @@ int ItemFunctions::luaItemSetAttribute(lua_State* L) {
 				} else {
 					g_decay().startDecay(item);
 				}
+				if (const auto tile = item->getTile()) {
+					tile->invalidateItemsEncoding();
+				}
 				pushBoolean(L, true);
 				return 1;
 			}
@@ -410,6 +409,10 @@ int ItemFunctions::luaItemSetAttribute(lua_State* L) {
 				item->setDecaying(DECAYING_PENDING);
 				item->setDuration(getNumber<int32_t>(L, 3));
 				g_decay().startDecay(item);
+				// The duration and decay state are part of the tile description sent to clients
+				if (const auto tile = item->getTile()) {
+					tile->invalidateItemsEncoding();
+				}
 				pushBoolean(L, true);
 				return 1;
 			}
@@ -458,6 +461,9 @@ int ItemFunctions::luaItemRemoveAttribute(lua_State* L) {
 		ret = (attribute != ItemAttribute_t::DURATION_TIMESTAMP);
 		if (ret) {
 			item->removeAttribute(attribute);
+			if (const auto tile = item->getTile()) {
+				tile->invalidateItemsEncoding();
+			}
 		} else {
 			reportErrorFunc("Attempt to erase protected key \"duration timestamp\"");
 		}
@@ -531,6 +537,9 @@ int ItemFunctions::luaItemSetCustomAttribute(lua_State* L) {
 		return 1;
 	}
 
+	if (const auto tile = item->getTile()) {
+		tile->invalidateItemsEncoding();
+	}
 	pushBoolean(L, true);
 	return 1;
 }
@@ -549,6 +558,11 @@ int ItemFunctions::luaItemRemoveCustomAttribute(lua_State* L) {
 		pushBoolean(L, item->removeCustomAttribute(getString(L, 2)));
 	} else {
 		lua_pushnil(L);
+		return 1;
+	}
+
+	if (const auto tile = item->getTile()) {
+		tile->invalidateItemsEncoding();
 	}
 	return 1;
 }
@@ -770,8 +784,7 @@ int ItemFunctions::luaItemGetImbuement(lua_State* L) {
 			continue;
 		}
 
-		pushUserdata<Imbuement>(L, imbuement);
-		setMetatable(L, -1, "Imbuement");
+		pushUserdata<Imbuement>(L, imbuement, "Imbuement");
 
 		lua_createtable(L, 0, 3);
 		setField(L, "id", imbuement->getID());
@@ -882,6 +895,9 @@ int ItemFunctions::luaItemSetTier(lua_State* L) {
 	}
 
 	item->setTier(getNumber<uint8_t>(L, 2));
+	if (const auto tile = item->getTile()) {
+		tile->invalidateItemsEncoding();
+	}
 	pushBoolean(L, true);
 	return 1;
 }
@@ -23,8 +23,7 @@ int ItemTypeFunctions::luaItemTypeCreate(lua_State* L) {
 	}
 
 	const ItemType &itemType = Item::items[id];
-	pushUserdata<const ItemType>(L, &itemType);
-	setMetatable(L, -1, "ItemType");
+	pushUserdata<const ItemType>(L, &itemType, "ItemType");
 	return 1;
 }
 
@@ -25,8 +25,7 @@ int WeaponFunctions::luaCreateWeapon(lua_State* L) {
 		case WEAPON_AXE:
 		case WEAPON_CLUB: {
 			if (auto weaponPtr = g_luaEnvironment().createWeaponObject<WeaponMelee>(getScriptEnv()->getScriptInterface())) {
-				pushUserdata<WeaponMelee>(L, weaponPtr);
-				setMetatable(L, -1, "Weapon");
+				pushUserdata<WeaponMelee>(L, weaponPtr, "Weapon");
 				weaponPtr->weaponType = type;
 			} else {
 				lua_pushnil(L);
@@ -37,8 +36,7 @@ int WeaponFunctions::luaCreateWeapon(lua_State* L) {
 		case WEAPON_DISTANCE:
 		case WEAPON_AMMO: {
 			if (auto weaponPtr = g_luaEnvironment().createWeaponObject<WeaponDistance>(getScriptEnv()->getScriptInterface())) {
-				pushUserdata<WeaponDistance>(L, weaponPtr);
-				setMetatable(L, -1, "Weapon");
+				pushUserdata<WeaponDistance>(L, weaponPtr, "Weapon");
 				weaponPtr->weaponType = type;
 			} else {
 				lua_pushnil(L);
@@ -47,8 +45,7 @@ int WeaponFunctions::luaCreateWeapon(lua_State* L) {
 		}
 		case WEAPON_WAND: {
 			if (auto weaponPtr = g_luaEnvironment().createWeaponObject<WeaponWand>(getScriptEnv()->getScriptInterface())) {
-				pushUserdata<WeaponWand>(L, weaponPtr);
-				setMetatable(L, -1, "Weapon");
+				pushUserdata<WeaponWand>(L, weaponPtr, "Weapon");
 				weaponPtr->weaponType = type;
 			} else {
 				lua_pushnil(L);
@@ -25,15 +25,25 @@
 #include "lua/functions/lua_functions_loader.hpp"
 #include "lua/functions/map/map_functions.hpp"
 #include "lua/functions/core/game/zone_functions.hpp"
+#include "config/configmanager.hpp"
+#include "lib/metrics/metrics.hpp"
 
 class LuaScriptInterface;
 
+namespace {
+	// Registry refs are only valid in the state they were created in, load() resets them
+	lua_State* cacheState = nullptr;
+	phmap::flat_hash_map<std::string, int> metatableRefs;
+	int userdataCacheRef = LUA_NOREF;
+}
+
 void LuaFunctionsLoader::load(lua_State* L) {
 	if (!L) {
 		g_game().dieSafely("Invalid lua state, cannot load lua functions.");
 	}
 
 	luaL_openlibs(L);
+	resetUserdataCache(L);
 
 	CoreFunctions::init(L);
 	CreatureFunctions::init(L);
@@ -167,11 +177,9 @@ void LuaFunctionsLoader::pushThing(lua_State* L, std::shared_ptr<Thing> thing) {
 	}
 
 	if (std::shared_ptr<Item> item = thing->getItem()) {
-		pushUserdata<Item>(L, item);
-		setItemMetatable(L, -1, item);
+		pushItem(L, item);
 	} else if (std::shared_ptr<Creature> creature = thing->getCreature()) {
-		pushUserdata<Creature>(L, creature);
-		setCreatureMetatable(L, -1, creature);
+		pushCreature(L, creature);
 	} else {
 		lua_pushnil(L);
 	}
@@ -183,14 +191,11 @@ void LuaFunctionsLoader::pushCylinder(lua_State* L, std::shared_ptr<Cylinder> cy
 	}
 
 	if (std::shared_ptr<Creature> creature = cylinder->getCreature()) {
-		pushUserdata<Creature>(L, creature);
-		setCreatureMetatable(L, -1, creature);
+		pushCreature(L, creature);
 	} else if (std::shared_ptr<Item> parentItem = cylinder->getItem()) {
-		pushUserdata<Item>(L, parentItem);
-		setItemMetatable(L, -1, parentItem);
+		pushItem(L, parentItem);
 	} else if (std::shared_ptr<Tile> tile = cylinder->getTile()) {
-		pushUserdata<Tile>(L, tile);
-		setMetatable(L, -1, "Tile");
+		pushUserdata<Tile>(L, tile, "Tile");
 	} else if (cylinder == VirtualCylinder::virtualCylinder) {
 		pushBoolean(L, true);
 	} else {
@@ -229,26 +234,26 @@ int32_t LuaFunctionsLoader::popCallback(lua_State* L) {
 }
 
 // Metatables
-void LuaFunctionsLoader::setMetatable(lua_State* L, int32_t index, const std::string &name) {
+void LuaFunctionsLoader::setMetatable(lua_State* L, int32_t index, std::string_view name) {
 	if (validateDispatcherContext(__FUNCTION__)) {
 		return;
 	}
 
-	luaL_getmetatable(L, name.c_str());
+	pushMetatable(L, name);
 	lua_setmetatable(L, index - 1);
 }
 
-void LuaFunctionsLoader::setWeakMetatable(lua_State* L, int32_t index, const std::string &name) {
+void LuaFunctionsLoader::setWeakMetatable(lua_State* L, int32_t index, std::string_view name) {
 	if (validateDispatcherContext(__FUNCTION__)) {
 		return;
 	}
 
-	static std::set<std::string> weakObjectTypes;
-	const std::string &weakName = name + "_weak";
+	static std::set<std::string, std::less<>> weakObjectTypes;
+	const std::string weakName = fmt::format("{}_weak", name);
 
 	auto result = weakObjectTypes.emplace(name);
 	if (result.second) {
-		luaL_getmetatable(L, name.c_str());
+		pushMetatable(L, name);
 		int childMetatable = lua_gettop(L);
 
 		luaL_newmetatable(L, weakName.c_str());
@@ -271,39 +276,116 @@ void LuaFunctionsLoader::setWeakMetatable(lua_State* L, int32_t index, const std
 
 		lua_remove(L, childMetatable);
 	} else {
-		luaL_getmetatable(L, weakName.c_str());
+		pushMetatable(L, weakName);
 	}
 	lua_setmetatable(L, index - 1);
 }
 
-void LuaFunctionsLoader::setItemMetatable(lua_State* L, int32_t index, std::shared_ptr<Item> item) {
-	if (validateDispatcherContext(__FUNCTION__)) {
-		return;
+void LuaFunctionsLoader::pushCreature(lua_State* L, const std::shared_ptr<Creature> &creature) {
+	if (creature && creature->getPlayer()) {
+		pushUserdata<Creature>(L, creature, "Player");
+	} else if (creature && creature->getMonster()) {
+		pushUserdata<Creature>(L, creature, "Monster");
+	} else {
+		pushUserdata<Creature>(L, creature, "Npc");
 	}
+}
 
+void LuaFunctionsLoader::pushItem(lua_State* L, const std::shared_ptr<Item> &item) {
 	if (item && item->getContainer()) {
-		luaL_getmetatable(L, "Container");
+		pushUserdata<Item>(L, item, "Container");
 	} else if (item && item->getTeleport()) {
-		luaL_getmetatable(L, "Teleport");
+		pushUserdata<Item>(L, item, "Teleport");
 	} else {
-		luaL_getmetatable(L, "Item");
+		pushUserdata<Item>(L, item, "Item");
 	}
-	lua_setmetatable(L, index - 1);
 }
 
-void LuaFunctionsLoader::setCreatureMetatable(lua_State* L, int32_t index, std::shared_ptr<Creature> creature) {
-	if (validateDispatcherContext(__FUNCTION__)) {
-		return;
+int LuaFunctionsLoader::getMetatableRef(lua_State* L, std::string_view name) {
+	// States (or coroutines) this loader did not set up look the metatable up by name
+	if (L != cacheState) {
+		return LUA_NOREF;
 	}
 
-	if (creature && creature->getPlayer()) {
-		luaL_getmetatable(L, "Player");
-	} else if (creature && creature->getMonster()) {
-		luaL_getmetatable(L, "Monster");
+	if (const auto it = metatableRefs.find(name); it != metatableRefs.end()) {
+		return it->second;
+	}
+
+	luaL_getmetatable(L, std::string(name).c_str());
+	if (lua_isnil(L, -1)) {
+		lua_pop(L, 1);
+		return LUA_NOREF;
+	}
+
+	const int ref = luaL_ref(L, LUA_REGISTRYINDEX);
+	metatableRefs.emplace(name, ref);
+	return ref;
+}
+
+void LuaFunctionsLoader::pushMetatable(lua_State* L, std::string_view name) {
+	if (const int ref = getMetatableRef(L, name); ref != LUA_NOREF) {
+		lua_rawgeti(L, LUA_REGISTRYINDEX, ref);
 	} else {
-		luaL_getmetatable(L, "Npc");
+		luaL_getmetatable(L, std::string(name).c_str());
 	}
-	lua_setmetatable(L, index - 1);
+}
+
+bool LuaFunctionsLoader::pushCachedUserdata(lua_State* L, const void* object, int metatableRef) {
+	static auto &reused = g_metrics().counter("canary_lua_userdata_reused_total", "Pushes of a game object that reused its cached userdata");
+
+	if (metatableRef == LUA_NOREF || !g_configManager().getBoolean(LUA_USERDATA_CACHE)) {
+		return false;
+	}
+
+	lua_rawgeti(L, LUA_REGISTRYINDEX, userdataCacheRef);
+	lua_pushlightuserdata(L, const_cast<void*>(object));
+	lua_rawget(L, -2);
+	// cache, userdata or nil
+	if (lua_type(L, -1) == LUA_TUSERDATA && lua_getmetatable(L, -1) != 0) {
+		lua_rawgeti(L, LUA_REGISTRYINDEX, metatableRef);
+		const bool sameMetatable = lua_rawequal(L, -1, -2) != 0;
+		lua_pop(L, 2);
+		if (sameMetatable) {
+			lua_remove(L, -2);
+			reused.add();
+			return true;
+		}
+	}
+
+	lua_pop(L, 2);
+	return false;
+}
+
+void LuaFunctionsLoader::cacheUserdata(lua_State* L, const void* object, int metatableRef) {
+	if (metatableRef == LUA_NOREF || !g_configManager().getBoolean(LUA_USERDATA_CACHE)) {
+		return;
+	}
+
+	// userdata
+	lua_rawgeti(L, LUA_REGISTRYINDEX, userdataCacheRef);
+	lua_pushlightuserdata(L, const_cast<void*>(object));
+	lua_pushvalue(L, -3);
+	// userdata, cache, object, userdata
+	lua_rawset(L, -3);
+	lua_pop(L, 1);
+}
+
+void LuaFunctionsLoader::resetUserdataCache(lua_State* L) {
+	cacheState = L;
+	metatableRefs.clear();
+
+	// Values are weak, a userdata leaves the cache once Lua collects it
+	lua_newtable(L);
+	lua_newtable(L);
+	lua_pushstring(L, "v");
+	lua_setfield(L, -2, "__mode");
+	lua_setmetatable(L, -2);
+	userdataCacheRef = luaL_ref(L, LUA_REGISTRYINDEX);
+}
+
+void LuaFunctionsLoader::onUserdataAllocated() {
+	static auto &allocated = g_metrics().counter("canary_lua_userdata_allocated_total", "Userdata allocated for game objects pushed to Lua");
+	allocated.add();
 }
 
 CombatDamage LuaFunctionsLoader::getCombatDamage(lua_State* L) {
@@ -746,9 +828,12 @@ void LuaFunctionsLoader::registerSharedClass(lua_State* L, const std::string &cl
 }
 
 int LuaFunctionsLoader::luaGarbageCollection(lua_State* L) {
+	static auto &collected = g_metrics().counter("canary_lua_userdata_collected_total", "Game object userdata released by the Lua garbage collector");
+
 	auto objPtr = static_cast<std::shared_ptr<SharedObject>*>(lua_touserdata(L, 1));
 	if (objPtr) {
 		objPtr->reset();
+		collected.add();
 	}
 	return 0;
 }
@@ -52,10 +52,19 @@ public:
 		*userdata = value;
 	}
 
-	static void setMetatable(lua_State* L, int32_t index, const std::string &name);
-	static void setWeakMetatable(lua_State* L, int32_t index, const std::string &name);
-	static void setItemMetatable(lua_State* L, int32_t index, std::shared_ptr<Item> item);
-	static void setCreatureMetatable(lua_State* L, int32_t index, std::shared_ptr<Creature> creature);
+	// Objects pushed by plain pointer outlive the scripts, their userdata is not cached
+	template <class T>
+	static void pushUserdata(lua_State* L, T* value, std::string_view metatable) {
+		pushUserdata<T>(L, value);
+		setMetatable(L, -1, metatable);
+	}
+
+	static void setMetatable(lua_State* L, int32_t index, std::string_view name);
+	static void setWeakMetatable(lua_State* L, int32_t index, std::string_view name);
+
+	// Pushes the creature or item with the metatable of its type, see pushUserdata with a metatable
+	static void pushCreature(lua_State* L, const std::shared_ptr<Creature> &creature);
+	static void pushItem(lua_State* L, const std::shared_ptr<Item> &item);
 
 	template <typename T>
 	static typename std::enable_if<std::is_enum<T>::value, T>::type
@@ -206,6 +215,30 @@ public:
 		auto userData = static_cast<std::shared_ptr<T>*>(lua_newuserdata(L, sizeof(std::shared_ptr<T>)));
 		// Copy constructor, bumps ref count.
 		new (userData) std::shared_ptr<T>(value);
+		onUserdataAllocated();
+	}
+
+	/**
+	 * Pushes value with the given metatable. While the userdata cache is enabled, an object
+	 * pushed again with the same metatable gets the userdata still alive from the previous push
+	 * instead of a new allocation. The cache holds them weakly, so it never keeps objects alive.
+	 */
+	template <class T>
+	static void pushUserdata(lua_State* L, const std::shared_ptr<T> &value, std::string_view metatable) {
+		const int metatableRef = getMetatableRef(L, metatable);
+		if (value && pushCachedUserdata(L, value.get(), metatableRef)) {
+			// A script may have reset the shared pointer of the cached userdata
+			if (const auto cached = getRawUserDataShared<T>(L, -1); cached && cached->get() == value.get()) {
+				return;
+			}
+			lua_pop(L, 1);
+		}
+
+		pushUserdata<T>(L, value);
+		setMetatable(L, -1, metatable);
+		if (value) {
+			cacheUserdata(L, value.get(), metatableRef);
+		}
 	}
 
 protected:
@@ -224,6 +257,14 @@ protected:
 	static int luaUserdataCompare(lua_State* L);
 	static int luaGarbageCollection(lua_State* L);
 
+	// Registry ref of a metatable, LUA_NOREF if it is not registered in this state yet
+	static int getMetatableRef(lua_State* L, std::string_view name);
+	static void pushMetatable(lua_State* L, std::string_view name);
+	static bool pushCachedUserdata(lua_State* L, const void* object, int metatableRef);
+	static void cacheUserdata(lua_State* L, const void* object, int metatableRef);
+	static void resetUserdataCache(lua_State* L);
+	static void onUserdataAllocated();
+
 	static ScriptEnvironment scriptEnv[16];
 	static int32_t scriptEnvIndex;
 	static int validateDispatcherContext(std::string_view fncName);
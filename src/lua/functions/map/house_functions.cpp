@@ -19,8 +19,7 @@
 int HouseFunctions::luaHouseCreate(lua_State* L) {
 	// House(id)
 	if (const auto &house = g_game().map.houses.getHouse(getNumber<uint32_t>(L, 2))) {
-		pushUserdata<House>(L, house);
-		setMetatable(L, -1, "House");
+		pushUserdata<House>(L, house, "House");
 	} else {
 		lua_pushnil(L);
 	}
@@ -56,8 +55,7 @@ int HouseFunctions::luaHouseGetTown(lua_State* L) {
 	}
 
 	if (const auto &town = g_game().map.towns.getTown(house->getTownId())) {
-		pushUserdata<Town>(L, town);
-		setMetatable(L, -1, "Town");
+		pushUserdata<Town>(L, town, "Town");
 	} else {
 		lua_pushnil(L);
 	}
@@ -240,8 +238,7 @@ int HouseFunctions::luaHouseGetBeds(lua_State* L) {
 
 	int index = 0;
 	for (std::shared_ptr<BedItem> bedItem : beds) {
-		pushUserdata<Item>(L, bedItem);
-		setItemMetatable(L, -1, bedItem);
+		pushItem(L, bedItem);
 		lua_rawseti(L, -2, ++index);
 	}
 	return 1;
@@ -270,8 +267,7 @@ int HouseFunctions::luaHouseGetDoors(lua_State* L) {
 
 	int index = 0;
 	for (std::shared_ptr<Door> door : doors) {
-		pushUserdata<Item>(L, door);
-		setItemMetatable(L, -1, door);
+		pushItem(L, door);
 		lua_rawseti(L, -2, ++index);
 	}
 	return 1;
@@ -317,8 +313,7 @@ int HouseFunctions::luaHouseGetTiles(lua_State* L) {
 
 	int index = 0;
 	for (std::shared_ptr<Tile> tile : tiles) {
-		pushUserdata<Tile>(L, tile);
-		setMetatable(L, -1, "Tile");
+		pushUserdata<Tile>(L, tile, "Tile");
 		lua_rawseti(L, -2, ++index);
 	}
 	return 1;
@@ -340,8 +335,7 @@ int HouseFunctions::luaHouseGetItems(lua_State* L) {
 		TileItemVector* itemVector = tile->getItemList();
 		if (itemVector) {
 			for (auto &item : *itemVector) {
-				pushUserdata<Item>(L, item);
-				setItemMetatable(L, -1, item);
+				pushItem(L, item);
 				lua_rawseti(L, -2, ++index);
 			}
 		}
@@ -139,8 +139,7 @@ int PositionFunctions::luaPositionGetZones(lua_State* L) {
 	int index = 0;
 	for (auto zone : tile->getZones()) {
 		index++;
-		pushUserdata<Zone>(L, zone);
-		setMetatable(L, -1, "Zone");
+		pushUserdata<Zone>(L, zone, "Zone");
 		lua_rawseti(L, -2, index);
 	}
 	return 1;
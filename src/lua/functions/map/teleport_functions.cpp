@@ -20,8 +20,7 @@ int TeleportFunctions::luaTeleportCreate(lua_State* L) {
 
 	std::shared_ptr<Item> item = getScriptEnv()->getItemByUID(id);
 	if (item && item->getTeleport()) {
-		pushUserdata(L, item);
-		setMetatable(L, -1, "Teleport");
+		pushUserdata(L, item, "Teleport");
 	} else {
 		lua_pushnil(L);
 	}
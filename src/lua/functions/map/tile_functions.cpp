@@ -26,8 +26,7 @@ int TileFunctions::luaTileCreate(lua_State* L) {
 	}
 
 	if (tile) {
-		pushUserdata<Tile>(L, tile);
-		setMetatable(L, -1, "Tile");
+		pushUserdata<Tile>(L, tile, "Tile");
 	} else {
 		lua_pushnil(L);
 	}
@@ -49,8 +48,7 @@ int TileFunctions::luaTileGetGround(lua_State* L) {
 	// tile:getGround()
 	std::shared_ptr<Tile> tile = getUserdataShared<Tile>(L, 1);
 	if (tile && tile->getGround()) {
-		pushUserdata<Item>(L, tile->getGround());
-		setItemMetatable(L, -1, tile->getGround());
+		pushItem(L, tile->getGround());
 	} else {
 		lua_pushnil(L);
 	}
@@ -73,11 +71,9 @@ int TileFunctions::luaTileGetThing(lua_State* L) {
 	}
 
 	if (std::shared_ptr<Creature> creature = thing->getCreature()) {
-		pushUserdata<Creature>(L, creature);
-		setCreatureMetatable(L, -1, creature);
+		pushCreature(L, creature);
 	} else if (std::shared_ptr<Item> item = thing->getItem()) {
-		pushUserdata<Item>(L, item);
-		setItemMetatable(L, -1, item);
+		pushItem(L, item);
 	} else {
 		lua_pushnil(L);
 	}
@@ -111,11 +107,9 @@ int TileFunctions::luaTileGetTopVisibleThing(lua_State* L) {
 	}
 
 	if (std::shared_ptr<Creature> visibleCreature = thing->getCreature()) {
-		pushUserdata<Creature>(L, visibleCreature);
-		setCreatureMetatable(L, -1, visibleCreature);
+		pushCreature(L, visibleCreature);
 	} else if (std::shared_ptr<Item> visibleItem = thing->getItem()) {
-		pushUserdata<Item>(L, visibleItem);
-		setItemMetatable(L, -1, visibleItem);
+		pushItem(L, visibleItem);
 	} else {
 		lua_pushnil(L);
 	}
@@ -132,8 +126,7 @@ int TileFunctions::luaTileGetTopTopItem(lua_State* L) {
 
 	std::shared_ptr<Item> item = tile->getTopTopItem();
 	if (item) {
-		pushUserdata<Item>(L, item);
-		setItemMetatable(L, -1, item);
+		pushItem(L, item);
 	} else {
 		lua_pushnil(L);
 	}
@@ -150,8 +143,7 @@ int TileFunctions::luaTileGetTopDownItem(lua_State* L) {
 
 	std::shared_ptr<Item> item = tile->getTopDownItem();
 	if (item) {
-		pushUserdata<Item>(L, item);
-		setItemMetatable(L, -1, item);
+		pushItem(L, item);
 	} else {
 		lua_pushnil(L);
 	}
@@ -168,8 +160,7 @@ int TileFunctions::luaTileGetFieldItem(lua_State* L) {
 
 	std::shared_ptr<Item> item = tile->getFieldItem();
 	if (item) {
-		pushUserdata<Item>(L, item);
-		setItemMetatable(L, -1, item);
+		pushItem(L, item);
 	} else {
 		lua_pushnil(L);
 	}
@@ -198,8 +189,7 @@ int TileFunctions::luaTileGetItemById(lua_State* L) {
 
 	std::shared_ptr<Item> item = g_game().findItemOfType(tile, itemId, false, subType);
 	if (item) {
-		pushUserdata<Item>(L, item);
-		setItemMetatable(L, -1, item);
+		pushItem(L, item);
 	} else {
 		lua_pushnil(L);
 	}
@@ -249,8 +239,7 @@ int TileFunctions::luaTileGetItemByType(lua_State* L) {
 	if (std::shared_ptr<Item> item = tile->getGround()) {
 		const ItemType &it = Item::items[item->getID()];
 		if (it.type == itemType) {
-			pushUserdata<Item>(L, item);
-			setItemMetatable(L, -1, item);
+			pushItem(L, item);
 			return 1;
 		}
 	}
@@ -259,8 +248,7 @@ int TileFunctions::luaTileGetItemByType(lua_State* L) {
 		for (auto &item : *items) {
 			const ItemType &it = Item::items[item->getID()];
 			if (it.type == itemType) {
-				pushUserdata<Item>(L, item);
-				setItemMetatable(L, -1, item);
+				pushItem(L, item);
 				return 1;
 			}
 		}
@@ -286,8 +274,7 @@ int TileFunctions::luaTileGetItemByTopOrder(lua_State* L) {
 		return 1;
 	}
 
-	pushUserdata<Item>(L, item);
-	setItemMetatable(L, -1, item);
+	pushItem(L, item);
 	return 1;
 }
 
@@ -330,8 +317,7 @@ int TileFunctions::luaTileGetBottomCreature(lua_State* L) {
 		return 1;
 	}
 
-	pushUserdata<const Creature>(L, creature);
-	setCreatureMetatable(L, -1, creature);
+	pushCreature(L, creature);
 	return 1;
 }
 
@@ -349,8 +335,7 @@ int TileFunctions::luaTileGetTopCreature(lua_State* L) {
 		return 1;
 	}
 
-	pushUserdata<Creature>(L, creature);
-	setCreatureMetatable(L, -1, creature);
+	pushCreature(L, creature);
 	return 1;
 }
 
@@ -370,8 +355,7 @@ int TileFunctions::luaTileGetBottomVisibleCreature(lua_State* L) {
 
 	std::shared_ptr<Creature> visibleCreature = tile->getBottomVisibleCreature(creature);
 	if (visibleCreature) {
-		pushUserdata<const Creature>(L, visibleCreature);
-		setCreatureMetatable(L, -1, visibleCreature);
+		pushCreature(L, visibleCreature);
 	} else {
 		lua_pushnil(L);
 	}
@@ -394,8 +378,7 @@ int TileFunctions::luaTileGetTopVisibleCreature(lua_State* L) {
 
 	std::shared_ptr<Creature> visibleCreature = tile->getTopVisibleCreature(creature);
 	if (visibleCreature) {
-		pushUserdata<Creature>(L, visibleCreature);
-		setCreatureMetatable(L, -1, visibleCreature);
+		pushCreature(L, visibleCreature);
 	} else {
 		lua_pushnil(L);
 	}
@@ -420,8 +403,7 @@ int TileFunctions::luaTileGetItems(lua_State* L) {
 
 	int index = 0;
 	for (auto &item : *itemVector) {
-		pushUserdata<Item>(L, item);
-		setItemMetatable(L, -1, item);
+		pushItem(L, item);
 		lua_rawseti(L, -2, ++index);
 	}
 	return 1;
@@ -480,8 +462,7 @@ int TileFunctions::luaTileGetCreatures(lua_State* L) {
 
 	int index = 0;
 	for (auto &creature : *creatureVector) {
-		pushUserdata<Creature>(L, creature);
-		setCreatureMetatable(L, -1, creature);
+		pushCreature(L, creature);
 		lua_rawseti(L, -2, ++index);
 	}
 	return 1;
@@ -601,8 +582,7 @@ int TileFunctions::luaTileAddItem(lua_State* L) {
 
 	ReturnValue ret = g_game().internalAddItem(tile, item, INDEX_WHEREEVER, flags);
 	if (ret == RETURNVALUE_NOERROR) {
-		pushUserdata<Item>(L, item);
-		setItemMetatable(L, -1, item);
+		pushItem(L, item);
 	} else {
 
 		lua_pushnil(L);
@@ -648,8 +628,7 @@ int TileFunctions::luaTileGetHouse(lua_State* L) {
 	}
 
 	if (std::shared_ptr<HouseTile> houseTile = std::dynamic_pointer_cast<HouseTile>(tile)) {
-		pushUserdata<House>(L, houseTile->getHouse());
-		setMetatable(L, -1, "House");
+		pushUserdata<House>(L, houseTile->getHouse(), "House");
 	} else {
 		lua_pushnil(L);
 	}
@@ -25,8 +25,7 @@ int TownFunctions::luaTownCreate(lua_State* L) {
 	}
 
 	if (town) {
-		pushUserdata<Town>(L, town);
-		setMetatable(L, -1, "Town");
+		pushUserdata<Town>(L, town, "Town");
 	} else {
 		lua_pushnil(L);
 	}
@@ -85,6 +85,9 @@ private:
 	GlobalEvent_t eventType = GLOBALEVENT_NONE;
 
 	std::string getScriptTypeName() const override;
+	std::string getEventKind() const override {
+		return "globalevent";
+	}
 
 	std::string name;
 	int64_t nextExecution = 0;
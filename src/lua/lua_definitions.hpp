@@ -228,9 +228,11 @@ struct LuaVariant {
 struct LuaTimerEventDesc {
 	int32_t scriptId = -1;
 	std::string scriptName;
-	int32_t function = -1;
-	std::list<int32_t> parameters;
+	// Registry table holding the callback at [1] and its arguments after it
+	int32_t callback = -1;
+	int32_t arguments = 0;
 	uint32_t eventId = 0;
+	int64_t due = 0;
 
 	LuaTimerEventDesc() = default;
 	LuaTimerEventDesc(LuaTimerEventDesc &&other) = default;
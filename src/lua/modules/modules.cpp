@@ -165,8 +165,7 @@ void Module::executeOnRecvbyte(std::shared_ptr<Player> player, NetworkMessage &m
 	lua_State* L = scriptInterface->getLuaState();
 
 	scriptInterface->pushFunction(scriptId);
-	LuaScriptInterface::pushUserdata<Player>(L, player);
-	LuaScriptInterface::setMetatable(L, -1, "Player");
+	LuaScriptInterface::pushUserdata<Player>(L, player, "Player");
 
 	LuaScriptInterface::pushUserdata<NetworkMessage>(L, std::shared_ptr<NetworkMessage>(&msg));
 	LuaScriptInterface::setWeakMetatable(L, -1, "NetworkMessage");
@@ -10,8 +10,11 @@
 #include "pch.hpp"
 
 #include "declarations.hpp"
+#include "game/scheduling/dispatcher.hpp"
+#include "lib/metrics/metrics.hpp"
 #include "lua/scripts/lua_environment.hpp"
 #include "lua/functions/lua_functions_loader.hpp"
+#include "lua/scripts/lua_profiler.hpp"
 #include "lua/scripts/script_environment.hpp"
 
 bool LuaEnvironment::shuttingDown = false;
@@ -68,17 +71,13 @@ bool LuaEnvironment::closeState() {
 		clearAreaObjects(areaEntry.first);
 	}
 
-	for (auto &timerEntry : timerEvents) {
-		LuaTimerEventDesc timerEventDesc = std::move(timerEntry.second);
-		for (int32_t parameter : timerEventDesc.parameters) {
-			luaL_unref(luaState, LUA_REGISTRYINDEX, parameter);
-		}
-		luaL_unref(luaState, LUA_REGISTRYINDEX, timerEventDesc.function);
+	// The timer check event stops by itself once it finds the wheel empty
+	for (const auto &timerEventDesc : timerWheel.clear()) {
+		releaseTimerEvent(timerEventDesc);
 	}
 
 	combatIdMap.clear();
 	areaIdMap.clear();
-	timerEvents.clear();
 	cacheFiles.clear();
 
 	lua_close(luaState);
@@ -148,39 +147,99 @@ void LuaEnvironment::clearAreaObjects(LuaScriptInterface* interface) {
 	it->second.clear();
 }
 
-void LuaEnvironment::executeTimerEvent(uint32_t eventIndex) {
-	auto it = timerEvents.find(eventIndex);
-	if (it == timerEvents.end()) {
-		return;
+uint32_t LuaEnvironment::addTimerEvent(LuaTimerEventDesc &&timerEventDesc, uint32_t delay) {
+	const int64_t now = OTSYS_TIME();
+	timerEventDesc.due = now + delay;
+	const uint32_t timerId = timerWheel.add(std::move(timerEventDesc), now);
+
+	if (timerCheckEventId == 0) {
+		timerCheckEventId = g_dispatcher().cycleEvent(
+			LuaTimerWheel::TICK_MS,
+			std::bind(&LuaEnvironment::executeTimerEvents, this),
+			"LuaEnvironment::executeTimerEvents"
+		);
 	}
+	return timerId;
+}
 
-	LuaTimerEventDesc timerEventDesc = std::move(it->second);
-	timerEvents.erase(it);
+bool LuaEnvironment::stopTimerEvent(uint32_t timerId) {
+	auto timerEventDesc = timerWheel.remove(timerId);
+	if (!timerEventDesc) {
+		return false;
+	}
 
-	// push function
-	lua_rawgeti(luaState, LUA_REGISTRYINDEX, timerEventDesc.function);
+	releaseTimerEvent(*timerEventDesc);
+	return true;
+}
 
-	// push parameters
-	for (auto parameter : std::views::reverse(timerEventDesc.parameters)) {
-		lua_rawgeti(luaState, LUA_REGISTRYINDEX, parameter);
+void LuaEnvironment::executeTimerEvents() {
+	static auto &fired = g_metrics().counter("canary_lua_timers_fired_total", "Lua addEvent timers that ran");
+
+	std::vector<uint32_t> dueTimerIds;
+	timerWheel.advance(OTSYS_TIME(), dueTimerIds);
+
+	if (!dueTimerIds.empty()) {
+		// One environment for the whole batch, reset between timers
+		if (reserveScriptEnv()) {
+			ScriptEnvironment* env = getScriptEnv();
+			for (uint32_t timerId : dueTimerIds) {
+				// A timer of this batch may have stopped a later one
+				auto timerEventDesc = timerWheel.remove(timerId);
+				if (!timerEventDesc) {
+					continue;
+				}
+
+				env->resetEnv();
+				env->setTimerEvent();
+				env->setScriptId(timerEventDesc->scriptId, this);
+
+				LuaProfiler::CallScope profilerScope("addEvent");
+
+				// push the callback and its arguments
+				const int size = lua_gettop(luaState);
+				lua_rawgeti(luaState, LUA_REGISTRYINDEX, timerEventDesc->callback);
+				for (int32_t index = 1; index <= timerEventDesc->arguments + 1; ++index) {
+					lua_rawgeti(luaState, size + 1, index);
+				}
+				lua_remove(luaState, size + 1);
+
+				if (protectedCall(luaState, timerEventDesc->arguments, 0) != 0) {
+					reportError(nullptr, popString(luaState));
+				}
+				if (lua_gettop(luaState) != size) {
+					reportError(nullptr, "Stack size changed!");
+				}
+
+				releaseTimerEvent(*timerEventDesc);
+				fired.add();
+			}
+			resetScriptEnv();
+		} else {
+			g_logger().error("[LuaEnvironment::executeTimerEvents - Lua file {}] "
+							 "Call stack overflow. Too many lua script calls being nested",
+							 getLoadingFile());
+			for (uint32_t timerId : dueTimerIds) {
+				stopTimerEvent(timerId);
+			}
+		}
 	}
 
-	// call the function
-	if (reserveScriptEnv()) {
-		ScriptEnvironment* env = getScriptEnv();
-		env->setTimerEvent();
-		env->setScriptId(timerEventDesc.scriptId, this);
-		callFunction(timerEventDesc.parameters.size());
-	} else {
-		g_logger().error("[LuaEnvironment::executeTimerEvent - Lua file {}] "
-						 "Call stack overflow. Too many lua script calls being nested",
-						 getLoadingFile());
+	if (timerWheel.empty()) {
+		g_dispatcher().stopEvent(timerCheckEventId);
+		timerCheckEventId = 0;
 	}
+}
+
+void LuaEnvironment::releaseTimerEvent(const LuaTimerEventDesc &timerEventDesc) const {
+	luaL_unref(luaState, LUA_REGISTRYINDEX, timerEventDesc.callback);
+}
+
+void LuaEnvironment::updateTimerMetrics() const {
+	static auto &pending = g_metrics().gauge("canary_lua_timers", "Pending Lua addEvent timers");
 
-	// free resources
-	luaL_unref(luaState, LUA_REGISTRYINDEX, timerEventDesc.function);
-	for (auto parameter : timerEventDesc.parameters) {
-		luaL_unref(luaState, LUA_REGISTRYINDEX, parameter);
+	pending.set(static_cast<int64_t>(timerWheel.size()));
+	for (const auto &[scriptName, count] : timerWheel.getScriptCounts()) {
+		g_metrics().gauge("canary_lua_script_timers", "Pending Lua addEvent timers, by the script that added them", { { "script", scriptName } }).set(count);
 	}
 }
 
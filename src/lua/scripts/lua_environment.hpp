@@ -12,6 +12,7 @@
 #include "creatures/combat/combat.hpp"
 #include "declarations.hpp"
 #include "lua/scripts/luascript.hpp"
+#include "lua/scripts/lua_timer_wheel.hpp"
 #include "items/weapons/weapons.hpp"
 
 class AreaCombat;
@@ -84,11 +85,16 @@ public:
 
 	void collectGarbage() const;
 
+	uint32_t addTimerEvent(LuaTimerEventDesc &&timerEventDesc, uint32_t delay);
+	bool stopTimerEvent(uint32_t timerId);
+	void updateTimerMetrics() const;
+
 private:
-	void executeTimerEvent(uint32_t eventIndex);
+	void executeTimerEvents();
+	void releaseTimerEvent(const LuaTimerEventDesc &timerEventDesc) const;
 
-	phmap::flat_hash_map<uint32_t, LuaTimerEventDesc> timerEvents;
-	uint32_t lastEventTimerId = 1;
+	LuaTimerWheel timerWheel;
+	uint64_t timerCheckEventId = 0;
 
 	phmap::flat_hash_map<uint32_t, std::unique_ptr<AreaCombat>> areaMap;
 	phmap::flat_hash_map<LuaScriptInterface*, std::vector<uint32_t>> areaIdMap;
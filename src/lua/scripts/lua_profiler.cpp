@@ -0,0 +1,175 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2022 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include "lua/scripts/lua_profiler.hpp"
+#include "lua/functions/lua_functions_loader.hpp"
+#include "lua/scripts/luascript.hpp"
+#include "lua/scripts/script_environment.hpp"
+
+LuaProfiler::CallScope::CallScope(std::string_view eventKind) {
+	auto &profiler = g_luaProfiler();
+	if (profiler.isRunning()) {
+		profiler.enter(eventKind);
+		active = true;
+	}
+}
+
+LuaProfiler::CallScope::~CallScope() {
+	if (active) {
+		g_luaProfiler().leave();
+	}
+}
+
+void LuaProfiler::start(lua_State* L, uint32_t sampleInstructions) {
+	if (running) {
+		return;
+	}
+
+	samples.clear();
+	callTimes.clear();
+
+#ifdef LUAJIT_VERSION
+	// Compiled traces never reach the count hook, the interpreter runs everything while profiling
+	luaJIT_setmode(L, 0, LUAJIT_MODE_ENGINE | LUAJIT_MODE_OFF);
+#endif
+	lua_sethook(L, &LuaProfiler::hook, LUA_MASKCOUNT, static_cast<int>(std::max<uint32_t>(1, sampleInstructions)));
+
+	lastSample = std::chrono::steady_clock::now();
+	running = true;
+	g_logger().info("Lua profiler started, sampling every {} instructions", sampleInstructions);
+}
+
+void LuaProfiler::stop(lua_State* L) {
+	if (!running) {
+		return;
+	}
+
+	lua_sethook(L, nullptr, 0, 0);
+#ifdef LUAJIT_VERSION
+	luaJIT_setmode(L, 0, LUAJIT_MODE_ENGINE | LUAJIT_MODE_ON);
+#endif
+
+	running = false;
+	g_logger().info("Lua profiler stopped, {} stacks sampled", samples.size());
+}
+
+bool LuaProfiler::dump(const std::string &file) const {
+	return writeFolded(file, samples) && writeFolded(file + ".calls", callTimes);
+}
+
+void LuaProfiler::hook(lua_State* L, lua_Debug*) {
+	g_luaProfiler().sample(L);
+}
+
+void LuaProfiler::enter(std::string_view eventKind) {
+	std::string_view script = "?";
+	if (ScriptEnvironment* env = LuaFunctionsLoader::getScriptEnv()) {
+		if (LuaScriptInterface* interface = env->getScriptInterface()) {
+			script = interface->getFileById(env->getScriptId());
+		}
+	}
+
+	// Scripts are named file:event
+	std::string_view file = script;
+	if (const size_t separator = script.rfind(':'); separator != std::string_view::npos) {
+		file = script.substr(0, separator);
+		if (eventKind.empty()) {
+			eventKind = script.substr(separator + 1);
+		}
+	}
+	if (eventKind.empty()) {
+		eventKind = "script";
+	}
+
+	const auto now = std::chrono::steady_clock::now();
+	std::string frames;
+	if (calls.empty()) {
+		lastSample = now;
+	} else {
+		frames = calls.back().frames + ';';
+	}
+	fmt::format_to(std::back_inserter(frames), "{};{}", eventKind, file);
+	calls.push_back({ std::move(frames), now });
+}
+
+void LuaProfiler::leave() {
+	if (calls.empty()) {
+		return;
+	}
+
+	const auto now = std::chrono::steady_clock::now();
+	const Call call = std::move(calls.back());
+	calls.pop_back();
+
+	// Stopped while the call was running, it only has to be taken off the stack
+	if (!running) {
+		return;
+	}
+
+	const auto elapsed = now - call.start;
+	callTimes[call.frames] += elapsed - call.children;
+	if (!calls.empty()) {
+		calls.back().children += elapsed;
+		return;
+	}
+
+	// The Lua stack is gone, the time since the last sample goes to the call itself
+	samples[call.frames] += now - lastSample;
+	lastSample = now;
+}
+
+void LuaProfiler::sample(lua_State* L) {
+	// Scripts being loaded are not inside any call
+	if (calls.empty()) {
+		return;
+	}
+
+	luaFrames.clear();
+	lua_Debug frame;
+	for (int level = 0; lua_getstack(L, level, &frame) == 1; ++level) {
+		lua_getinfo(L, "Sn", &frame);
+		const char* name = frame.name ? frame.name : "?";
+		if (*frame.what == 'C') {
+			luaFrames.emplace_back(fmt::format("{}@[C]", name));
+		} else {
+			luaFrames.emplace_back(fmt::format("{}@{}:{}", name, frame.short_src, frame.linedefined));
+		}
+	}
+
+	// Nested calls run on the same Lua stack, so the outermost call roots the sample
+	stack = calls.front().frames;
+	for (const auto &luaFrame : std::views::reverse(luaFrames)) {
+		stack += ';';
+		stack += luaFrame;
+	}
+
+	const auto now = std::chrono::steady_clock::now();
+	samples[stack] += now - lastSample;
+	lastSample = now;
+}
+
+bool LuaProfiler::writeFolded(const std::string &file, const phmap::flat_hash_map<std::string, std::chrono::nanoseconds> &stacks) {
+	std::ofstream out(file, std::ios::trunc);
+	if (!out) {
+		g_logger().error("[LuaProfiler::dump] - Could not open {}", file);
+		return false;
+	}
+
+	for (const auto &[frames, time] : stacks) {
+		const auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>(time).count();
+		if (microseconds > 0) {
+			out << frames << ' ' << microseconds << '\n';
+		}
+	}
+
+	g_logger().info("Lua profile written to {}", file);
+	return true;
+}
@@ -0,0 +1,88 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2022 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+#include "lib/di/container.hpp"
+
+/**
+ * Opt-in profiler for the datapack scripts. While running, a count hook samples the
+ * Lua stack every few instructions and weights it by the time since the last sample,
+ * and every call into Lua is timed exactly. Both are attributed to the event kind and
+ * script file of the call and written as folded stacks, the input of flamegraph.pl.
+ */
+class LuaProfiler {
+public:
+	LuaProfiler() = default;
+
+	// Singleton - ensures we don't accidentally copy it.
+	LuaProfiler(const LuaProfiler &) = delete;
+	LuaProfiler &operator=(const LuaProfiler &) = delete;
+
+	static LuaProfiler &getInstance() {
+		return inject<LuaProfiler>();
+	}
+
+	/**
+	 * Brackets one call into Lua, calls may nest. Costs a single check while the
+	 * profiler is stopped.
+	 */
+	class CallScope {
+	public:
+		// Without an event kind, the one of the running script environment is used
+		explicit CallScope(std::string_view eventKind = {});
+		~CallScope();
+
+		CallScope(const CallScope &) = delete;
+		CallScope &operator=(const CallScope &) = delete;
+
+	private:
+		bool active = false;
+	};
+
+	// Starting drops what an earlier run collected
+	void start(lua_State* L, uint32_t sampleInstructions);
+	void stop(lua_State* L);
+
+	bool isRunning() const {
+		return running;
+	}
+
+	// Writes the sampled stacks to file and the exact call times to file.calls, both in microseconds
+	bool dump(const std::string &file) const;
+
+private:
+	struct Call {
+		std::string frames;
+		std::chrono::steady_clock::time_point start;
+		std::chrono::nanoseconds children {};
+	};
+
+	static void hook(lua_State* L, lua_Debug* ar);
+
+	void enter(std::string_view eventKind);
+	void leave();
+	void sample(lua_State* L);
+
+	static bool writeFolded(const std::string &file, const phmap::flat_hash_map<std::string, std::chrono::nanoseconds> &stacks);
+
+	bool running = false;
+	std::vector<Call> calls;
+	std::chrono::steady_clock::time_point lastSample;
+
+	// Folded stack to the time attributed to it
+	phmap::flat_hash_map<std::string, std::chrono::nanoseconds> samples;
+	// Chain of nested calls to the time spent in the innermost one, its children excluded
+	phmap::flat_hash_map<std::string, std::chrono::nanoseconds> callTimes;
+
+	std::vector<std::string> luaFrames;
+	std::string stack;
+};
+
+constexpr auto g_luaProfiler = LuaProfiler::getInstance;
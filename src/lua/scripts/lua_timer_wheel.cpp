@@ -0,0 +1,91 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2022 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include "lua/scripts/lua_timer_wheel.hpp"
+
+uint32_t LuaTimerWheel::add(LuaTimerEventDesc &&timer, int64_t now) {
+	// An idle wheel is not advanced, so it starts over from the current tick
+	if (timers.empty()) {
+		currentTick = now / TICK_MS;
+	}
+
+	// Rounded up, the tick of a timer is never reached before the timer is due
+	const int64_t dueTick = std::max((timer.due + TICK_MS - 1) / TICK_MS, currentTick + 1);
+	const uint32_t timerId = ++lastTimerId;
+	slots[dueTick % SLOTS].emplace_back(timerId);
+
+	++scriptCounts[timer.scriptName];
+	timer.eventId = timerId;
+	timers.emplace(timerId, std::move(timer));
+	return timerId;
+}
+
+std::optional<LuaTimerEventDesc> LuaTimerWheel::remove(uint32_t timerId) {
+	auto it = timers.find(timerId);
+	if (it == timers.end()) {
+		return std::nullopt;
+	}
+
+	std::optional<LuaTimerEventDesc> timer(std::move(it->second));
+	timers.erase(it);
+	release(*timer);
+	return timer;
+}
+
+void LuaTimerWheel::advance(int64_t now, std::vector<uint32_t> &dueTimerIds) {
+	const int64_t nowTick = now / TICK_MS;
+	// Once a revolution behind, every slot has been looked at
+	const int64_t lastTick = std::min(nowTick, currentTick + SLOTS);
+	for (int64_t tick = currentTick + 1; tick <= lastTick; ++tick) {
+		std::erase_if(slots[tick % SLOTS], [this, now](uint32_t timerId) {
+			auto it = timers.find(timerId);
+			if (it == timers.end()) {
+				return true;
+			}
+			if (it->second.due > now) {
+				return false;
+			}
+
+			dueTimers.emplace_back(it->second.due, timerId);
+			return true;
+		});
+	}
+	currentTick = std::max(currentTick, nowTick);
+
+	// Timers sharing a slot fire in due order, then in the order they were added
+	std::ranges::sort(dueTimers);
+	for (const auto &[due, timerId] : dueTimers) {
+		dueTimerIds.emplace_back(timerId);
+	}
+	dueTimers.clear();
+}
+
+std::vector<LuaTimerEventDesc> LuaTimerWheel::clear() {
+	std::vector<LuaTimerEventDesc> result;
+	result.reserve(timers.size());
+	for (auto &[timerId, timer] : timers) {
+		release(timer);
+		result.emplace_back(std::move(timer));
+	}
+
+	timers.clear();
+	for (auto &slot : slots) {
+		slot.clear();
+	}
+	return result;
+}
+
+void LuaTimerWheel::release(const LuaTimerEventDesc &timer) {
+	auto it = scriptCounts.find(timer.scriptName);
+	if (it != scriptCounts.end() && it->second > 0) {
+		--it->second;
+	}
+}
@@ -0,0 +1,54 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2022 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+#include "lua/lua_definitions.hpp"
+
+/**
+ * Hashed timer wheel holding the pending addEvent timers. A timer sits in the slot of the
+ * tick it is due in, so advancing only looks at the slots of the ticks that went by.
+ * Timers more than one revolution away stay in their slot until their own revolution.
+ */
+class LuaTimerWheel {
+public:
+	static constexpr int64_t TICK_MS = 50;
+	static constexpr int64_t SLOTS = 1024;
+
+	// The timer must have its due time set, returns the id stopEvent refers to
+	uint32_t add(LuaTimerEventDesc &&timer, int64_t now);
+	// Takes a timer out, its slot entry is dropped when the wheel reaches it
+	std::optional<LuaTimerEventDesc> remove(uint32_t timerId);
+	// Appends the ids of the timers due at now in firing order, they stay in the wheel until removed
+	void advance(int64_t now, std::vector<uint32_t> &dueTimerIds);
+	// Empties the wheel, returning the timers so their references can be released
+	std::vector<LuaTimerEventDesc> clear();
+
+	bool empty() const {
+		return timers.empty();
+	}
+	size_t size() const {
+		return timers.size();
+	}
+	// Pending timers by script, scripts stay listed with 0 once their timers are gone
+	const phmap::flat_hash_map<std::string, uint32_t> &getScriptCounts() const {
+		return scriptCounts;
+	}
+
+private:
+	void release(const LuaTimerEventDesc &timer);
+
+	phmap::flat_hash_map<uint32_t, LuaTimerEventDesc> timers;
+	std::array<std::vector<uint32_t>, SLOTS> slots;
+	phmap::flat_hash_map<std::string, uint32_t> scriptCounts;
+	std::vector<std::pair<int64_t, uint32_t>> dueTimers;
+	// Last tick advanced through
+	int64_t currentTick = 0;
+	uint32_t lastTimerId = 0;
+};
@@ -11,6 +11,7 @@
 
 #include "lua/scripts/luascript.hpp"
 #include "lua/scripts/lua_environment.hpp"
+#include "lua/scripts/lua_profiler.hpp"
 
 ScriptEnvironment::DBResultMap ScriptEnvironment::tempResults;
 uint32_t ScriptEnvironment::lastResultId = 0;
@@ -122,6 +123,10 @@ int32_t LuaScriptInterface::getEvent() {
 	return runningEventId++;
 }
 
+void LuaScriptInterface::setEventName(int32_t scriptId, const std::string &eventName) {
+	cacheFiles[scriptId] = loadingFile + ":" + eventName;
+}
+
 int32_t LuaScriptInterface::getMetaEvent(const std::string &globalName, const std::string &eventName) {
 	// get our events table
 	lua_rawgeti(luaState, LUA_REGISTRYINDEX, eventTableRef);
@@ -227,6 +232,7 @@ bool LuaScriptInterface::closeState() {
 }
 
 bool LuaScriptInterface::callFunction(int params) {
+	LuaProfiler::CallScope profilerScope;
 	bool result = false;
 	int size = lua_gettop(luaState);
 	if (protectedCall(luaState, params, 1) != 0) {
@@ -245,6 +251,7 @@ bool LuaScriptInterface::callFunction(int params) {
 }
 
 void LuaScriptInterface::callVoidFunction(int params) {
+	LuaProfiler::CallScope profilerScope;
 	int size = lua_gettop(luaState);
 	if (protectedCall(luaState, params, 0) != 0) {
 		LuaScriptInterface::reportError(nullptr, LuaScriptInterface::popString(luaState));
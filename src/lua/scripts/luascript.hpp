@@ -30,6 +30,8 @@ public:
 	const std::string &getFileById(int32_t scriptId);
 	int32_t getEvent(const std::string &eventName);
 	int32_t getEvent();
+	// Names an event taken with getEvent() after what it is registered as
+	void setEventName(int32_t scriptId, const std::string &eventName);
 	int32_t getMetaEvent(const std::string &globalName, const std::string &eventName);
 
 	const std::string &getInterfaceName() const {
@@ -91,6 +91,7 @@ public:
 			return false;
 		}
 
+		scriptInterface->setEventName(id, getEventKind());
 		setLoadedCallback(true);
 		scriptId = id;
 		return true;
@@ -100,6 +101,11 @@ public:
 	// Script type (Action, CreatureEvent, GlobalEvent, MoveEvent, Spell, Weapon)
 	virtual std::string getScriptTypeName() const = 0;
 
+	// What errors and the Lua profiler call the callback (action, movement, ...)
+	virtual std::string getEventKind() const {
+		return "callback";
+	}
+
 	// Method to access the scriptInterface in derived classes
 	virtual LuaScriptInterface* getScriptInterface() const {
 		return scriptInterface;
@@ -235,7 +235,7 @@ private:
 	AccessList guestList;
 	AccessList subOwnerList;
 
-	std::shared_ptr<Container> transfer_container = std::make_shared<Container>(ITEM_LOCKER);
+	std::shared_ptr<Container> transfer_container = makePooled<Container, ItemPool>(ITEM_LOCKER);
 
 	HouseTileList houseTiles;
 	std::list<std::shared_ptr<Door>> doorList;
@@ -33,6 +33,11 @@ void Map::load(const std::string &identifier, const Position &pos) {
 }
 
 void Map::loadMap(const std::string &identifier, bool mainMap /*= false*/, bool loadHouses /*= false*/, bool loadMonsters /*= false*/, bool loadNpcs /*= false*/, bool loadZones /*= false*/, const Position &pos /*= Position()*/) {
+	loadMapFile(identifier, mainMap, pos);
+	loadMapData(mainMap, loadHouses, loadMonsters, loadNpcs, loadZones);
+}
+
+void Map::loadMapFile(const std::string &identifier, bool mainMap /*= false*/, const Position &pos /*= Position()*/) {
 	// Only download map if is loading the main map and it is not already downloaded
 	if (mainMap && g_configManager().getBoolean(TOGGLE_DOWNLOAD_MAP) && !std::filesystem::exists(identifier)) {
 		const auto mapDownloadUrl = g_configManager().getString(MAP_DOWNLOAD_URL);
@@ -55,6 +60,11 @@ void Map::loadMap(const std::string &identifier, bool mainMap /*= false*/, bool
 
 	// Load the map
 	load(identifier, pos);
+}
+
+void Map::loadMapData(bool mainMap /*= false*/, bool loadHouses /*= false*/, bool loadMonsters /*= false*/, bool loadNpcs /*= false*/, bool loadZones /*= false*/) {
+	addZonePositions();
+	zonesReady = true;
 
 	// Only create items from lua functions if is loading main map
 	// It needs to be after the load map to ensure the map already exists before creating the items
@@ -101,6 +111,7 @@ void Map::loadMap(const std::string &identifier, bool mainMap /*= false*/, bool
 void Map::loadMapCustom(const std::string &mapName, bool loadHouses, bool loadMonsters, bool loadNpcs, bool loadZones, int customMapIndex) {
 	// Load the map
 	load(g_configManager().getString(DATA_DIRECTORY) + "/world/custom/" + mapName + ".otbm");
+	addZonePositions();
 
 	if (loadMonsters && !IOMap::loadMonstersCustom(this, mapName, customMapIndex)) {
 		g_logger().warn("Failed to load monster custom data");
@@ -146,9 +157,9 @@ std::shared_ptr<Tile> Map::getOrCreateTile(uint16_t x, uint16_t y, uint8_t z, bo
 	auto tile = getTile(x, y, z);
 	if (!tile) {
 		if (isDynamic) {
-			tile = std::make_shared<DynamicTile>(x, y, z);
+			tile = makePooled<DynamicTile, TilePool>(x, y, z);
 		} else {
-			tile = std::make_shared<StaticTile>(x, y, z);
+			tile = makePooled<StaticTile, TilePool>(x, y, z);
 		}
 
 		setTile(x, y, z, tile);
@@ -196,6 +207,10 @@ std::shared_ptr<Tile> Map::getTile(uint16_t x, uint16_t y, uint8_t z) {
 }
 
 void Map::refreshZones(uint16_t x, uint16_t y, uint8_t z) {
+	if (!zonesReady) {
+		return;
+	}
+
 	const auto tile = getLoadedTile(x, y, z);
 	if (!tile) {
 		return;
@@ -208,17 +223,31 @@ void Map::refreshZones(uint16_t x, uint16_t y, uint8_t z) {
 	}
 }
 
+void Map::addZonePositions() {
+	for (const auto &[zoneId, position] : zonePositions) {
+		Zone::getZone(zoneId)->addPosition(position);
+	}
+	zonePositions.clear();
+}
+
 void Map::setTile(uint16_t x, uint16_t y, uint8_t z, std::shared_ptr<Tile> newTile) {
 	if (z >= MAP_MAX_LAYERS) {
 		g_logger().error("Attempt to set tile on invalid coordinate: {}", Position(x, y, z).toString());
 		return;
 	}
 
-	if (const auto leaf = getQTNode(x, y)) {
-		leaf->createFloor(z)->setTile(x, y, newTile);
-	} else {
-		root.getBestLeaf(x, y, 15)->createFloor(z)->setTile(x, y, newTile);
+	auto leaf = getQTNode(x, y);
+	if (!leaf) {
+		leaf = root.getBestLeaf(x, y, 15);
+	}
+
+	const auto &floor = leaf->createFloor(z);
+	if (!floor->getTile(x, y) && newTile) {
+		++loadedTileCount;
+	} else if (floor->getTile(x, y) && !newTile) {
+		--loadedTileCount;
 	}
+	floor->setTile(x, y, newTile);
 }
 
 bool Map::placeCreature(const Position &centerPos, std::shared_ptr<Creature> creature, bool extendedPos /* = false*/, bool forceLogin /* = false*/) {
@@ -31,6 +31,9 @@ class FrozenPathingConditionCall;
  */
 class Map : protected MapCache {
 public:
+	using MapCache::getCachedTileCount;
+	using MapCache::getLoadedTileCount;
+
 	static uint32_t clean();
 
 	std::filesystem::path getPath() const {
@@ -51,6 +54,15 @@ public:
 	 * \returns true if the main map was loaded successfully
 	 */
 	void loadMap(const std::string &identifier, bool mainMap = false, bool loadHouses = false, bool loadMonsters = false, bool loadNpcs = false, bool loadZones = false, const Position &pos = Position());
+	/**
+	 * First half of loadMap, parses the .otbm file (downloading the main map if missing)
+	 * It only needs the item types, so it can run while the scripts are loading
+	 */
+	void loadMapFile(const std::string &identifier, bool mainMap = false, const Position &pos = Position());
+	/**
+	 * Second half of loadMap, loads the lua items, spawns, houses and zones of the parsed map
+	 */
+	void loadMapData(bool mainMap = false, bool loadHouses = false, bool loadMonsters = false, bool loadNpcs = false, bool loadZones = false);
 	/**
 	 * Load the custom map
 	 * \param identifier Is the map custom folder
@@ -153,6 +165,8 @@ private:
 		setTile(pos.x, pos.y, pos.z, newTile);
 	}
 	std::shared_ptr<Tile> getLoadedTile(uint16_t x, uint16_t y, uint8_t z);
+	// Hands the zone positions read from the map file to their zones
+	void addZonePositions();
 
 	std::filesystem::path path;
 	std::string monsterfile;
@@ -160,6 +174,13 @@ private:
 	std::string npcfile;
 	std::string zonesfile;
 
+	// The main map file is parsed on the thread pool while the scripts load, so it
+	// leaves the zones alone and keeps their positions here until the map data loads
+	std::vector<std::pair<uint16_t, Position>> zonePositions;
+	// Zone tiles are refreshed by Zone::refreshAll once the map data is loaded, until
+	// then scripts adding zone areas must not walk the tree the parser is filling
+	bool zonesReady = false;
+
 	uint32_t width = 0;
 	uint32_t height = 0;
 
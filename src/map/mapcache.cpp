@@ -114,12 +114,12 @@ std::shared_ptr<Tile> MapCache::getOrCreateTileFromCache(const std::unique_ptr<F
 	std::shared_ptr<Tile> tile = nullptr;
 	if (cachedTile->isHouse()) {
 		const auto house = map->houses.getHouse(cachedTile->houseId);
-		tile = std::make_shared<HouseTile>(x, y, z, house);
+		tile = makePooled<HouseTile, TilePool>(x, y, z, house);
 		house->addTile(std::static_pointer_cast<HouseTile>(tile));
 	} else if (cachedTile->isStatic) {
-		tile = std::make_shared<StaticTile>(x, y, z);
+		tile = makePooled<StaticTile, TilePool>(x, y, z);
 	} else {
-		tile = std::make_shared<DynamicTile>(x, y, z);
+		tile = makePooled<DynamicTile, TilePool>(x, y, z);
 	}
 
 	auto pos = Position(x, y, z);
@@ -137,10 +137,14 @@ std::shared_ptr<Tile> MapCache::getOrCreateTileFromCache(const std::unique_ptr<F
 		tile->addZone(zone);
 	}
 
+	if (!floor->getTile(x, y)) {
+		++loadedTileCount;
+	}
 	floor->setTile(x, y, tile);
 
 	// Remove Tile from cache
 	floor->setTileCache(x, y, nullptr);
+	--cachedTileCount;
 
 	return tile;
 }
@@ -152,11 +156,18 @@ void MapCache::setBasicTile(uint16_t x, uint16_t y, uint8_t z, const std::shared
 	}
 
 	const auto tile = static_tryGetTileFromCache(newTile);
-	if (const auto leaf = QTreeNode::getLeafStatic<QTreeLeafNode*, QTreeNode*>(&root, x, y)) {
-		leaf->createFloor(z)->setTileCache(x, y, tile);
-	} else {
-		root.getBestLeaf(x, y, 15)->createFloor(z)->setTileCache(x, y, tile);
+	auto leaf = QTreeNode::getLeafStatic<QTreeLeafNode*, QTreeNode*>(&root, x, y);
+	if (!leaf) {
+		leaf = root.getBestLeaf(x, y, 15);
+	}
+
+	const auto &floor = leaf->createFloor(z);
+	if (!floor->getTileCache(x, y) && tile) {
+		++cachedTileCount;
+	} else if (floor->getTileCache(x, y) && !tile) {
+		--cachedTileCount;
 	}
+	floor->setTileCache(x, y, tile);
 }
 
 std::shared_ptr<BasicItem> MapCache::tryReplaceItemFromCache(const std::shared_ptr<BasicItem> &ref) {
@@ -120,10 +120,20 @@ public:
 
 	void flush();
 
+	// Tiles still waiting in the cache and tiles already created from it
+	size_t getCachedTileCount() const {
+		return cachedTileCount.load(std::memory_order_relaxed);
+	}
+	size_t getLoadedTileCount() const {
+		return loadedTileCount.load(std::memory_order_relaxed);
+	}
+
 protected:
 	std::shared_ptr<Tile> getOrCreateTileFromCache(const std::unique_ptr<Floor> &floor, uint16_t x, uint16_t y);
 
 	QTreeNode root;
+	std::atomic<size_t> cachedTileCount = 0;
+	std::atomic<size_t> loadedTileCount = 0;
 
 private:
 	void parseItemAttr(const std::shared_ptr<BasicItem> &BasicItem, std::shared_ptr<Item> item);
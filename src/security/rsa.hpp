@@ -26,6 +26,8 @@ public:
 
 	void setKey(const char* pString, const char* qString, int base = 10);
 	void decrypt(char* msg) const;
+	// Encrypts with the public key, for tools talking to the server as a client
+	void encrypt(char* msg) const;
 
 	std::string base64Decrypt(const std::string &input) const;
 	uint16_t decodeLength(char*&pos) const;
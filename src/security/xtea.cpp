@@ -0,0 +1,58 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2022 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include "security/xtea.hpp"
+
+namespace xtea {
+	namespace {
+		constexpr uint32_t delta = 0x61C88647;
+	}
+
+	void encrypt(uint8_t* data, size_t length, const key &k) {
+		std::array<std::array<uint32_t, 2>, 32> precachedControlSum;
+		uint32_t sum = 0;
+		for (auto &controlSum : precachedControlSum) {
+			controlSum[0] = (sum + k[sum & 3]);
+			sum -= delta;
+			controlSum[1] = (sum + k[(sum >> 11) & 3]);
+		}
+
+		for (size_t readPos = 0; readPos < length; readPos += 8) {
+			std::array<uint32_t, 2> vData = {};
+			memcpy(vData.data(), data + readPos, 8);
+			for (const auto &controlSum : precachedControlSum) {
+				vData[0] += ((vData[1] << 4 ^ vData[1] >> 5) + vData[1]) ^ controlSum[0];
+				vData[1] += ((vData[0] << 4 ^ vData[0] >> 5) + vData[0]) ^ controlSum[1];
+			}
+			memcpy(data + readPos, vData.data(), 8);
+		}
+	}
+
+	void decrypt(uint8_t* data, size_t length, const key &k) {
+		std::array<std::array<uint32_t, 2>, 32> precachedControlSum;
+		uint32_t sum = 0xC6EF3720;
+		for (auto &controlSum : precachedControlSum) {
+			controlSum[0] = (sum + k[(sum >> 11) & 3]);
+			sum += delta;
+			controlSum[1] = (sum + k[sum & 3]);
+		}
+
+		for (size_t readPos = 0; readPos < length; readPos += 8) {
+			std::array<uint32_t, 2> vData = {};
+			memcpy(vData.data(), data + readPos, 8);
+			for (const auto &controlSum : precachedControlSum) {
+				vData[1] -= ((vData[0] << 4 ^ vData[0] >> 5) + vData[0]) ^ controlSum[0];
+				vData[0] -= ((vData[1] << 4 ^ vData[1] >> 5) + vData[1]) ^ controlSum[1];
+			}
+			memcpy(data + readPos, vData.data(), 8);
+		}
+	}
+}
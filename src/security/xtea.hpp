@@ -0,0 +1,18 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2022 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+namespace xtea {
+	using key = std::array<uint32_t, 4>;
+
+	// Both work in place, length must be a multiple of 8
+	void encrypt(uint8_t* data, size_t length, const key &k);
+	void decrypt(uint8_t* data, size_t length, const key &k);
+}
@@ -14,6 +14,7 @@
 #include "server/network/protocol/protocol.hpp"
 #include "game/scheduling/dispatcher.hpp"
 #include "server/server.hpp"
+#include "lib/metrics/metrics.hpp"
 
 Connection_ptr ConnectionManager::createConnection(asio::io_service &io_service, ConstServicePort_ptr servicePort) {
 	auto connection = std::make_shared<Connection>(io_service, servicePort);
@@ -209,6 +210,9 @@ void Connection::parseHeader(const std::error_code &error) {
 }
 
 void Connection::parsePacket(const std::error_code &error) {
+	static auto &receivedBytes = g_metrics().counter("canary_network_received_bytes_total", "Bytes received from clients");
+	static auto &receivedMessages = g_metrics().counter("canary_network_received_messages_total", "Messages received from clients");
+
 	std::lock_guard<std::recursive_mutex> lockClass(connectionLock);
 	readTimer.cancel();
 
@@ -219,6 +223,9 @@ void Connection::parsePacket(const std::error_code &error) {
 		return;
 	}
 
+	receivedBytes.add(msg.getLength());
+	receivedMessages.add();
+
 	bool skipReadingNextPacket = false;
 	if (!receivedFirst) {
 		// First message received
@@ -334,6 +341,12 @@ uint32_t Connection::getIP() {
 }
 
 void Connection::internalSend(const OutputMessage_ptr &outputMessage) {
+	static auto &sentBytes = g_metrics().counter("canary_network_sent_bytes_total", "Bytes sent to clients");
+	static auto &sentMessages = g_metrics().counter("canary_network_sent_messages_total", "Messages sent to clients");
+
+	sentBytes.add(outputMessage->getLength());
+	sentMessages.add();
+
 	try {
 		writeTimer.expires_from_now(std::chrono::seconds(CONNECTION_WRITE_TIMEOUT));
 		writeTimer.async_wait(std::bind(&Connection::handleTimeout, std::weak_ptr<Connection>(shared_from_this()), std::placeholders::_1));
@@ -41,6 +41,10 @@ public:
 	void releaseConnection(const Connection_ptr &connection);
 	void closeAll();
 
+	size_t getConnectionCount() const {
+		return connections.size();
+	}
+
 private:
 	phmap::parallel_flat_hash_set_m<Connection_ptr> connections;
 };
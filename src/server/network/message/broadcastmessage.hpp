@@ -0,0 +1,49 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2022 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+#include "server/network/message/networkmessage.hpp"
+
+class BroadcastMessage;
+using BroadcastMessage_ptr = std::shared_ptr<const BroadcastMessage>;
+
+/**
+ * Packet encoded once and appended as is to the output buffer of every spectator.
+ * Holds one payload per client protocol, packets with the same bytes for both
+ * protocols share a single payload.
+ */
+class BroadcastMessage {
+public:
+	using Payload = std::vector<uint8_t>;
+
+	// Shares the payload of msg with every client protocol
+	void setPayload(const NetworkMessage &msg) {
+		current = copyPayload(msg);
+		old = current;
+	}
+
+	// Sets the payload for one client protocol, an unset payload is not sent to it
+	void setPayload(const NetworkMessage &msg, bool oldProtocol) {
+		(oldProtocol ? old : current) = copyPayload(msg);
+	}
+
+	const std::shared_ptr<const Payload> &getPayload(bool oldProtocol) const {
+		return oldProtocol ? old : current;
+	}
+
+private:
+	static std::shared_ptr<const Payload> copyPayload(const NetworkMessage &msg) {
+		const uint8_t* begin = msg.getBuffer() + NetworkMessage::INITIAL_BUFFER_POSITION;
+		return std::make_shared<const Payload>(begin, begin + msg.getLength());
+	}
+
+	std::shared_ptr<const Payload> current;
+	std::shared_ptr<const Payload> old;
+};
@@ -12,9 +12,30 @@
 #include "outputmessage.hpp"
 #include "server/network/protocol/protocol.hpp"
 #include "game/scheduling/dispatcher.hpp"
+#include "lib/metrics/metrics.hpp"
 
 const std::chrono::milliseconds OUTPUTMESSAGE_AUTOSEND_DELAY { 10 };
 
+namespace {
+	MetricGauge &outputMessagesInUse() {
+		static auto &gauge = g_metrics().gauge("canary_output_messages", "Output messages alive, queued or being written");
+		return gauge;
+	}
+
+	MetricGauge &autosendProtocols() {
+		static auto &gauge = g_metrics().gauge("canary_output_autosend_protocols", "Protocols flushed by the output message autosend");
+		return gauge;
+	}
+}
+
+OutputMessage::OutputMessage() {
+	outputMessagesInUse().add();
+}
+
+OutputMessage::~OutputMessage() {
+	outputMessagesInUse().sub();
+}
+
 void OutputMessagePool::scheduleSendAll() {
 	auto function = std::bind_front(&OutputMessagePool::sendAll, this);
 	g_dispatcher().scheduleEvent(OUTPUTMESSAGE_AUTOSEND_DELAY.count(), function, "OutputMessagePool::sendAll");
@@ -40,6 +61,7 @@ void OutputMessagePool::addProtocolToAutosend(Protocol_ptr protocol) {
 		scheduleSendAll();
 	}
 	bufferedProtocols.emplace_back(protocol);
+	autosendProtocols().set(static_cast<int64_t>(bufferedProtocols.size()));
 }
 
 void OutputMessagePool::removeProtocolFromAutosend(const Protocol_ptr &protocol) {
@@ -48,9 +70,12 @@ void OutputMessagePool::removeProtocolFromAutosend(const Protocol_ptr &protocol)
 	if (it != bufferedProtocols.end()) {
 		*it = bufferedProtocols.back();
 		bufferedProtocols.pop_back();
+		autosendProtocols().set(static_cast<int64_t>(bufferedProtocols.size()));
 	}
 }
 
 OutputMessage_ptr OutputMessagePool::getOutputMessage() {
+	static auto &allocated = g_metrics().counter("canary_output_messages_allocated_total", "Output messages handed out by the pool");
+	allocated.add();
 	return std::make_shared<OutputMessage>();
 }
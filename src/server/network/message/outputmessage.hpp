@@ -17,7 +17,8 @@ class Protocol;
 
 class OutputMessage : public NetworkMessage {
 public:
-	OutputMessage() = default;
+	OutputMessage();
+	~OutputMessage();
 
 	// non-copyable
 	OutputMessage(const OutputMessage &) = delete;
@@ -53,6 +54,12 @@ public:
 		info.position += msgLen;
 	}
 
+	void append(const uint8_t* bytes, MsgSize_t bytesLen) {
+		memcpy(buffer + info.position, bytes, bytesLen);
+		info.length += bytesLen;
+		info.position += bytesLen;
+	}
+
 private:
 	template <typename T>
 	void add_header(T addHeader) {
@@ -0,0 +1,90 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2022 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include "server/network/protocol/known_creatures.hpp"
+
+bool KnownCreatures::add(uint32_t id, uint32_t &forgotten, const std::function<bool(uint32_t)> &canForget) {
+	forgotten = 0;
+	if (auto it = nodeIndexes.find(id); it != nodeIndexes.end()) {
+		unlink(it->second);
+		pushFront(it->second);
+		return true;
+	}
+
+	uint32_t index;
+	if (!freeNodes.empty()) {
+		index = freeNodes.back();
+		freeNodes.pop_back();
+	} else {
+		index = static_cast<uint32_t>(nodes.size());
+		nodes.emplace_back();
+	}
+	nodes[index].id = id;
+	nodeIndexes.emplace(id, index);
+	pushFront(index);
+
+	if (nodeIndexes.size() <= CLIENT_LIMIT) {
+		return false;
+	}
+
+	// Every other creature is looked at once at most, those kept move to the front
+	for (size_t checked = 1; checked < nodeIndexes.size(); ++checked) {
+		const uint32_t candidate = tail;
+		if (canForget(nodes[candidate].id)) {
+			forgotten = nodes[candidate].id;
+			erase(candidate);
+			return false;
+		}
+
+		unlink(candidate);
+		pushFront(candidate);
+	}
+
+	// None may be forgotten, the least recently sent goes anyway
+	const uint32_t candidate = nodes[tail].id != id ? tail : nodes[tail].prev;
+	forgotten = nodes[candidate].id;
+	erase(candidate);
+	return false;
+}
+
+void KnownCreatures::pushFront(uint32_t index) {
+	Node &node = nodes[index];
+	node.prev = NONE;
+	node.next = head;
+	if (head != NONE) {
+		nodes[head].prev = index;
+	} else {
+		tail = index;
+	}
+	head = index;
+}
+
+void KnownCreatures::unlink(uint32_t index) {
+	Node &node = nodes[index];
+	if (node.prev != NONE) {
+		nodes[node.prev].next = node.next;
+	} else {
+		head = node.next;
+	}
+
+	if (node.next != NONE) {
+		nodes[node.next].prev = node.prev;
+	} else {
+		tail = node.prev;
+	}
+	node.prev = node.next = NONE;
+}
+
+void KnownCreatures::erase(uint32_t index) {
+	unlink(index);
+	nodeIndexes.erase(nodes[index].id);
+	freeNodes.emplace_back(index);
+}
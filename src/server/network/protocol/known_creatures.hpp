@@ -0,0 +1,59 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2022 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+/**
+ * Creatures the client has cached, in the order they were last sent. The client
+ * holds at most CLIENT_LIMIT of them and forgets the one the server names when a new
+ * creature goes past the limit, so the server picks it from the least recently sent.
+ * A creature that may not be forgotten yet gets a second chance at the front of the
+ * list, which keeps insert, touch and evict constant time when amortized.
+ */
+class KnownCreatures {
+public:
+	static constexpr size_t CLIENT_LIMIT = 1300;
+
+	bool contains(uint32_t id) const {
+		return nodeIndexes.contains(id);
+	}
+
+	size_t size() const {
+		return nodeIndexes.size();
+	}
+
+	/**
+	 * Marks the creature as just sent. For a creature the client did not know yet,
+	 * forgotten is set to the one the client must drop for it, or 0 when the cache is
+	 * not full. canForget tells whether a known creature may be dropped, when none may
+	 * the least recently sent one is dropped anyway.
+	 * @return whether the client already knew the creature
+	 */
+	bool add(uint32_t id, uint32_t &forgotten, const std::function<bool(uint32_t)> &canForget);
+
+private:
+	static constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+
+	struct Node {
+		uint32_t id = 0;
+		// Towards the most recently sent (prev) and the least recently sent (next)
+		uint32_t prev = NONE;
+		uint32_t next = NONE;
+	};
+
+	void pushFront(uint32_t index);
+	void unlink(uint32_t index);
+	void erase(uint32_t index);
+
+	std::vector<Node> nodes;
+	std::vector<uint32_t> freeNodes;
+	phmap::flat_hash_map<uint32_t, uint32_t> nodeIndexes;
+	uint32_t head = NONE;
+	uint32_t tail = NONE;
+};
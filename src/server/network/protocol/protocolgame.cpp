@@ -840,6 +840,62 @@ void ProtocolGame::writeToOutputBuffer(const NetworkMessage &msg) {
 	out->append(msg);
 }
 
+void ProtocolGame::sendBroadcast(const BroadcastMessage_ptr &broadcast) {
+	const auto &payload = broadcast->getPayload(oldProtocol);
+	if (!payload || payload->empty()) {
+		return;
+	}
+
+	auto out = getOutputBuffer(static_cast<int32_t>(payload->size()));
+	out->append(payload->data(), static_cast<NetworkMessage::MsgSize_t>(payload->size()));
+}
+
+BroadcastMessage_ptr ProtocolGame::createMagicEffectBroadcast(const Position &pos, uint16_t type) {
+	auto broadcast = std::make_shared<BroadcastMessage>();
+	NetworkMessage msg;
+	encodeMagicEffect(msg, pos, type, false);
+	broadcast->setPayload(msg, false);
+	if (type <= 0xFF) {
+		msg.reset();
+		encodeMagicEffect(msg, pos, type, true);
+		broadcast->setPayload(msg, true);
+	}
+	return broadcast;
+}
+
+BroadcastMessage_ptr ProtocolGame::createDistanceShootBroadcast(const Position &from, const Position &to, uint16_t type) {
+	auto broadcast = std::make_shared<BroadcastMessage>();
+	NetworkMessage msg;
+	encodeDistanceShoot(msg, from, to, type, false);
+	broadcast->setPayload(msg, false);
+	if (type <= 0xFF) {
+		msg.reset();
+		encodeDistanceShoot(msg, from, to, type, true);
+		broadcast->setPayload(msg, true);
+	}
+	return broadcast;
+}
+
+BroadcastMessage_ptr ProtocolGame::createCreatureHealthBroadcast(const std::shared_ptr<Creature> &creature) {
+	auto broadcast = std::make_shared<BroadcastMessage>();
+	if (creature->isHealthHidden()) {
+		return broadcast;
+	}
+
+	NetworkMessage msg;
+	encodeCreatureHealth(msg, creature);
+	broadcast->setPayload(msg);
+	return broadcast;
+}
+
+BroadcastMessage_ptr ProtocolGame::createChangeSpeedBroadcast(const std::shared_ptr<Creature> &creature, uint16_t speed) {
+	auto broadcast = std::make_shared<BroadcastMessage>();
+	NetworkMessage msg;
+	encodeChangeSpeed(msg, creature, speed);
+	broadcast->setPayload(msg);
+	return broadcast;
+}
+
 void ProtocolGame::parsePacket(NetworkMessage &msg) {
 	if (!acceptPackets || g_game().getGameState() == GAME_STATE_SHUTDOWN || msg.getLength() <= 0) {
 		return;
@@ -1324,33 +1380,74 @@ void ProtocolGame::parseHotkeyEquip(NetworkMessage &msg) {
 	addGameTask(&Game::playerEquipItem, player->getID(), itemId, Item::items[itemId].upgradeClassification > 0, tier);
 }
 
-void ProtocolGame::GetTileDescription(std::shared_ptr<Tile> tile, NetworkMessage &msg) {
-	if (oldProtocol) {
-		msg.add<uint16_t>(0x00); // Env effects
+const TileItemsEncoding &ProtocolGame::getTileItemsEncoding(const std::shared_ptr<Tile> &tile) {
+	TileItemsEncoding &encoding = tile->getItemsEncoding(oldProtocol);
+	if (encoding.version == tile->getItemsVersion()) {
+		return encoding;
 	}
 
-	int32_t count;
-	std::shared_ptr<Item> ground = tile->getGround();
-	if (ground) {
-		AddItem(msg, ground);
-		count = 1;
-	} else {
-		count = 0;
+	// Items showing a running timer change their bytes over time and can't be reused
+	bool cacheable = true;
+	static NetworkMessage scratch;
+	scratch.reset();
+	const auto begin = scratch.getBufferPosition();
+	encoding.offsets.clear();
+
+	const auto encodeItem = [&](const std::shared_ptr<Item> &item) {
+		const ItemType &it = Item::items[item->getID()];
+		if ((it.expire || it.expireStop || it.clockExpire) && item->hasAttribute(ItemAttribute_t::DURATION)) {
+			cacheable = false;
+		}
+		AddItem(scratch, item);
+		encoding.offsets.push_back(static_cast<uint16_t>(scratch.getBufferPosition() - begin));
+	};
+
+	if (std::shared_ptr<Item> ground = tile->getGround()) {
+		encodeItem(ground);
 	}
 
 	const TileItemVector* items = tile->getItemList();
 	if (items) {
-		for (auto it = items->getBeginTopItem(), end = items->getEndTopItem(); it != end; ++it) {
-			AddItem(msg, *it);
+		for (auto it = items->getBeginTopItem(), end = items->getEndTopItem(); it != end && encoding.offsets.size() < 10; ++it) {
+			encodeItem(*it);
+		}
+	}
+	encoding.topCount = static_cast<uint8_t>(encoding.offsets.size());
 
-			count++;
-			if (count == 9 && tile->getPosition() == player->getPosition()) {
-				break;
-			} else if (count == 10) {
-				return;
-			}
+	if (items) {
+		for (auto it = items->getBeginDownItem(), end = items->getEndDownItem(); it != end && encoding.offsets.size() < encoding.topCount + 10u; ++it) {
+			encodeItem(*it);
 		}
 	}
+	encoding.downCount = static_cast<uint8_t>(encoding.offsets.size() - encoding.topCount);
+
+	const uint8_t* bytes = scratch.getBuffer() + begin;
+	encoding.bytes.assign(bytes, bytes + (scratch.getBufferPosition() - begin));
+	encoding.version = cacheable ? tile->getItemsVersion() : 0;
+	return encoding;
+}
+
+void ProtocolGame::GetTileDescription(std::shared_ptr<Tile> tile, NetworkMessage &msg) {
+	if (oldProtocol) {
+		msg.add<uint16_t>(0x00); // Env effects
+	}
+
+	const TileItemsEncoding &encoding = getTileItemsEncoding(tile);
+	const bool isPlayerTile = tile->getPosition() == player->getPosition();
+	const auto addEncodedItems = [&](uint8_t first, uint8_t last) {
+		const uint16_t from = first == 0 ? 0 : encoding.offsets[first - 1];
+		const uint16_t to = encoding.offsets[last - 1];
+		msg.addBytes(reinterpret_cast<const char*>(encoding.bytes.data()) + from, to - from);
+	};
+
+	// Ground and top items, the own tile keeps a slot for the player
+	int32_t count = std::min<int32_t>(encoding.topCount, isPlayerTile ? 9 : 10);
+	if (count > 0) {
+		addEncodedItems(0, static_cast<uint8_t>(count));
+	}
+	if (count == 10) {
+		return;
+	}
 
 	const CreatureVector* creatures = tile->getCreatures();
 	if (creatures) {
@@ -1361,7 +1458,7 @@ void ProtocolGame::GetTileDescription(std::shared_ptr<Tile> tile, NetworkMessage
 				continue;
 			}
 
-			if (tile->getPosition() == player->getPosition() && count == 9 && !playerAdded) {
+			if (isPlayerTile && count == 9 && !playerAdded) {
 				creature = player;
 			}
 
@@ -1380,14 +1477,9 @@ void ProtocolGame::GetTileDescription(std::shared_ptr<Tile> tile, NetworkMessage
 		}
 	}
 
-	if (items) {
-		for (auto it = items->getBeginDownItem(), end = items->getEndDownItem(); it != end; ++it) {
-			AddItem(msg, *it);
-
-			if (++count == 10) {
-				return;
-			}
-		}
+	const auto downItems = std::min<int32_t>(encoding.downCount, 10 - count);
+	if (downItems > 0) {
+		addEncodedItems(encoding.topCount, static_cast<uint8_t>(encoding.topCount + downItems));
 	}
 }
 
@@ -1439,45 +1531,15 @@ void ProtocolGame::GetFloorDescription(NetworkMessage &msg, int32_t x, int32_t y
 }
 
 void ProtocolGame::checkCreatureAsKnown(uint32_t id, bool &known, uint32_t &removedKnown) {
-	if (auto [creatureKnown, creatureInserted] = knownCreatureSet.insert(id);
-		!creatureInserted) {
-		known = true;
-		return;
-	}
-	known = false;
-	if (knownCreatureSet.size() > 1300) {
-		// Look for a creature to remove
-		for (auto it = knownCreatureSet.begin(), end = knownCreatureSet.end(); it != end; ++it) {
-			if (*it == id) {
-				continue;
-			}
-			// We need to protect party players from removing
-			std::shared_ptr<Creature> creature = g_game().getCreatureByID(*it);
-			if (std::shared_ptr<Player> checkPlayer;
-				creature && (checkPlayer = creature->getPlayer()) != nullptr) {
-				if (player->getParty() != checkPlayer->getParty() && !canSee(creature)) {
-					removedKnown = *it;
-					knownCreatureSet.erase(it);
-					return;
-				}
-			} else if (!canSee(creature)) {
-				removedKnown = *it;
-				knownCreatureSet.erase(it);
-				return;
-			}
+	known = knownCreatures.add(id, removedKnown, [this](uint32_t knownId) {
+		// We need to protect party players from removing
+		std::shared_ptr<Creature> creature = g_game().getCreatureByID(knownId);
+		if (std::shared_ptr<Player> checkPlayer;
+			creature && (checkPlayer = creature->getPlayer()) != nullptr) {
+			return player->getParty() != checkPlayer->getParty() && !canSee(creature);
 		}
-
-		// Bad situation. Let's just remove anyone.
-		auto it = knownCreatureSet.begin();
-		if (*it == id) {
-			++it;
-		}
-
-		removedKnown = *it;
-		knownCreatureSet.erase(it);
-	} else {
-		removedKnown = 0;
-	}
+		return !canSee(creature);
+	});
 }
 
 bool ProtocolGame::canSee(std::shared_ptr<Creature> c) const {
@@ -4494,7 +4556,7 @@ void ProtocolGame::sendMarketEnter(uint32_t depotId) {
 		msg.add<uint64_t>(player->getBankBalance());
 	}
 
-	msg.addByte(static_cast<uint8_t>(std::min<uint32_t>(IOMarket::getPlayerOfferCount(player->getGUID()), std::numeric_limits<uint8_t>::max())));
+	msg.addByte(static_cast<uint8_t>(std::min<uint32_t>(g_ioMarket().getPlayerOfferCount(player->getGUID()), std::numeric_limits<uint8_t>::max())));
 
 	std::shared_ptr<DepotLocker> depotLocker = player->getDepotLocker(depotId);
 	if (!depotLocker) {
@@ -5431,7 +5493,7 @@ void ProtocolGame::sendMarketDetail(uint16_t itemId, uint8_t tier) {
 		}
 	}
 
-	auto purchase = IOMarket::getInstance().getPurchaseStatistics()[itemId][tier];
+	const auto purchase = g_ioMarket().getPurchaseStatistics(itemId, tier);
 	if (const MarketStatistics* purchaseStatistics = &purchase; purchaseStatistics) {
 		msg.addByte(0x01);
 		msg.add<uint32_t>(purchaseStatistics->numTransactions);
@@ -5448,7 +5510,7 @@ void ProtocolGame::sendMarketDetail(uint16_t itemId, uint8_t tier) {
 		msg.addByte(0x00); // send to old protocol ?
 	}
 
-	auto sale = IOMarket::getInstance().getSaleStatistics()[itemId][tier];
+	const auto sale = g_ioMarket().getSaleStatistics(itemId, tier);
 	if (const MarketStatistics* saleStatistics = &sale; saleStatistics) {
 		msg.addByte(0x01);
 		msg.add<uint32_t>(saleStatistics->numTransactions);
@@ -5650,11 +5712,15 @@ void ProtocolGame::sendCancelTarget() {
 
 void ProtocolGame::sendChangeSpeed(std::shared_ptr<Creature> creature, uint16_t speed) {
 	NetworkMessage msg;
+	encodeChangeSpeed(msg, creature, speed);
+	writeToOutputBuffer(msg);
+}
+
+void ProtocolGame::encodeChangeSpeed(NetworkMessage &msg, const std::shared_ptr<Creature> &creature, uint16_t speed) {
 	msg.addByte(0x8F);
 	msg.add<uint32_t>(creature->getID());
 	msg.add<uint16_t>(creature->getBaseSpeed());
 	msg.add<uint16_t>(speed);
-	writeToOutputBuffer(msg);
 }
 
 void ProtocolGame::sendCancelWalk() {
@@ -5691,6 +5757,11 @@ void ProtocolGame::sendDistanceShoot(const Position &from, const Position &to, u
 		return;
 	}
 	NetworkMessage msg;
+	encodeDistanceShoot(msg, from, to, type, oldProtocol);
+	writeToOutputBuffer(msg);
+}
+
+void ProtocolGame::encodeDistanceShoot(NetworkMessage &msg, const Position &from, const Position &to, uint16_t type, bool oldProtocol) {
 	if (oldProtocol) {
 		msg.addByte(0x85);
 		msg.addPosition(from);
@@ -5705,7 +5776,6 @@ void ProtocolGame::sendDistanceShoot(const Position &from, const Position &to, u
 		msg.addByte(static_cast<uint8_t>(static_cast<int8_t>(static_cast<int32_t>(to.y) - static_cast<int32_t>(from.y))));
 		msg.addByte(MAGIC_EFFECTS_END_LOOP);
 	}
-	writeToOutputBuffer(msg);
 }
 
 void ProtocolGame::sendRestingStatus(uint8_t protection) {
@@ -5753,6 +5823,19 @@ void ProtocolGame::sendMagicEffect(const Position &pos, uint16_t type) {
 	}
 
 	NetworkMessage msg;
+	encodeMagicEffect(msg, pos, type, oldProtocol);
+	writeToOutputBuffer(msg);
+}
+
+void ProtocolGame::sendMagicEffect(const Position &pos, const BroadcastMessage_ptr &broadcast) {
+	if (!canSee(pos)) {
+		return;
+	}
+
+	sendBroadcast(broadcast);
+}
+
+void ProtocolGame::encodeMagicEffect(NetworkMessage &msg, const Position &pos, uint16_t type, bool oldProtocol) {
 	if (oldProtocol) {
 		msg.addByte(0x83);
 		msg.addPosition(pos);
@@ -5764,7 +5847,6 @@ void ProtocolGame::sendMagicEffect(const Position &pos, uint16_t type) {
 		msg.add<uint16_t>(type);
 		msg.addByte(MAGIC_EFFECTS_END_LOOP);
 	}
-	writeToOutputBuffer(msg);
 }
 
 void ProtocolGame::removeMagicEffect(const Position &pos, uint16_t type) {
@@ -5788,6 +5870,11 @@ void ProtocolGame::sendCreatureHealth(std::shared_ptr<Creature> creature) {
 	}
 
 	NetworkMessage msg;
+	encodeCreatureHealth(msg, creature);
+	writeToOutputBuffer(msg);
+}
+
+void ProtocolGame::encodeCreatureHealth(NetworkMessage &msg, const std::shared_ptr<Creature> &creature) {
 	msg.addByte(0x8C);
 	msg.add<uint32_t>(creature->getID());
 	if (creature->isHealthHidden()) {
@@ -5795,8 +5882,6 @@ void ProtocolGame::sendCreatureHealth(std::shared_ptr<Creature> creature) {
 	} else {
 		msg.addByte(static_cast<uint8_t>(std::min<double>(100, std::ceil((static_cast<double>(creature->getHealth()) / std::max<int32_t>(creature->getMaxHealth(), 1)) * 100))));
 	}
-
-	writeToOutputBuffer(msg);
 }
 
 void ProtocolGame::sendPartyCreatureUpdate(std::shared_ptr<Creature> target) {
@@ -5819,7 +5904,7 @@ void ProtocolGame::sendPartyCreatureUpdate(std::shared_ptr<Creature> target) {
 
 void ProtocolGame::sendPartyCreatureShield(std::shared_ptr<Creature> target) {
 	uint32_t cid = target->getID();
-	if (knownCreatureSet.find(cid) == knownCreatureSet.end()) {
+	if (!knownCreatures.contains(cid)) {
 		sendPartyCreatureUpdate(target);
 		return;
 	}
@@ -5837,7 +5922,7 @@ void ProtocolGame::sendPartyCreatureSkull(std::shared_ptr<Creature> target) {
 	}
 
 	uint32_t cid = target->getID();
-	if (knownCreatureSet.find(cid) == knownCreatureSet.end()) {
+	if (!knownCreatures.contains(cid)) {
 		sendPartyCreatureUpdate(target);
 		return;
 	}
@@ -5851,7 +5936,7 @@ void ProtocolGame::sendPartyCreatureSkull(std::shared_ptr<Creature> target) {
 
 void ProtocolGame::sendPartyCreatureHealth(std::shared_ptr<Creature> target, uint8_t healthPercent) {
 	uint32_t cid = target->getID();
-	if (knownCreatureSet.find(cid) == knownCreatureSet.end()) {
+	if (!knownCreatures.contains(cid)) {
 		sendPartyCreatureUpdate(target);
 		return;
 	}
@@ -5865,7 +5950,7 @@ void ProtocolGame::sendPartyCreatureHealth(std::shared_ptr<Creature> target, uin
 
 void ProtocolGame::sendPartyPlayerMana(std::shared_ptr<Player> target, uint8_t manaPercent) {
 	uint32_t cid = target->getID();
-	if (knownCreatureSet.find(cid) == knownCreatureSet.end()) {
+	if (!knownCreatures.contains(cid)) {
 		sendPartyCreatureUpdate(target);
 	}
 
@@ -5883,7 +5968,7 @@ void ProtocolGame::sendPartyPlayerMana(std::shared_ptr<Player> target, uint8_t m
 
 void ProtocolGame::sendPartyCreatureShowStatus(std::shared_ptr<Creature> target, bool showStatus) {
 	uint32_t cid = target->getID();
-	if (knownCreatureSet.find(cid) == knownCreatureSet.end()) {
+	if (!knownCreatures.contains(cid)) {
 		sendPartyCreatureUpdate(target);
 	}
 
@@ -5901,7 +5986,7 @@ void ProtocolGame::sendPartyCreatureShowStatus(std::shared_ptr<Creature> target,
 
 void ProtocolGame::sendPartyPlayerVocation(std::shared_ptr<Player> target) {
 	uint32_t cid = target->getID();
-	if (knownCreatureSet.find(cid) == knownCreatureSet.end()) {
+	if (!knownCreatures.contains(cid)) {
 		sendPartyCreatureUpdate(target);
 		return;
 	}
@@ -7808,8 +7893,7 @@ void ProtocolGame::reloadCreature(std::shared_ptr<Creature> creature) {
 
 	NetworkMessage msg;
 
-	phmap::flat_hash_set<uint32_t>::iterator it = std::find(knownCreatureSet.begin(), knownCreatureSet.end(), creature->getID());
-	if (it != knownCreatureSet.end()) {
+	if (knownCreatures.contains(creature->getID())) {
 		msg.addByte(0x6B);
 		msg.addPosition(creature->getPosition());
 		msg.addByte(stackpos);
@@ -10,8 +10,10 @@
 #pragma once
 
 #include "server/network/protocol/protocol.hpp"
+#include "server/network/message/broadcastmessage.hpp"
 #include "creatures/interactions/chat.hpp"
 #include "creatures/creature.hpp"
+#include "server/network/protocol/known_creatures.hpp"
 
 class NetworkMessage;
 class Player;
@@ -67,6 +69,12 @@ public:
 		return version;
 	}
 
+	// Packets encoded once for every spectator, see BroadcastMessage
+	static BroadcastMessage_ptr createMagicEffectBroadcast(const Position &pos, uint16_t type);
+	static BroadcastMessage_ptr createDistanceShootBroadcast(const Position &from, const Position &to, uint16_t type);
+	static BroadcastMessage_ptr createCreatureHealthBroadcast(const std::shared_ptr<Creature> &creature);
+	static BroadcastMessage_ptr createChangeSpeedBroadcast(const std::shared_ptr<Creature> &creature, uint16_t speed);
+
 private:
 	// Helpers so we don't need to bind every time
 	template <typename Callable, typename... Args>
@@ -81,6 +89,11 @@ private:
 	void disconnectClient(const std::string &message) const;
 	void writeToOutputBuffer(const NetworkMessage &msg);
 
+	static void encodeMagicEffect(NetworkMessage &msg, const Position &pos, uint16_t type, bool oldProtocol);
+	static void encodeDistanceShoot(NetworkMessage &msg, const Position &from, const Position &to, uint16_t type, bool oldProtocol);
+	static void encodeCreatureHealth(NetworkMessage &msg, const std::shared_ptr<Creature> &creature);
+	static void encodeChangeSpeed(NetworkMessage &msg, const std::shared_ptr<Creature> &creature, uint16_t speed);
+
 	void release() override;
 
 	void checkCreatureAsKnown(uint32_t id, bool &known, uint32_t &removedKnown);
@@ -272,8 +285,10 @@ private:
 	void sendBosstiaryEntryChanged(uint32_t bossid);
 
 	void sendAllowBugReport();
+	void sendBroadcast(const BroadcastMessage_ptr &broadcast);
 	void sendDistanceShoot(const Position &from, const Position &to, uint16_t type);
 	void sendMagicEffect(const Position &pos, uint16_t type);
+	void sendMagicEffect(const Position &pos, const BroadcastMessage_ptr &broadcast);
 	void removeMagicEffect(const Position &pos, uint16_t type);
 	void sendRestingStatus(uint8_t protection);
 	void sendCreatureHealth(std::shared_ptr<Creature> creature);
@@ -420,6 +435,8 @@ private:
 	// Help functions
 	// translate a tile to clientreadable format
 	void GetTileDescription(std::shared_ptr<Tile> tile, NetworkMessage &msg);
+	// encoded ground and items of a tile, shared by every player describing it
+	const TileItemsEncoding &getTileItemsEncoding(const std::shared_ptr<Tile> &tile);
 
 	// translate a floor to clientreadable format
 	void GetFloorDescription(NetworkMessage &msg, int32_t x, int32_t y, int32_t z, int32_t width, int32_t height, int32_t offset, int32_t &skip);
@@ -471,7 +488,7 @@ private:
 	friend class Player;
 	friend class PlayerWheel;
 
-	phmap::flat_hash_set<uint32_t> knownCreatureSet;
+	KnownCreatures knownCreatures;
 	std::shared_ptr<Player> player = nullptr;
 
 	uint32_t eventConnect = 0;
@@ -20,29 +20,84 @@ std::string ProtocolStatus::SERVER_NAME = "Canary";
 std::string ProtocolStatus::SERVER_VERSION = "3.0";
 std::string ProtocolStatus::SERVER_DEVELOPERS = "OpenTibiaBR Organization";
 
-std::map<uint32_t, int64_t> ProtocolStatus::ipConnectMap;
 const uint64_t ProtocolStatus::start = OTSYS_TIME();
 
+std::mutex ProtocolStatus::statusMutex;
+std::shared_ptr<const std::string> ProtocolStatus::statusString;
+int64_t ProtocolStatus::statusStringTime = 0;
+std::atomic<bool> ProtocolStatus::statusStringOutdated = false;
+std::atomic<bool> ProtocolStatus::statusStringUpdating = false;
+
+namespace {
+	// A changed player count shows up after a second at most, the rest after half a minute
+	constexpr int64_t STATUS_STRING_MIN_AGE = 1000;
+	constexpr int64_t STATUS_STRING_MAX_AGE = 30000;
+
+	/**
+	 * Time of the last status request of recent IPs. Every IP hashes to one entry and
+	 * replaces whatever IP was there, so a scan from many addresses cannot grow it, at
+	 * worst an IP gets through before its timeout. Only used from the I/O thread.
+	 */
+	class StatusRequestTimes {
+	public:
+		bool isTooSoon(uint32_t ip, int64_t now, int64_t timeout) const {
+			const Entry &entry = entries[getIndex(ip)];
+			return entry.ip == ip && now < entry.time + timeout;
+		}
+
+		void set(uint32_t ip, int64_t now) {
+			entries[getIndex(ip)] = { ip, now };
+		}
+
+	private:
+		static constexpr uint32_t INDEX_BITS = 12;
+
+		struct Entry {
+			uint32_t ip = 0;
+			int64_t time = 0;
+		};
+
+		static size_t getIndex(uint32_t ip) {
+			// Fibonacci hashing, consecutive addresses spread over the whole table
+			return static_cast<uint32_t>(ip * 2654435761U) >> (32 - INDEX_BITS);
+		}
+
+		std::array<Entry, 1 << INDEX_BITS> entries {};
+	};
+
+	StatusRequestTimes statusRequestTimes;
+}
+
 void ProtocolStatus::onRecvFirstMessage(NetworkMessage &msg) {
 	uint32_t ip = getIP();
+	const int64_t now = OTSYS_TIME();
 	if (ip != 0x0100007F) {
 		std::string ipStr = convertIPToString(ip);
-		if (ipStr != g_configManager().getString(IP)) {
-			std::map<uint32_t, int64_t>::const_iterator it = ipConnectMap.find(ip);
-			if (it != ipConnectMap.end() && (OTSYS_TIME() < (it->second + g_configManager().getNumber(STATUSQUERY_TIMEOUT)))) {
-				disconnect();
-				return;
-			}
+		if (ipStr != g_configManager().getString(IP) && statusRequestTimes.isTooSoon(ip, now, g_configManager().getNumber(STATUSQUERY_TIMEOUT))) {
+			disconnect();
+			return;
 		}
 	}
 
-	ipConnectMap[ip] = OTSYS_TIME();
+	statusRequestTimes.set(ip, now);
 
 	switch (msg.getByte()) {
 		// XML info protocol
 		case 0xFF: {
 			if (msg.getString(4) == "info") {
-				g_dispatcher().addEvent(std::bind(&ProtocolStatus::sendStatusString, std::static_pointer_cast<ProtocolStatus>(shared_from_this())), "ProtocolStatus::sendStatusString");
+				if (const auto status = getStatusString()) {
+					sendStatusString(status);
+					return;
+				}
+
+				// Nothing was built yet
+				g_dispatcher().addEvent(
+					[self = std::static_pointer_cast<ProtocolStatus>(shared_from_this())] {
+						updateStatusString();
+						self->sendStatusString(getStatusString());
+					},
+					"ProtocolStatus::sendStatusString"
+				);
 				return;
 			}
 			break;
@@ -65,11 +120,49 @@ void ProtocolStatus::onRecvFirstMessage(NetworkMessage &msg) {
 	disconnect();
 }
 
-void ProtocolStatus::sendStatusString() {
+void ProtocolStatus::sendStatusString(const std::shared_ptr<const std::string> &status) {
 	auto output = OutputMessagePool::getOutputMessage();
 
 	setRawMessages(true);
 
+	output->addBytes(status->data(), status->size());
+	send(output);
+	disconnect();
+}
+
+void ProtocolStatus::invalidateStatusString() {
+	statusStringOutdated = true;
+}
+
+std::shared_ptr<const std::string> ProtocolStatus::getStatusString() {
+	std::shared_ptr<const std::string> status;
+	bool outdated;
+	{
+		std::scoped_lock lock(statusMutex);
+		status = statusString;
+		const int64_t age = OTSYS_TIME() - statusStringTime;
+		outdated = age >= STATUS_STRING_MAX_AGE || (statusStringOutdated && age >= STATUS_STRING_MIN_AGE);
+	}
+
+	// The outdated status is still served while the dispatcher builds the next one
+	if (status && outdated && !statusStringUpdating.exchange(true)) {
+		g_dispatcher().addEvent(&ProtocolStatus::updateStatusString, "ProtocolStatus::updateStatusString");
+	}
+	return status;
+}
+
+void ProtocolStatus::updateStatusString() {
+	// Cleared first, a player logging in meanwhile is seen by the next build
+	statusStringOutdated = false;
+	auto status = std::make_shared<const std::string>(buildStatusString());
+
+	std::scoped_lock lock(statusMutex);
+	statusString = std::move(status);
+	statusStringTime = OTSYS_TIME();
+	statusStringUpdating = false;
+}
+
+std::string ProtocolStatus::buildStatusString() {
 	pugi::xml_document doc;
 
 	pugi::xml_node decl = doc.prepend_child(pugi::node_declaration);
@@ -142,11 +235,7 @@ void ProtocolStatus::sendStatusString() {
 
 	std::ostringstream ss;
 	doc.save(ss, "", pugi::format_raw);
-
-	std::string data = ss.str();
-	output->addBytes(data.c_str(), data.size());
-	send(output);
-	disconnect();
+	return ss.str();
 }
 
 void ProtocolStatus::sendInfo(uint16_t requestedInfo, const std::string &characterName) {
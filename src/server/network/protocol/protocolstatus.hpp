@@ -27,9 +27,12 @@ public:
 
 	void onRecvFirstMessage(NetworkMessage &msg) override;
 
-	void sendStatusString();
+	void sendStatusString(const std::shared_ptr<const std::string> &statusString);
 	void sendInfo(uint16_t requestedInfo, const std::string &characterName);
 
+	// The online player count changed, the next status request rebuilds the status string
+	static void invalidateStatusString();
+
 	static const uint64_t start;
 
 	static std::string SERVER_NAME;
@@ -37,5 +40,19 @@ public:
 	static std::string SERVER_DEVELOPERS;
 
 private:
-	static std::map<uint32_t, int64_t> ipConnectMap;
+	/**
+	 * The XML status is built on the dispatcher and kept as a snapshot, which the I/O
+	 * thread serves directly. A request finding it outdated has it rebuilt in the
+	 * background, at most once a second, so polling does not reach the dispatcher.
+	 */
+	static std::shared_ptr<const std::string> getStatusString();
+	// Dispatcher only
+	static void updateStatusString();
+	static std::string buildStatusString();
+
+	static std::mutex statusMutex;
+	static std::shared_ptr<const std::string> statusString;
+	static int64_t statusStringTime;
+	static std::atomic<bool> statusStringOutdated;
+	static std::atomic<bool> statusStringUpdating;
 };
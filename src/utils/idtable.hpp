@@ -0,0 +1,84 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2022 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// id_table maps small integer ids (item ids, action ids, unique ids) to values.
+// A slot vector indexed by the id holds the position of its value, so a lookup is a
+// bounds check and a load, and an id without a value only costs one slot.
+// Note: references to values are invalidated when a new id is added.
+
+namespace stdext {
+	template <typename T>
+	class id_table {
+	public:
+		T* find(uint32_t id) {
+			const uint32_t slot = getSlot(id);
+			return slot != 0 ? &values[slot - 1] : nullptr;
+		}
+
+		const T* find(uint32_t id) const {
+			const uint32_t slot = getSlot(id);
+			return slot != 0 ? &values[slot - 1] : nullptr;
+		}
+
+		bool contains(uint32_t id) const {
+			return getSlot(id) != 0;
+		}
+
+		// Value of the id, default constructed when it has none yet
+		T &operator[](uint32_t id) {
+			if (id >= slots.size()) {
+				slots.resize(id + 1, 0);
+			}
+
+			uint32_t &slot = slots[id];
+			if (slot == 0) {
+				values.emplace_back();
+				slot = static_cast<uint32_t>(values.size());
+			}
+			return values[slot - 1];
+		}
+
+		// Same as std::map::try_emplace, an id that already has a value keeps it
+		bool try_emplace(uint32_t id, T value) {
+			if (contains(id)) {
+				return false;
+			}
+
+			(*this)[id] = std::move(value);
+			return true;
+		}
+
+		void clear() noexcept {
+			slots.clear();
+			values.clear();
+		}
+
+		bool empty() const noexcept {
+			return values.empty();
+		}
+
+		size_t size() const noexcept {
+			return values.size();
+		}
+
+	private:
+		uint32_t getSlot(uint32_t id) const {
+			return id < slots.size() ? slots[id] : 0;
+		}
+
+		// Zero for ids without a value, otherwise the index of the value plus one
+		std::vector<uint32_t> slots;
+		std::vector<T> values;
+	};
+}
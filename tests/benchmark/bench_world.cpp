@@ -0,0 +1,107 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2023 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include "bench_world.hpp"
+#include "config/configmanager.hpp"
+#include "creatures/players/player.hpp"
+#include "game/game.hpp"
+#include "items/item.hpp"
+#include "items/tile.hpp"
+
+BenchWorld &BenchWorld::get() {
+	static BenchWorld world;
+	return world;
+}
+
+bool BenchWorld::load(const std::string &configFile) {
+	g_configManager().setConfigFileLua(configFile);
+	if (!g_configManager().load()) {
+		g_logger().error("[BenchWorld::load] - Failed to load {}", configFile);
+		return false;
+	}
+
+	const auto coreFolder = g_configManager().getString(CORE_DIRECTORY);
+	if (g_game().loadAppearanceProtobuf(coreFolder + "/items/appearances.dat") != ERROR_NONE || !Item::items.loadFromXml()) {
+		g_logger().error("[BenchWorld::load] - Failed to load the item definitions from {}/items", coreFolder);
+		return false;
+	}
+
+	return get().build();
+}
+
+bool BenchWorld::build() {
+	for (size_t id = 100; id < Item::items.size(); ++id) {
+		const ItemType &itemType = Item::items[id];
+		if (itemType.id == 0) {
+			continue;
+		}
+
+		if (groundId == 0 && itemType.isGroundTile() && itemType.speed > 0 && !itemType.blockSolid) {
+			groundId = itemType.id;
+		} else if (wallId == 0 && !itemType.isGroundTile() && itemType.blockSolid && itemType.blockProjectile && !itemType.moveable) {
+			wallId = itemType.id;
+		} else if (decayingId == 0 && !itemType.isGroundTile() && itemType.decayTime > 0 && itemType.decayTo >= 0) {
+			decayingId = itemType.id;
+		}
+	}
+
+	if (groundId == 0 || wallId == 0 || decayingId == 0) {
+		g_logger().error("[BenchWorld::build] - The item definitions have no usable ground, wall or decaying item");
+		return false;
+	}
+
+	std::uniform_int_distribution<uint32_t> wallRoll(0, WALL_RATE - 1);
+	for (uint16_t y = ORIGIN; y < ORIGIN + SIZE; ++y) {
+		for (uint16_t x = ORIGIN; x < ORIGIN + SIZE; ++x) {
+			const auto tile = std::make_shared<DynamicTile>(x, y, FLOOR);
+			tile->internalAddThing(Item::CreateItem(groundId));
+			// Keep the center free, benchmarks start searches from it
+			if (wallRoll(random) == 0 && Position::getDistanceX(Position(x, y, FLOOR), getCenter()) > 1) {
+				tile->internalAddThing(Item::CreateItem(wallId));
+			}
+			g_game().map.setTile(x, y, FLOOR, tile);
+		}
+	}
+
+	storageTile = std::make_shared<DynamicTile>(ORIGIN - 1, ORIGIN - 1, FLOOR);
+	storageTile->internalAddThing(Item::CreateItem(groundId));
+	g_game().map.setTile(storageTile->getPosition(), storageTile);
+	return true;
+}
+
+Position BenchWorld::getRandomPosition() {
+	std::uniform_int_distribution<uint16_t> offset(0, SIZE - 1);
+	const uint16_t x = ORIGIN + offset(random);
+	const uint16_t y = ORIGIN + offset(random);
+	return Position(x, y, FLOOR);
+}
+
+void BenchWorld::populate(size_t count) {
+	while (players.size() > count) {
+		const auto &player = players.back();
+		player->getTile()->removeCreature(player);
+		players.pop_back();
+	}
+
+	while (players.size() < count) {
+		const Position position = getRandomPosition();
+		const auto tile = g_game().map.getTile(position);
+		if (!tile || tile->hasFlag(TILESTATE_BLOCKSOLID)) {
+			continue;
+		}
+
+		// Same steps as Map::placeCreature, without the checks needing a fully loaded player
+		const auto player = std::make_shared<Player>(nullptr);
+		tile->internalAddThing(player);
+		g_game().map.getQTNode(position.x, position.y)->addCreature(player);
+		players.emplace_back(player);
+	}
+}
@@ -0,0 +1,67 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2023 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+#include "game/movement/position.hpp"
+
+class Player;
+class Tile;
+
+/**
+ * Synthetic world shared by the benchmarks: a square of ground tiles on one floor of
+ * the game map, walls scattered over it and a population of players standing on it.
+ * Tiles are built from the real item definitions, loaded once by load().
+ */
+class BenchWorld {
+public:
+	static constexpr uint16_t ORIGIN = 1024;
+	static constexpr uint16_t SIZE = 256;
+	static constexpr uint8_t FLOOR = 7;
+	// One tile out of WALL_RATE is a wall
+	static constexpr uint32_t WALL_RATE = 12;
+
+	// Loads the config file and the item definitions of its core directory, then builds the map
+	static bool load(const std::string &configFile);
+
+	static BenchWorld &get();
+
+	// Adds or removes players until the map has count of them
+	void populate(size_t count);
+
+	Position getCenter() const {
+		return Position(ORIGIN + SIZE / 2, ORIGIN + SIZE / 2, FLOOR);
+	}
+
+	// Position inside the map, the same sequence on every run
+	Position getRandomPosition();
+
+	uint16_t getGroundId() const {
+		return groundId;
+	}
+	uint16_t getDecayingId() const {
+		return decayingId;
+	}
+
+	// Tile outside the map area, used as the parent of loose benchmark items
+	const std::shared_ptr<Tile> &getStorageTile() const {
+		return storageTile;
+	}
+
+private:
+	bool build();
+
+	std::vector<std::shared_ptr<Player>> players;
+	std::shared_ptr<Tile> storageTile;
+	std::mt19937 random { 0x5EED };
+
+	uint16_t groundId = 0;
+	uint16_t wallId = 0;
+	uint16_t decayingId = 0;
+};
@@ -0,0 +1,67 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2023 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include "bench_world.hpp"
+#include "items/item.hpp"
+
+namespace {
+	std::shared_ptr<Item> createAttributedItem() {
+		const auto item = Item::CreateItem(BenchWorld::get().getGroundId());
+		item->setAttribute(ItemAttribute_t::ACTIONID, 1000);
+		item->setAttribute(ItemAttribute_t::CHARGES, 25);
+		item->setAttribute(ItemAttribute_t::DESCRIPTION, std::string("A benchmark item."));
+		item->setAttribute(ItemAttribute_t::TEXT, std::string("Some written text."));
+		item->setCustomAttribute("upgrade", static_cast<int64_t>(3));
+		item->setCustomAttribute("owner", std::string("Benchmark"));
+		return item;
+	}
+}
+
+static void BM_ItemGetIntegerAttribute(benchmark::State &state) {
+	const auto item = createAttributedItem();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(item->getAttribute<uint16_t>(ItemAttribute_t::ACTIONID));
+		benchmark::DoNotOptimize(item->getAttribute<uint16_t>(ItemAttribute_t::CHARGES));
+		benchmark::DoNotOptimize(item->hasAttribute(ItemAttribute_t::UNIQUEID));
+	}
+	state.SetItemsProcessed(state.iterations() * 3);
+}
+BENCHMARK(BM_ItemGetIntegerAttribute);
+
+static void BM_ItemGetStringAttribute(benchmark::State &state) {
+	const auto item = createAttributedItem();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(item->getAttribute<std::string>(ItemAttribute_t::DESCRIPTION));
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ItemGetStringAttribute);
+
+static void BM_ItemSetIntegerAttribute(benchmark::State &state) {
+	const auto item = createAttributedItem();
+	int64_t value = 0;
+	for (auto _ : state) {
+		item->setAttribute(ItemAttribute_t::CHARGES, ++value & 0xFF);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ItemSetIntegerAttribute);
+
+static void BM_ItemGetCustomAttribute(benchmark::State &state) {
+	const auto item = createAttributedItem();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(item->getCustomAttribute("upgrade"));
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ItemGetCustomAttribute);
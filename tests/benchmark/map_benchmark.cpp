@@ -0,0 +1,119 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2023 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include "bench_world.hpp"
+#include "creatures/combat/combat.hpp"
+#include "creatures/creature.hpp"
+#include "game/game.hpp"
+#include "map/spectators.hpp"
+
+// Argument: players on the map
+static void BM_SpectatorsFind(benchmark::State &state) {
+	auto &world = BenchWorld::get();
+	world.populate(static_cast<size_t>(state.range(0)));
+
+	std::vector<Position> positions(256);
+	std::ranges::generate(positions, [&world] { return world.getRandomPosition(); });
+
+	size_t index = 0;
+	for (auto _ : state) {
+		Spectators::clearCache();
+		auto spectators = Spectators().find<Creature>(positions[index++ % positions.size()], true);
+		benchmark::DoNotOptimize(spectators.size());
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SpectatorsFind)->Arg(100)->Arg(1000)->Arg(5000);
+
+// Same lookups hitting the spectators cache
+static void BM_SpectatorsFindCached(benchmark::State &state) {
+	auto &world = BenchWorld::get();
+	world.populate(static_cast<size_t>(state.range(0)));
+
+	std::vector<Position> positions(256);
+	std::ranges::generate(positions, [&world] { return world.getRandomPosition(); });
+	Spectators::clearCache();
+
+	size_t index = 0;
+	for (auto _ : state) {
+		auto spectators = Spectators().find<Player>(positions[index++ % positions.size()], true);
+		benchmark::DoNotOptimize(spectators.size());
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SpectatorsFindCached)->Arg(100)->Arg(1000)->Arg(5000);
+
+// Argument: distance to the target, in tiles
+static void BM_MapGetPathMatching(benchmark::State &state) {
+	auto &world = BenchWorld::get();
+	const auto distance = static_cast<int32_t>(state.range(0));
+	const Position start = world.getCenter();
+
+	std::vector<Position> targets;
+	while (targets.size() < 64) {
+		Position target = world.getRandomPosition();
+		if (Position::getDistanceX(start, target) <= distance && Position::getDistanceY(start, target) <= distance) {
+			targets.emplace_back(target);
+		}
+	}
+
+	FindPathParams fpp;
+	fpp.maxSearchDist = distance;
+	size_t index = 0;
+	int64_t found = 0;
+	for (auto _ : state) {
+		std::forward_list<Direction> dirList;
+		const Position &target = targets[index++ % targets.size()];
+		found += g_game().map.getPathMatching(start, dirList, FrozenPathingConditionCall(target), fpp);
+		benchmark::DoNotOptimize(dirList);
+	}
+	state.counters["found"] = benchmark::Counter(static_cast<double>(found), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_MapGetPathMatching)->Arg(8)->Arg(16)->Arg(32);
+
+static void BM_MapIsSightClear(benchmark::State &state) {
+	auto &world = BenchWorld::get();
+	const Position center = world.getCenter();
+
+	std::vector<Position> targets;
+	while (targets.size() < 256) {
+		Position target = world.getRandomPosition();
+		if (Position::getDistanceX(center, target) <= MAP_MAX_VIEW_PORT_X && Position::getDistanceY(center, target) <= MAP_MAX_VIEW_PORT_Y) {
+			targets.emplace_back(target);
+		}
+	}
+
+	size_t index = 0;
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(g_game().map.isSightClear(center, targets[index++ % targets.size()], true));
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MapIsSightClear);
+
+// Argument: area radius, as used by the spells
+static void BM_AreaCombatGetList(benchmark::State &state) {
+	auto &world = BenchWorld::get();
+	AreaCombat area;
+	area.setupArea(static_cast<int32_t>(state.range(0)));
+
+	const Position center = world.getCenter();
+	int64_t tiles = 0;
+	for (auto _ : state) {
+		std::forward_list<std::shared_ptr<Tile>> list;
+		area.getList(center, center, list);
+		tiles += std::distance(list.begin(), list.end());
+	}
+	state.counters["tiles"] = benchmark::Counter(static_cast<double>(tiles), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_AreaCombatGetList)->Arg(3)->Arg(5)->Arg(7);
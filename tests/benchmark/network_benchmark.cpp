@@ -0,0 +1,113 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2023 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include "server/network/message/networkmessage.hpp"
+#include "server/network/message/outputmessage.hpp"
+#include "server/network/protocol/protocol.hpp"
+
+namespace {
+	// Protocol without connection, only used to run the send path
+	class BenchProtocol final : public Protocol {
+	public:
+		explicit BenchProtocol(ChecksumMethods_t checksumMethod) :
+			Protocol(nullptr) {
+			static constexpr uint32_t key[4] = { 0x1A2B3C4D, 0x5E6F7081, 0x92A3B4C5, 0xD6E7F809 };
+			setXTEAKey(key);
+			setChecksumMethod(checksumMethod);
+			enableXTEAEncryption();
+		}
+
+		void onRecvFirstMessage(NetworkMessage &) override { }
+	};
+
+	// Roughly what a map description sends for a screen of ground tiles
+	void writeMapDescription(NetworkMessage &msg) {
+		msg.addByte(0x64);
+		msg.addPosition(Position(1024, 1024, 7));
+		for (uint16_t tile = 0; tile < 18 * 14; ++tile) {
+			msg.add<uint16_t>(0x00);
+			msg.add<uint16_t>(4526 + (tile & 7));
+			msg.addByte(0xFF);
+		}
+	}
+
+	OutputMessage_ptr createPayload(size_t size) {
+		auto msg = OutputMessagePool::getOutputMessage();
+		for (size_t i = 0; i < size; ++i) {
+			msg->addByte(static_cast<uint8_t>(i * 31));
+		}
+		return msg;
+	}
+}
+
+static void BM_NetworkMessageEncodeMapDescription(benchmark::State &state) {
+	NetworkMessage msg;
+	for (auto _ : state) {
+		msg.reset();
+		writeMapDescription(msg);
+		benchmark::DoNotOptimize(msg.getBuffer());
+	}
+	state.SetBytesProcessed(state.iterations() * msg.getLength());
+}
+BENCHMARK(BM_NetworkMessageEncodeMapDescription);
+
+static void BM_NetworkMessageEncodeStrings(benchmark::State &state) {
+	const std::string text = "Hello, this is a message of the default channel.";
+	NetworkMessage msg;
+	for (auto _ : state) {
+		msg.reset();
+		for (int i = 0; i < 32; ++i) {
+			msg.addByte(0xAA);
+			msg.add<uint32_t>(0);
+			msg.addString("Player Name");
+			msg.add<uint16_t>(100);
+			msg.addByte(0x01);
+			msg.addString(text);
+		}
+		benchmark::DoNotOptimize(msg.getBuffer());
+	}
+	state.SetBytesProcessed(state.iterations() * msg.getLength());
+}
+BENCHMARK(BM_NetworkMessageEncodeStrings);
+
+// Argument: payload size, in bytes
+static void BM_ProtocolXTEAEncrypt(benchmark::State &state) {
+	const auto protocol = std::make_shared<BenchProtocol>(CHECKSUM_METHOD_NONE);
+	const auto size = static_cast<size_t>(state.range(0));
+	for (auto _ : state) {
+		state.PauseTiming();
+		const auto msg = createPayload(size);
+		state.ResumeTiming();
+
+		protocol->onSendMessage(msg);
+		benchmark::DoNotOptimize(msg->getOutputBuffer());
+	}
+	state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+BENCHMARK(BM_ProtocolXTEAEncrypt)->Arg(64)->Arg(1024)->Arg(16384);
+
+// Full send path of the game protocol, compression included when compressionLevel is set
+static void BM_ProtocolSendSequence(benchmark::State &state) {
+	const auto protocol = std::make_shared<BenchProtocol>(CHECKSUM_METHOD_SEQUENCE);
+	const auto size = static_cast<size_t>(state.range(0));
+	for (auto _ : state) {
+		state.PauseTiming();
+		const auto msg = createPayload(size);
+		state.ResumeTiming();
+
+		protocol->onSendMessage(msg);
+		benchmark::DoNotOptimize(msg->getOutputBuffer());
+	}
+	state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+BENCHMARK(BM_ProtocolSendSequence)->Arg(1024)->Arg(16384);
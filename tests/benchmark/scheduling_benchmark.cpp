@@ -0,0 +1,77 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2023 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include "bench_world.hpp"
+#include "game/scheduling/dispatcher.hpp"
+#include "items/decay/decay.hpp"
+#include "items/tile.hpp"
+
+namespace {
+	// Starts the dispatcher loop, the server does it from CanaryServer
+	void startDispatcher() {
+		static std::once_flag started;
+		std::call_once(started, [] { g_dispatcher().init(); });
+	}
+}
+
+// Argument: items decaying at the same time
+static void BM_DecayStartStop(benchmark::State &state) {
+	auto &world = BenchWorld::get();
+	std::vector<std::shared_ptr<Item>> items(static_cast<size_t>(state.range(0)));
+	std::uniform_int_distribution<int32_t> duration(60 * 1000, 60 * 60 * 1000);
+	std::mt19937 random { 0xDECA1 };
+	for (auto &item : items) {
+		item = Item::CreateItem(world.getDecayingId());
+		item->setParent(world.getStorageTile());
+		// Far enough in the future for the wheel check to never run during the benchmark
+		item->setDuration(duration(random));
+	}
+
+	for (auto _ : state) {
+		for (const auto &item : items) {
+			g_decay().startDecay(item);
+		}
+		for (const auto &item : items) {
+			g_decay().stopDecay(item);
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(items.size()));
+
+	for (const auto &item : items) {
+		item->resetParent();
+	}
+}
+BENCHMARK(BM_DecayStartStop)->Arg(1000)->Arg(100000);
+
+// Argument: events posted before waiting for the last one to run
+static void BM_DispatcherAddEvent(benchmark::State &state) {
+	startDispatcher();
+
+	const auto batch = state.range(0);
+	for (auto _ : state) {
+		std::promise<void> done;
+		auto future = done.get_future();
+		std::atomic_int64_t remaining = batch;
+		for (int64_t i = 0; i < batch; ++i) {
+			g_dispatcher().addEvent([&remaining, &done] {
+				if (--remaining == 0) {
+					done.set_value();
+				}
+			},
+									"BM_DispatcherAddEvent");
+		}
+		future.wait();
+	}
+	state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(BM_DispatcherAddEvent)->Arg(1)->Arg(1000)->Arg(10000)->UseRealTime();
@@ -0,0 +1,494 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2023 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include "bot.hpp"
+#include "fixture_accounts.hpp"
+#include "load_report.hpp"
+#include "core.hpp"
+#include "creatures/creatures_definitions.hpp"
+#include "security/rsa.hpp"
+#include "server/network/message/networkmessage.hpp"
+#include "utils/tools.hpp"
+#include "utils/utils_definitions.hpp"
+
+namespace {
+	// Client to server opcodes, as parsed by ProtocolGame::parsePacketFromDispatcher
+	constexpr uint8_t OPCODE_LOGOUT = 0x14;
+	constexpr uint8_t OPCODE_PING = 0x1E;
+	constexpr uint8_t OPCODE_WALK_NORTH = 0x65;
+	constexpr uint8_t OPCODE_USE_ITEM = 0x82;
+	constexpr uint8_t OPCODE_LOOK_AT = 0x8C;
+	constexpr uint8_t OPCODE_CLOSE_CONTAINER = 0x87;
+	constexpr uint8_t OPCODE_SAY = 0x96;
+
+	// Server to client opcodes answering a login
+	constexpr uint8_t OPCODE_DISCONNECT_CLIENT = 0x14;
+	constexpr uint8_t OPCODE_LOGIN_WAITING_LIST = 0x16;
+	constexpr uint8_t OPCODE_CHALLENGE = 0x1F;
+
+	constexpr uint8_t PROTOCOL_ID_GAME = 0x0A;
+	constexpr std::string_view LOOK_ANSWER = "You see";
+
+	constexpr std::array<std::string_view, 6> chatLines = {
+		"hi", "anyone selling a backpack?", "trade", "hello there", "need a team for hunting", "where is the depot?"
+	};
+	constexpr std::array<std::string_view, 3> spellWords = { "exura", "utevo lux", "exura ico" };
+
+	Position backpackSlot() {
+		return Position(0xFFFF, CONST_SLOT_BACKPACK, 0);
+	}
+
+	template <typename T>
+	T readLE(const uint8_t* data) {
+		T value;
+		memcpy(&value, data, sizeof(T));
+		return value;
+	}
+
+	template <typename T>
+	void writeLE(uint8_t* data, T value) {
+		memcpy(data, &value, sizeof(T));
+	}
+
+	uint64_t microsecondsSince(std::chrono::steady_clock::time_point since) {
+		return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - since).count();
+	}
+}
+
+std::optional<BehaviorMix> BehaviorMix::fromString(const std::string &value) {
+	static const phmap::flat_hash_map<std::string, BehaviorMix> named = {
+		{ "explorer", { "explorer", 8, 1, 0, 1 } },
+		{ "social", { "social", 2, 6, 1, 1 } },
+		{ "caster", { "caster", 2, 1, 6, 1 } },
+		{ "mixed", { "mixed", 4, 2, 2, 2 } },
+	};
+	if (auto it = named.find(value); it != named.end()) {
+		return it->second;
+	}
+
+	BehaviorMix mix;
+	mix.name = value;
+	for (const auto &part : explodeString(value, ",")) {
+		const size_t separator = part.find('=');
+		if (separator == std::string::npos) {
+			return std::nullopt;
+		}
+
+		const std::string action = part.substr(0, separator);
+		uint32_t weight;
+		const std::string weightString = part.substr(separator + 1);
+		if (std::from_chars(weightString.data(), weightString.data() + weightString.size(), weight).ec != std::errc()) {
+			return std::nullopt;
+		}
+
+		if (action == "walk") {
+			mix.walk = weight;
+		} else if (action == "say") {
+			mix.say = weight;
+		} else if (action == "spell") {
+			mix.spell = weight;
+		} else if (action == "container") {
+			mix.container = weight;
+		} else {
+			return std::nullopt;
+		}
+	}
+	return mix.total() > 0 ? std::optional(mix) : std::nullopt;
+}
+
+Bot::Bot(asio::io_context &ioContext, const BotSettings &settings, LoadReport &report, uint32_t index) :
+	settings(settings),
+	report(report),
+	index(index),
+	strand(asio::make_strand(ioContext)),
+	socket(strand),
+	startTimer(strand),
+	actionTimer(strand),
+	probeTimer(strand),
+	keepAliveTimer(strand),
+	inflater(new z_stream {}, [](z_stream* stream) {
+		inflateEnd(stream);
+		delete stream;
+	}),
+	random(index) {
+	// Same raw deflate stream the server compresses with, see Protocol::ZStream
+	if (inflateInit2(inflater.get(), -15) != Z_OK) {
+		throw std::runtime_error("inflateInit2 failed");
+	}
+	inflated.resize(NETWORKMESSAGE_MAXSIZE);
+}
+
+std::string Bot::accountEmail(uint32_t index) {
+	return fmt::format("loadgen{}@loadgen.test", index);
+}
+
+std::string Bot::characterName(uint32_t index) {
+	return fmt::format("Loadgen Bot {}", index);
+}
+
+void Bot::start(std::chrono::milliseconds delay) {
+	startTimer.expires_after(delay);
+	startTimer.async_wait([self = shared_from_this()](const std::error_code &error) {
+		if (!error && self->state == State::Idle) {
+			self->connect();
+		}
+	});
+}
+
+void Bot::stop() {
+	asio::dispatch(strand, [self = shared_from_this()] {
+		if (self->state == State::Online) {
+			NetworkMessage msg;
+			msg.addByte(OPCODE_LOGOUT);
+			self->send(msg);
+		}
+		self->close("stopped", true);
+	});
+}
+
+void Bot::connect() {
+	state = State::Connecting;
+	connectTime = std::chrono::steady_clock::now();
+
+	std::error_code error;
+	const auto address = asio::ip::make_address(settings.host, error);
+	if (error) {
+		close(fmt::format("invalid host {}", settings.host));
+		return;
+	}
+
+	socket.async_connect(asio::ip::tcp::endpoint(address, settings.port), [self = shared_from_this()](const std::error_code &connectError) {
+		if (connectError) {
+			self->close(fmt::format("connect: {}", connectError.message()));
+			return;
+		}
+
+		// The game server sends first, the challenge comes before any login data
+		self->state = State::Challenge;
+		self->readHeader();
+	});
+}
+
+void Bot::readHeader() {
+	asio::async_read(socket, asio::buffer(header), [self = shared_from_this()](const std::error_code &error, size_t) {
+		if (error) {
+			self->close(fmt::format("read: {}", error.message()));
+			return;
+		}
+		self->readBody(readLE<uint16_t>(self->header.data()));
+	});
+}
+
+void Bot::readBody(uint16_t size) {
+	body.resize(size);
+	asio::async_read(socket, asio::buffer(body), [self = shared_from_this(), size](const std::error_code &error, size_t) {
+		if (error) {
+			self->close(fmt::format("read: {}", error.message()));
+			return;
+		}
+
+		self->report.onReceived(size + self->header.size());
+		self->onFrame(self->body.data(), size);
+		if (self->state != State::Closed) {
+			self->readHeader();
+		}
+	});
+}
+
+void Bot::onFrame(uint8_t* data, uint16_t size) {
+	if (state == State::Challenge) {
+		onChallenge(data, size);
+		return;
+	}
+
+	// Sequence number, with the compression flag on the highest bit, then the XTEA blocks
+	if (size < 12 || ((size - 4) & 7) != 0) {
+		close(fmt::format("malformed frame of {} bytes", size));
+		return;
+	}
+
+	const bool compressed = (readLE<uint32_t>(data) & (1U << 31)) != 0;
+	xtea::decrypt(data + 4, size - 4, key);
+
+	const auto innerLength = readLE<uint16_t>(data + 4);
+	if (innerLength > size - 6) {
+		close("frame inner length out of bounds");
+		return;
+	}
+
+	if (!compressed) {
+		onPayload(data + 6, innerLength);
+	} else if (!inflatePayload(data + 6, innerLength)) {
+		close("could not inflate frame");
+	}
+}
+
+void Bot::onChallenge(const uint8_t* data, uint16_t size) {
+	// Adler checksum, payload length, opcode, timestamp, random number
+	if (size < 12 || data[6] != OPCODE_CHALLENGE) {
+		close("unexpected challenge");
+		return;
+	}
+
+	sendLogin(readLE<uint32_t>(data + 7), data[11]);
+}
+
+bool Bot::inflatePayload(const uint8_t* data, size_t size) {
+	inflater->next_in = const_cast<Bytef*>(data);
+	inflater->avail_in = static_cast<uInt>(size);
+	inflater->next_out = inflated.data();
+	inflater->avail_out = static_cast<uInt>(inflated.size());
+
+	const int ret = inflate(inflater.get(), Z_FINISH);
+	const size_t inflatedSize = inflated.size() - inflater->avail_out;
+	inflateReset(inflater.get());
+	if (ret != Z_STREAM_END && ret != Z_OK && ret != Z_BUF_ERROR) {
+		return false;
+	}
+
+	onPayload(inflated.data(), inflatedSize);
+	return true;
+}
+
+void Bot::onPayload(const uint8_t* payload, size_t size) {
+	if (size == 0) {
+		return;
+	}
+
+	if (state == State::LoggingIn) {
+		if (payload[0] == OPCODE_DISCONNECT_CLIENT || payload[0] == OPCODE_LOGIN_WAITING_LIST) {
+			std::string reason = "waiting list";
+			if (payload[0] == OPCODE_DISCONNECT_CLIENT && size >= 3) {
+				const auto length = std::min<size_t>(readLE<uint16_t>(payload + 1), size - 3);
+				reason.assign(reinterpret_cast<const char*>(payload + 3), length);
+			}
+			report.onLoginFailure(reason);
+			close(reason, true);
+			return;
+		}
+
+		state = State::Online;
+		loginTime = std::chrono::steady_clock::now();
+		report.onLogin(std::chrono::microseconds(microsecondsSince(connectTime)));
+		scheduleAction();
+		scheduleProbe();
+		scheduleKeepAlive();
+		return;
+	}
+
+	if (probeSentAt) {
+		const std::string_view text(reinterpret_cast<const char*>(payload), size);
+		if (text.find(LOOK_ANSWER) != std::string_view::npos) {
+			report.onProbe(std::chrono::microseconds(microsecondsSince(*probeSentAt)));
+			probeSentAt.reset();
+		}
+	}
+}
+
+void Bot::sendLogin(uint32_t challengeTimestamp, uint8_t challengeRandom) {
+	for (auto &part : key) {
+		part = random();
+	}
+
+	NetworkMessage msg;
+	// Skipped by Connection::parsePacket, the game server sent first
+	msg.add<uint32_t>(0);
+	msg.addByte(PROTOCOL_ID_GAME);
+	msg.add<uint16_t>(CLIENTOS_NEW_WINDOWS);
+	msg.add<uint16_t>(CLIENT_VERSION);
+	msg.add<uint32_t>(CLIENT_VERSION);
+	msg.addString(fmt::format("{}.{}", CLIENT_VERSION_UPPER, CLIENT_VERSION_LOWER));
+	msg.add<uint16_t>(0); // dat revision
+	msg.addByte(0); // game preview state
+
+	const auto rsaStart = msg.getLength();
+	msg.addByte(0);
+	for (uint32_t part : key) {
+		msg.add<uint32_t>(part);
+	}
+	msg.addByte(0); // gamemaster flag
+	msg.addString(fmt::format("{}\n{}", accountEmail(index), settings.password));
+	msg.addString(characterName(index));
+	msg.add<uint32_t>(challengeTimestamp);
+	msg.addByte(challengeRandom);
+	msg.add<uint16_t>(0); // no OTCv8 identification
+	if (msg.getLength() - rsaStart > 128) {
+		close("login block does not fit the RSA block");
+		return;
+	}
+	msg.addPaddingBytes(128 - (msg.getLength() - rsaStart));
+
+	auto charData = static_cast<char*>(static_cast<void*>(msg.getBuffer() + NetworkMessage::INITIAL_BUFFER_POSITION));
+	g_RSA().encrypt(charData + rsaStart);
+
+	std::vector<uint8_t> frame(2 + msg.getLength());
+	writeLE<uint16_t>(frame.data(), msg.getLength());
+	memcpy(frame.data() + 2, msg.getBuffer() + NetworkMessage::INITIAL_BUFFER_POSITION, msg.getLength());
+	state = State::LoggingIn;
+	writeFrame(std::move(frame));
+}
+
+void Bot::send(const NetworkMessage &msg) {
+	// Length header, sequence number, then the XTEA blocks holding the inner length and the payload
+	const size_t innerSize = 2 + msg.getLength();
+	const size_t encryptedSize = (innerSize + 7) & ~static_cast<size_t>(7);
+	std::vector<uint8_t> frame(6 + encryptedSize, 0);
+
+	sequence = sequence >= 0x7FFFFFFF ? 1 : sequence + 1;
+	writeLE<uint16_t>(frame.data(), static_cast<uint16_t>(4 + encryptedSize));
+	writeLE<uint32_t>(frame.data() + 2, sequence);
+	writeLE<uint16_t>(frame.data() + 6, msg.getLength());
+	memcpy(frame.data() + 8, msg.getBuffer() + NetworkMessage::INITIAL_BUFFER_POSITION, msg.getLength());
+	xtea::encrypt(frame.data() + 6, encryptedSize, key);
+	writeFrame(std::move(frame));
+}
+
+void Bot::writeFrame(std::vector<uint8_t> &&frame) {
+	report.onSent(frame.size());
+	writeQueue.push_back(std::move(frame));
+	if (writeQueue.size() == 1) {
+		writeNext();
+	}
+}
+
+void Bot::writeNext() {
+	asio::async_write(socket, asio::buffer(writeQueue.front()), [self = shared_from_this()](const std::error_code &error, size_t) {
+		if (error) {
+			self->writeQueue.clear();
+			self->close(fmt::format("write: {}", error.message()));
+			return;
+		}
+
+		self->writeQueue.pop_front();
+		if (!self->writeQueue.empty()) {
+			self->writeNext();
+		} else if (self->state == State::Closed) {
+			self->closeSocket();
+		}
+	});
+}
+
+void Bot::scheduleAction() {
+	// Jitter keeps the bots from acting in lockstep
+	std::uniform_int_distribution<int64_t> jitter(settings.actionInterval.count() / 2, settings.actionInterval.count() * 3 / 2);
+	actionTimer.expires_after(std::chrono::milliseconds(jitter(random)));
+	actionTimer.async_wait([self = shared_from_this()](const std::error_code &error) {
+		if (!error && self->state == State::Online) {
+			self->doAction();
+			self->scheduleAction();
+		}
+	});
+}
+
+void Bot::doAction() {
+	const BehaviorMix &mix = settings.mix;
+	uint32_t pick = std::uniform_int_distribution<uint32_t>(0, mix.total() - 1)(random);
+
+	NetworkMessage msg;
+	if (pick < mix.walk) {
+		msg.addByte(OPCODE_WALK_NORTH + static_cast<uint8_t>(random() % 4));
+	} else if ((pick -= mix.walk) < mix.say) {
+		msg.addByte(OPCODE_SAY);
+		msg.addByte(TALKTYPE_SAY);
+		msg.addString(std::string(chatLines[random() % chatLines.size()]));
+	} else if ((pick -= mix.say) < mix.spell) {
+		msg.addByte(OPCODE_SAY);
+		msg.addByte(TALKTYPE_SAY);
+		msg.addString(std::string(spellWords[random() % spellWords.size()]));
+	} else if (containerOpen) {
+		msg.addByte(OPCODE_CLOSE_CONTAINER);
+		msg.addByte(0);
+		containerOpen = false;
+	} else {
+		msg.addByte(OPCODE_USE_ITEM);
+		msg.addPosition(backpackSlot());
+		msg.add<uint16_t>(FIXTURE_BACKPACK_ID);
+		msg.addByte(0); // stack position
+		msg.addByte(0); // container index
+		containerOpen = true;
+	}
+	send(msg);
+}
+
+void Bot::scheduleProbe() {
+	probeTimer.expires_after(settings.probeInterval);
+	probeTimer.async_wait([self = shared_from_this()](const std::error_code &error) {
+		if (!error && self->state == State::Online) {
+			self->sendProbe();
+			self->scheduleProbe();
+		}
+	});
+}
+
+void Bot::sendProbe() {
+	if (probeSentAt) {
+		if (std::chrono::steady_clock::now() - *probeSentAt < settings.probeTimeout) {
+			return;
+		}
+		report.onProbeTimeout();
+	}
+
+	NetworkMessage msg;
+	msg.addByte(OPCODE_LOOK_AT);
+	msg.addPosition(backpackSlot());
+	msg.add<uint16_t>(FIXTURE_BACKPACK_ID);
+	msg.addByte(0);
+	probeSentAt = std::chrono::steady_clock::now();
+	send(msg);
+}
+
+void Bot::scheduleKeepAlive() {
+	// Answers the server pings, Player::sendPing kicks players without a pong for a minute
+	keepAliveTimer.expires_after(std::chrono::seconds(5));
+	keepAliveTimer.async_wait([self = shared_from_this()](const std::error_code &error) {
+		if (!error && self->state == State::Online) {
+			NetworkMessage msg;
+			msg.addByte(OPCODE_PING);
+			self->send(msg);
+			self->scheduleKeepAlive();
+		}
+	});
+}
+
+void Bot::close(const std::string &reason, bool expected /* = false*/) {
+	if (state == State::Closed) {
+		return;
+	}
+
+	const State previous = state;
+	state = State::Closed;
+	if (previous == State::Online) {
+		const std::chrono::microseconds online(microsecondsSince(loginTime));
+		if (expected) {
+			report.onLogout(online);
+		} else {
+			report.onDisconnect(fmt::format("{}: {}", characterName(index), reason), online);
+		}
+	} else if (previous != State::Idle && !expected) {
+		report.onLoginFailure(reason);
+	}
+
+	startTimer.cancel();
+	actionTimer.cancel();
+	probeTimer.cancel();
+	keepAliveTimer.cancel();
+
+	// Otherwise the last write closes it, so a pending logout still reaches the server
+	if (writeQueue.empty()) {
+		closeSocket();
+	}
+}
+
+void Bot::closeSocket() {
+	std::error_code error;
+	socket.shutdown(asio::ip::tcp::socket::shutdown_both, error);
+	socket.close(error);
+}
@@ -0,0 +1,122 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2023 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+#include "security/xtea.hpp"
+
+class LoadReport;
+class NetworkMessage;
+
+/**
+ * Relative weights of the actions a bot picks from on every action tick.
+ */
+struct BehaviorMix {
+	std::string name;
+	uint32_t walk = 0;
+	uint32_t say = 0;
+	uint32_t spell = 0;
+	uint32_t container = 0;
+
+	// Named mix (explorer, social, caster, mixed) or a list like "walk=5,say=1,spell=2,container=1"
+	static std::optional<BehaviorMix> fromString(const std::string &value);
+
+	uint32_t total() const {
+		return walk + say + spell + container;
+	}
+};
+
+struct BotSettings {
+	std::string host = "127.0.0.1";
+	uint16_t port = 7172;
+	std::string password = "loadgen";
+	BehaviorMix mix;
+	std::chrono::milliseconds actionInterval { 1000 };
+	std::chrono::milliseconds probeInterval { 2000 };
+	std::chrono::milliseconds probeTimeout { 10000 };
+};
+
+/**
+ * Synthetic game client. Logs in one fixture character the way the real client does
+ * (challenge, RSA login block, XTEA with sequence checksums) and then sends the actions
+ * of its behavior mix. Latency is measured with look probes on its own backpack, the
+ * "You see" answer goes through the dispatcher and the Lua look event like any request.
+ */
+class Bot : public std::enable_shared_from_this<Bot> {
+public:
+	Bot(asio::io_context &ioContext, const BotSettings &settings, LoadReport &report, uint32_t index);
+
+	void start(std::chrono::milliseconds delay);
+	// Logs out, stop() on a bot that is already gone is a no-op
+	void stop();
+
+	static std::string accountEmail(uint32_t index);
+	static std::string characterName(uint32_t index);
+
+private:
+	enum class State : uint8_t {
+		Idle,
+		Connecting,
+		Challenge,
+		LoggingIn,
+		Online,
+		Closed,
+	};
+
+	void connect();
+	void readHeader();
+	void readBody(uint16_t size);
+	void onFrame(uint8_t* body, uint16_t size);
+	void onChallenge(const uint8_t* body, uint16_t size);
+	void onPayload(const uint8_t* payload, size_t size);
+	bool inflatePayload(const uint8_t* data, size_t size);
+
+	void sendLogin(uint32_t challengeTimestamp, uint8_t challengeRandom);
+	void send(const NetworkMessage &msg);
+	void writeFrame(std::vector<uint8_t> &&frame);
+	void writeNext();
+
+	void scheduleAction();
+	void scheduleProbe();
+	void scheduleKeepAlive();
+	void doAction();
+	void sendProbe();
+
+	// Unexpected closes count as disconnects, the reason is logged
+	void close(const std::string &reason, bool expected = false);
+	void closeSocket();
+
+	const BotSettings &settings;
+	LoadReport &report;
+	const uint32_t index;
+
+	asio::strand<asio::io_context::executor_type> strand;
+	asio::ip::tcp::socket socket;
+	asio::steady_timer startTimer;
+	asio::steady_timer actionTimer;
+	asio::steady_timer probeTimer;
+	asio::steady_timer keepAliveTimer;
+
+	State state = State::Idle;
+	xtea::key key {};
+	uint32_t sequence = 0;
+
+	std::array<uint8_t, 2> header {};
+	std::vector<uint8_t> body;
+	std::vector<uint8_t> inflated;
+	std::unique_ptr<z_stream, void (*)(z_stream*)> inflater;
+	std::deque<std::vector<uint8_t>> writeQueue;
+
+	std::chrono::steady_clock::time_point connectTime;
+	std::chrono::steady_clock::time_point loginTime;
+	std::optional<std::chrono::steady_clock::time_point> probeSentAt;
+	bool containerOpen = false;
+
+	std::mt19937 random;
+};
@@ -0,0 +1,59 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2023 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include "fixture_accounts.hpp"
+#include "bot.hpp"
+#include "creatures/creatures_definitions.hpp"
+#include "database/database.hpp"
+#include "utils/tools.hpp"
+
+namespace {
+	// Sorcerer with enough mana for the spells of the behavior mixes
+	constexpr uint16_t FIXTURE_VOCATION = 1;
+}
+
+bool createFixtureAccounts(Database &db, uint32_t count, const std::string &password) {
+	// Players and their items go with the accounts, through the foreign keys
+	if (!db.executeQuery("DELETE FROM `accounts` WHERE `email` LIKE '%@loadgen.test'")) {
+		return false;
+	}
+
+	const std::string passwordHash = db.escapeString(transformToSHA1(password));
+	for (uint32_t index = 0; index < count; ++index) {
+		if (!db.executeQuery(fmt::format(
+				"INSERT INTO `accounts` (`name`, `email`, `password`, `type`, `creation`) VALUES ({}, {}, {}, 1, {})",
+				db.escapeString(fmt::format("loadgen{}", index)), db.escapeString(Bot::accountEmail(index)), passwordHash, getTimeNow()
+			))) {
+			return false;
+		}
+		const uint64_t accountId = db.getLastInsertId();
+
+		if (!db.executeQuery(fmt::format(
+				"INSERT INTO `players` (`name`, `account_id`, `level`, `vocation`, `health`, `healthmax`, `experience`, `mana`, `manamax`, `maglevel`, `cap`, `sex`, `conditions`) "
+				"VALUES ({}, {}, 8, {}, 185, 185, 4200, 90, 90, 10, 470, 1, '')",
+				db.escapeString(Bot::characterName(index)), accountId, FIXTURE_VOCATION
+			))) {
+			return false;
+		}
+		const uint64_t playerId = db.getLastInsertId();
+
+		// Inventory items use their slot as parent and start at sid 101, like IOLoginDataSave
+		if (!db.executeQuery(fmt::format(
+				"INSERT INTO `player_items` (`player_id`, `pid`, `sid`, `itemtype`, `count`, `attributes`) VALUES ({}, {}, 101, {}, 1, '')",
+				playerId, static_cast<uint32_t>(CONST_SLOT_BACKPACK), FIXTURE_BACKPACK_ID
+			))) {
+			return false;
+		}
+	}
+
+	g_logger().info("Created {} load generator accounts", count);
+	return true;
+}
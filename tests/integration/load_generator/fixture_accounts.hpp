@@ -0,0 +1,18 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2023 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+class Database;
+
+// Every fixture character carries one in the backpack slot, bots open it and look at it
+static constexpr uint16_t FIXTURE_BACKPACK_ID = 2854;
+
+// (Re)creates the accounts and characters used by the bots, from index 0 to count - 1
+bool createFixtureAccounts(Database &db, uint32_t count, const std::string &password);
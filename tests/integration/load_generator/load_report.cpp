@@ -0,0 +1,121 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2023 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include "load_report.hpp"
+
+namespace {
+	double toMs(int64_t microseconds) {
+		return static_cast<double>(microseconds) / 1000.0;
+	}
+
+	double secondsSince(LoadReport::Clock::time_point since) {
+		return std::chrono::duration<double>(LoadReport::Clock::now() - since).count();
+	}
+}
+
+void LoadReport::onLogin(std::chrono::microseconds took) {
+	++logins;
+	++online;
+	std::scoped_lock lock(mutex);
+	loginTimes.push_back(took.count());
+}
+
+void LoadReport::onLoginFailure(const std::string &reason) {
+	++loginFailures;
+	std::scoped_lock lock(mutex);
+	++failureReasons[reason];
+}
+
+void LoadReport::onDisconnect(const std::string &reason, std::chrono::microseconds timeOnline) {
+	++disconnects;
+	g_logger().warn("[LoadReport] - Disconnected: {}", reason);
+	onLogout(timeOnline);
+}
+
+void LoadReport::onLogout(std::chrono::microseconds timeOnline) {
+	--online;
+	std::scoped_lock lock(mutex);
+	playerSeconds += std::chrono::duration<double>(timeOnline).count();
+}
+
+void LoadReport::onProbe(std::chrono::microseconds latency) {
+	std::scoped_lock lock(mutex);
+	intervalLatencies.push_back(latency.count());
+	latencies.push_back(latency.count());
+}
+
+void LoadReport::onProbeTimeout() {
+	++probeTimeouts;
+}
+
+LoadReport::Percentiles LoadReport::percentiles(std::vector<int64_t> &samples) {
+	Percentiles result;
+	if (samples.empty()) {
+		return result;
+	}
+
+	std::ranges::sort(samples);
+	const auto rank = [&samples](double percentile) {
+		const auto position = static_cast<size_t>(std::ceil(percentile * static_cast<double>(samples.size())));
+		return samples[std::clamp<size_t>(position, 1, samples.size()) - 1];
+	};
+	result.p50 = rank(0.50);
+	result.p90 = rank(0.90);
+	result.p99 = rank(0.99);
+	result.max = samples.back();
+	return result;
+}
+
+void LoadReport::logInterval() {
+	std::vector<int64_t> samples;
+	{
+		std::scoped_lock lock(mutex);
+		samples.swap(intervalLatencies);
+	}
+
+	const double seconds = secondsSince(intervalStart);
+	intervalStart = Clock::now();
+
+	const uint64_t sent = bytesSent.load();
+	const uint64_t received = bytesReceived.load();
+	const uint32_t disconnected = disconnects.load();
+	const uint32_t players = online.load();
+	const double playerSecondsInterval = std::max(1.0, players * seconds);
+
+	const Percentiles latency = percentiles(samples);
+	g_logger().info(
+		"online {:>5} | latency p50 {:>8.2f} ms p90 {:>8.2f} ms p99 {:>8.2f} ms max {:>8.2f} ms | in {:>8.0f} B/player/s out {:>6.0f} B/player/s | disconnects {}",
+		players, toMs(latency.p50), toMs(latency.p90), toMs(latency.p99), toMs(latency.max),
+		(received - intervalBytesReceived) / playerSecondsInterval, (sent - intervalBytesSent) / playerSecondsInterval,
+		disconnected - intervalDisconnects
+	);
+
+	intervalBytesSent = sent;
+	intervalBytesReceived = received;
+	intervalDisconnects = disconnected;
+}
+
+void LoadReport::logSummary() {
+	std::scoped_lock lock(mutex);
+	const Percentiles latency = percentiles(latencies);
+	const Percentiles login = percentiles(loginTimes);
+	const double seconds = std::max(1.0, playerSeconds);
+
+	g_logger().info("Load generator summary after {:.0f} seconds:", secondsSince(startTime));
+	g_logger().info("  logins            {} ok, {} failed", logins.load(), loginFailures.load());
+	for (const auto &[reason, count] : failureReasons) {
+		g_logger().info("    {:>5} x {}", count, reason);
+	}
+	g_logger().info("  login time        p50 {:.2f} ms, p90 {:.2f} ms, p99 {:.2f} ms, max {:.2f} ms", toMs(login.p50), toMs(login.p90), toMs(login.p99), toMs(login.max));
+	g_logger().info("  response latency  p50 {:.2f} ms, p90 {:.2f} ms, p99 {:.2f} ms, max {:.2f} ms ({} probes, {} timed out)", toMs(latency.p50), toMs(latency.p90), toMs(latency.p99), toMs(latency.max), latencies.size(), probeTimeouts.load());
+	g_logger().info("  traffic           in {:.0f} B/player/s, out {:.0f} B/player/s", bytesReceived.load() / seconds, bytesSent.load() / seconds);
+	g_logger().info("  disconnects       {}", disconnects.load());
+}
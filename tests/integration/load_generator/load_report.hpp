@@ -0,0 +1,75 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2023 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+/**
+ * Counters shared by every bot. Latency samples are kept per interval for the
+ * periodic lines and for the whole run for the final summary.
+ */
+class LoadReport {
+public:
+	using Clock = std::chrono::steady_clock;
+
+	void onLogin(std::chrono::microseconds took);
+	void onLoginFailure(const std::string &reason);
+	void onDisconnect(const std::string &reason, std::chrono::microseconds timeOnline);
+	void onLogout(std::chrono::microseconds timeOnline);
+
+	void onProbe(std::chrono::microseconds latency);
+	void onProbeTimeout();
+
+	void onSent(size_t bytes) {
+		bytesSent.fetch_add(bytes, std::memory_order_relaxed);
+	}
+	void onReceived(size_t bytes) {
+		bytesReceived.fetch_add(bytes, std::memory_order_relaxed);
+	}
+
+	// Logs the activity since the previous call
+	void logInterval();
+	void logSummary();
+
+	bool hadLogins() const {
+		return logins.load() > 0;
+	}
+
+private:
+	struct Percentiles {
+		int64_t p50 = 0;
+		int64_t p90 = 0;
+		int64_t p99 = 0;
+		int64_t max = 0;
+	};
+
+	// Nearest rank, in microseconds, sorts the samples
+	static Percentiles percentiles(std::vector<int64_t> &samples);
+
+	std::mutex mutex;
+	std::vector<int64_t> intervalLatencies;
+	std::vector<int64_t> latencies;
+	std::vector<int64_t> loginTimes;
+	phmap::flat_hash_map<std::string, uint32_t> failureReasons;
+	// Seconds spent online by the players that already left
+	double playerSeconds = 0;
+
+	std::atomic<uint64_t> bytesSent = 0;
+	std::atomic<uint64_t> bytesReceived = 0;
+	std::atomic<uint32_t> online = 0;
+	std::atomic<uint32_t> logins = 0;
+	std::atomic<uint32_t> loginFailures = 0;
+	std::atomic<uint32_t> disconnects = 0;
+	std::atomic<uint32_t> probeTimeouts = 0;
+
+	Clock::time_point startTime = Clock::now();
+	Clock::time_point intervalStart = startTime;
+	uint64_t intervalBytesSent = 0;
+	uint64_t intervalBytesReceived = 0;
+	uint32_t intervalDisconnects = 0;
+};
@@ -0,0 +1,181 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2023 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "pch.hpp"
+
+#include "bot.hpp"
+#include "fixture_accounts.hpp"
+#include "load_report.hpp"
+#include "database/database.hpp"
+#include "security/rsa.hpp"
+
+namespace {
+	constexpr std::string_view usage = R"(Usage: canary_loadgen [options]
+  --host <address>          game server address (127.0.0.1)
+  --port <port>             game server port (7172)
+  --players <count>         synthetic characters to log in (100)
+  --duration <seconds>      how long to keep them online (60)
+  --login-rate <per second> logins started per second (20)
+  --mix <mix>               explorer, social, caster, mixed or weights like walk=5,say=1,spell=2,container=1 (mixed)
+  --action-interval <ms>    average time between two actions of a bot (1000)
+  --probe-interval <ms>     time between two latency probes of a bot (2000)
+  --report-interval <s>     time between two report lines (5)
+  --threads <count>         network threads (2)
+  --setup                   recreate the fixture accounts in the database before running
+  --db-host, --db-port, --db-user, --db-password, --db-name
+                            database of the server, defaults to the docker MySQL fixture
+)";
+
+	class Options {
+	public:
+		bool parse(int argc, char** argv) {
+			for (int i = 1; i < argc; ++i) {
+				std::string argument = argv[i];
+				if (!argument.starts_with("--")) {
+					return false;
+				}
+
+				argument.erase(0, 2);
+				if (argument == "setup" || argument == "help") {
+					values[argument] = "1";
+				} else if (const size_t separator = argument.find('='); separator != std::string::npos) {
+					values[argument.substr(0, separator)] = argument.substr(separator + 1);
+				} else if (i + 1 < argc) {
+					values[argument] = argv[++i];
+				} else {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		bool has(const std::string &name) const {
+			return values.contains(name);
+		}
+
+		std::string get(const std::string &name, const std::string &defaultValue) const {
+			auto it = values.find(name);
+			return it != values.end() ? it->second : defaultValue;
+		}
+
+		template <typename T>
+		T get(const std::string &name, T defaultValue) const {
+			auto it = values.find(name);
+			if (it == values.end()) {
+				return defaultValue;
+			}
+
+			T value;
+			const std::string &string = it->second;
+			if (std::from_chars(string.data(), string.data() + string.size(), value).ec != std::errc()) {
+				throw std::invalid_argument(fmt::format("Invalid value '{}' for --{}", string, name));
+			}
+			return value;
+		}
+
+	private:
+		phmap::flat_hash_map<std::string, std::string> values;
+	};
+
+	bool setupFixture(const Options &options, uint32_t players, const std::string &password) {
+		const std::string host = options.get("db-host", std::string("127.0.0.1"));
+		const std::string user = options.get("db-user", std::string("root"));
+		const std::string dbPassword = options.get("db-password", std::string("root"));
+		const std::string database = options.get("db-name", std::string("otservbr-global"));
+		const std::string sock;
+
+		Database db {};
+		if (!db.connect(&host, &user, &dbPassword, &database, options.get<uint32_t>("db-port", 3306), &sock)) {
+			g_logger().error("Could not connect to the database at {}", host);
+			return false;
+		}
+		return createFixtureAccounts(db, players, password);
+	}
+}
+
+int main(int argc, char** argv) {
+	Options options;
+	if (!options.parse(argc, argv) || options.has("help")) {
+		fmt::print("{}", usage);
+		return options.has("help") ? 0 : 1;
+	}
+
+	BotSettings settings;
+	uint32_t players;
+	uint32_t duration;
+	uint32_t loginRate;
+	uint32_t reportInterval;
+	uint32_t threads;
+	try {
+		settings.host = options.get("host", settings.host);
+		settings.port = options.get<uint16_t>("port", settings.port);
+		settings.actionInterval = std::chrono::milliseconds(options.get<uint32_t>("action-interval", 1000));
+		settings.probeInterval = std::chrono::milliseconds(options.get<uint32_t>("probe-interval", 2000));
+		players = options.get<uint32_t>("players", 100);
+		duration = options.get<uint32_t>("duration", 60);
+		loginRate = std::max<uint32_t>(1, options.get<uint32_t>("login-rate", 20));
+		reportInterval = std::max<uint32_t>(1, options.get<uint32_t>("report-interval", 5));
+		threads = std::max<uint32_t>(1, options.get<uint32_t>("threads", 2));
+	} catch (const std::invalid_argument &e) {
+		g_logger().error("{}", e.what());
+		return 1;
+	}
+
+	const auto mix = BehaviorMix::fromString(options.get("mix", std::string("mixed")));
+	if (!mix) {
+		g_logger().error("Invalid behavior mix '{}'", options.get("mix", std::string()));
+		return 1;
+	}
+	settings.mix = *mix;
+
+	if (options.has("setup") && !setupFixture(options, players, settings.password)) {
+		return 1;
+	}
+
+	// Same key lookup as the server, run it from the server directory to pick up its key.pem
+	g_RSA().start();
+
+	g_logger().info("Logging in {} players on {}:{} with the {} mix for {} seconds", players, settings.host, settings.port, settings.mix.name, duration);
+
+	LoadReport report;
+	asio::io_context ioContext;
+	auto work = asio::make_work_guard(ioContext);
+
+	std::vector<std::shared_ptr<Bot>> bots;
+	bots.reserve(players);
+	for (uint32_t index = 0; index < players; ++index) {
+		auto &bot = bots.emplace_back(std::make_shared<Bot>(ioContext, settings, report, index));
+		bot->start(std::chrono::milliseconds(index * 1000 / loginRate));
+	}
+
+	std::vector<std::thread> networkThreads;
+	for (uint32_t i = 0; i < threads; ++i) {
+		networkThreads.emplace_back([&ioContext] { ioContext.run(); });
+	}
+
+	const auto end = std::chrono::steady_clock::now() + std::chrono::seconds(duration);
+	while (std::chrono::steady_clock::now() < end) {
+		std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(std::chrono::seconds(reportInterval), end - std::chrono::steady_clock::now()));
+		report.logInterval();
+	}
+
+	for (const auto &bot : bots) {
+		bot->stop();
+	}
+	// Gives the logouts time to reach the server
+	std::this_thread::sleep_for(std::chrono::seconds(1));
+	work.reset();
+	ioContext.stop();
+	for (auto &thread : networkThreads) {
+		thread.join();
+	}
+
+	report.logSummary();
+	return report.hadLogins() ? 0 : 1;
+}
@@ -0,0 +1,57 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2023 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "creatures/creature_id_slab.hpp"
+
+using namespace boost::ut;
+
+suite<"creatures"> creatureIdSlabTest = [] {
+	test("CreatureIdSlab does not resolve the id of a released creature") = [] {
+		CreatureIdSlab<std::string> slab(0x50000001, 0x7FFFFFFF, 2);
+
+		const uint32_t first = slab.reserve();
+		const uint32_t second = slab.reserve();
+		expect(eq(first, 0x50000001U));
+		expect(slab.add(first, std::make_shared<std::string>("rat")));
+		expect(slab.add(second, std::make_shared<std::string>("cave rat")));
+		expect(!slab.add(second, std::make_shared<std::string>("again")));
+		expect(*slab.find(first) == "rat" && *slab.find(second) == "cave rat");
+
+		expect(slab.release(first));
+		expect(!slab.release(first));
+		expect(slab.find(first) == nullptr);
+		expect(eq(slab.size(), 1U));
+		expect(*slab.values().front() == "cave rat");
+
+		// The slot is reused with the next generation, so the id is not
+		const uint32_t reused = slab.reserve();
+		expect(eq(reused, first + 4));
+		expect(!slab.contains(first) && slab.contains(reused));
+		expect(slab.add(reused, std::make_shared<std::string>("rotworm")));
+		expect(slab.find(first) == nullptr);
+		expect(*slab.find(reused) == "rotworm");
+		expect(*slab.find(second) == "cave rat");
+	};
+
+	test("CreatureIdSlab stops handing out ids when the range is used up") = [] {
+		// Two slots with two generations each
+		CreatureIdSlab<int> slab(100, 103, 1);
+		std::vector<uint32_t> ids;
+		for (uint32_t id = slab.reserve(); id != 0; id = slab.reserve()) {
+			ids.emplace_back(id);
+			slab.release(id);
+		}
+
+		expect(ids == std::vector<uint32_t> { 100, 102, 101, 103 });
+		expect(!slab.contains(103) && slab.find(103) == nullptr);
+	};
+};
@@ -0,0 +1,85 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2023 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "creatures/players/storages/player_storage.hpp"
+
+using namespace boost::ut;
+
+suite<"creatures"> playerStorageTest = [] {
+	test("PlayerStorage only saves keys changed since the last save") = [] {
+		PlayerStorage storage;
+		storage.load(5, 1);
+		storage.load(10, 2);
+		storage.load(20, 3);
+
+		auto changes = storage.beginSave();
+		expect(changes.updated.empty() && changes.removed.empty());
+		storage.endSave(true);
+
+		expect(storage.set(7, 4));
+		expect(!storage.set(10, 2));
+		expect(storage.erase(20));
+
+		changes = storage.beginSave();
+		expect(changes.updated == std::vector<PlayerStorage::Entry> { { 7, 4 } });
+		expect(changes.removed == std::vector<uint32_t> { 20 });
+		storage.endSave(true);
+
+		changes = storage.beginSave();
+		expect(changes.updated.empty() && changes.removed.empty());
+		storage.endSave(true);
+	};
+
+	test("PlayerStorage hands the changes of a failed save to the next one") = [] {
+		PlayerStorage storage;
+		storage.set(1, 1);
+		storage.beginSave();
+		storage.endSave(false);
+
+		storage.set(2, 2);
+		const auto changes = storage.beginSave();
+		expect(eq(changes.updated.size(), 2u));
+	};
+
+	test("PlayerStorage keeps keys changed during a save dirty") = [] {
+		PlayerStorage storage;
+		storage.set(1, 1);
+		auto changes = storage.beginSave();
+		expect(changes.updated == std::vector<PlayerStorage::Entry> { { 1, 1 } });
+
+		storage.set(1, 2);
+		storage.set(2, 2);
+		storage.endSave(true);
+
+		changes = storage.beginSave();
+		std::ranges::sort(changes.updated);
+		expect(changes.updated == std::vector<PlayerStorage::Entry> { { 1, 2 }, { 2, 2 } });
+		storage.endSave(true);
+	};
+
+	test("PlayerStorage reads and erases key ranges") = [] {
+		PlayerStorage storage;
+		for (uint32_t key : { 30u, 10u, 20u, 40u }) {
+			storage.set(key, static_cast<int32_t>(key));
+		}
+
+		const auto range = storage.getRange(15, 30);
+		expect(eq(range.size(), 2u));
+		expect(eq(range[0].first, 20u) && eq(range[1].first, 30u));
+		expect(storage.getRange(30, 15).empty());
+
+		expect(eq(storage.eraseRange(20, 40), 3u));
+		expect(eq(storage.size(), 1u));
+		expect(eq(storage.get(10).value_or(-1), 10));
+		expect(!storage.get(20).has_value());
+	};
+};
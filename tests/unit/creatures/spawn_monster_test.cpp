@@ -0,0 +1,54 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2023 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "creatures/monsters/monster.hpp"
+#include "creatures/monsters/spawns/spawn_monster.hpp"
+#include "creatures/monsters/spawns/spawn_scheduler.hpp"
+#include "lib/thread/thread_pool.hpp"
+
+using namespace boost::ut;
+
+suite<"creatures"> spawnMonsterTest = [] {
+	test("SpawnMonster schedules the block of a monster dying in the area") = [] {
+		const std::string name = "spawn test monster";
+		const auto monsterType = std::make_shared<MonsterType>(name);
+		g_monsters().tryAddMonsterType(name, monsterType);
+
+		const Position pos(100, 100, 7);
+		SpawnMonster spawn(pos, 5);
+		expect(spawn.addMonster(name, pos, DIRECTION_NORTH, 60000));
+
+		const auto monster = std::make_shared<Monster>(monsterType);
+		spawn.addSpawnedMonster(1, monster);
+		const size_t pending = g_spawnScheduler().getPendingCount();
+
+		// Nothing to respawn while the monster is alive
+		spawn.startSpawnMonsterCheck();
+		expect(eq(g_spawnScheduler().getPendingCount(), pending));
+
+		// The check runs from the remove notification, before the monster is flagged as removed
+		expect(!monster->isRemoved());
+		spawn.startSpawnMonsterCheck(monster);
+		expect(eq(g_spawnScheduler().getPendingCount(), pending + 1));
+
+		// A block already waiting is not scheduled twice
+		spawn.startSpawnMonsterCheck();
+		expect(eq(g_spawnScheduler().getPendingCount(), pending + 1));
+
+		spawn.stopEvent();
+		expect(eq(g_spawnScheduler().getPendingCount(), pending));
+
+		// Scheduling started the dispatcher and its thread pool, which must not outlive the test
+		g_spawnScheduler().clear();
+		inject<ThreadPool>().shutdown();
+	};
+};
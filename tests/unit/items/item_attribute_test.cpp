@@ -0,0 +1,80 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2023 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "items/functions/item/attribute.hpp"
+
+using namespace boost::ut;
+
+suite<"items"> itemAttributeTest = [] {
+	test("ItemAttribute keeps values of any type in any order") = [] {
+		ItemAttribute attributes;
+		attributes.setAttribute(ItemAttribute_t::TIER, 3);
+		attributes.setAttribute(ItemAttribute_t::WRITER, "Knight");
+		attributes.setAttribute(ItemAttribute_t::ACTIONID, 1000);
+		attributes.setAttribute(ItemAttribute_t::DESCRIPTION, "An old sword.");
+		attributes.setAttribute(ItemAttribute_t::DURATION, 60000);
+
+		expect(eq(attributes.getAttributeValue(ItemAttribute_t::ACTIONID), 1000));
+		expect(eq(attributes.getAttributeValue(ItemAttribute_t::DURATION), 60000));
+		expect(eq(attributes.getAttributeValue(ItemAttribute_t::TIER), 3));
+		expect(eq(attributes.getAttributeString(ItemAttribute_t::WRITER), std::string("Knight")));
+		expect(eq(attributes.getAttributeString(ItemAttribute_t::DESCRIPTION), std::string("An old sword.")));
+		expect(!attributes.hasAttribute(ItemAttribute_t::UNIQUEID));
+		expect(eq(attributes.getAttributeValue(ItemAttribute_t::UNIQUEID), 0));
+
+		attributes.setAttribute(ItemAttribute_t::ACTIONID, 2000);
+		expect(attributes.removeAttribute(ItemAttribute_t::DURATION));
+		expect(!attributes.removeAttribute(ItemAttribute_t::DURATION));
+		expect(attributes.removeAttribute(ItemAttribute_t::WRITER));
+
+		expect(eq(attributes.getAttributeValue(ItemAttribute_t::ACTIONID), 2000));
+		expect(eq(attributes.getAttributeValue(ItemAttribute_t::TIER), 3));
+		expect(!attributes.hasAttribute(ItemAttribute_t::DURATION));
+		expect(eq(attributes.getAttributeString(ItemAttribute_t::WRITER), std::string()));
+		expect(eq(attributes.getAttributeString(ItemAttribute_t::DESCRIPTION), std::string("An old sword.")));
+	};
+
+	test("ItemAttribute ignores values of the wrong type") = [] {
+		ItemAttribute attributes;
+		attributes.setAttribute(ItemAttribute_t::ACTIONID, "text");
+		attributes.setAttribute(ItemAttribute_t::DESCRIPTION, 5);
+		attributes.setAttribute(ItemAttribute_t::NAME, "");
+
+		expect(eq(attributes.getAttributeBits(), uint64_t { 0 }));
+	};
+
+	test("ItemAttribute shares repeated text between items") = [] {
+		ItemAttribute first;
+		ItemAttribute second;
+		first.setAttribute(ItemAttribute_t::DESCRIPTION, "Property of the guild.");
+		second.setAttribute(ItemAttribute_t::DESCRIPTION, "Property of the guild.");
+		expect(&first.getAttributeString(ItemAttribute_t::DESCRIPTION) == &second.getAttributeString(ItemAttribute_t::DESCRIPTION));
+
+		first.setAttribute(ItemAttribute_t::TEXT, "Dear diary");
+		second.setAttribute(ItemAttribute_t::TEXT, "Dear diary");
+		expect(&first.getAttributeString(ItemAttribute_t::TEXT) != &second.getAttributeString(ItemAttribute_t::TEXT));
+	};
+
+	test("ItemAttribute copies custom attributes") = [] {
+		ItemAttribute attributes;
+		attributes.setCustomAttribute("Owner", std::string("Knight"));
+		attributes.setCustomAttribute("level", int64_t { 10 });
+
+		ItemAttribute copy(attributes);
+		expect(copy.removeCustomAttribute("LEVEL"));
+		expect(attributes.getCustomAttribute("level") != nullptr);
+		expect(eq(copy.getCustomAttribute("owner")->getString(), std::string("Knight")));
+		expect(copy.removeCustomAttribute("owner"));
+		expect(copy.getCustomAttributeMap().empty());
+		expect(eq(attributes.getCustomAttributeMap().size(), size_t { 2 }));
+	};
+};
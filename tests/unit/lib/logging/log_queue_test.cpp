@@ -0,0 +1,86 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2023 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+#include <future>
+
+#include "lib/logging/log_queue.hpp"
+
+using namespace boost::ut;
+
+suite<"lib"> logQueueTest = [] {
+	test("LogQueue writes messages in order") = [] {
+		std::vector<std::pair<int, std::string>> written;
+		{
+			LogQueue queue(4, false, [&written](int level, std::string_view message) {
+				written.emplace_back(level, std::string(message));
+			});
+			for (int i = 0; i < 100; ++i) {
+				expect(queue.push(i % 3, fmt::format("message {}", i)));
+			}
+			queue.flush();
+			expect(eq(written.size(), size_t { 100 }));
+		}
+
+		for (int i = 0; i < 100; ++i) {
+			expect(eq(written[i].first, i % 3));
+			expect(eq(written[i].second, fmt::format("message {}", i)));
+		}
+	};
+
+	test("LogQueue drops and counts messages when full") = [] {
+		std::promise<void> started;
+		std::promise<void> release;
+		auto released = release.get_future().share();
+		std::vector<std::string> written;
+		std::atomic<uint64_t> dropped = 0;
+
+		LogQueue queue(
+			2, true,
+			[&](int, std::string_view message) {
+				if (written.empty()) {
+					started.set_value();
+					released.wait();
+				}
+				written.emplace_back(message);
+			},
+			[&dropped](uint64_t count) {
+				dropped += count;
+			}
+		);
+
+		// The writer holds on to the first message, the next two fill the buffer
+		expect(queue.push(0, "a"));
+		started.get_future().wait();
+		expect(queue.push(0, "b"));
+		expect(queue.push(0, "c"));
+		expect(!queue.push(0, "d"));
+		expect(!queue.push(0, "e"));
+
+		release.set_value();
+		queue.flush();
+		expect(eq(written, std::vector<std::string> { "a", "b", "c" }));
+		expect(eq(dropped.load(), uint64_t { 2 }));
+		expect(eq(queue.getDroppedCount(), uint64_t { 2 }));
+	};
+
+	test("LogQueue writes what is left when destroyed") = [] {
+		size_t written = 0;
+		{
+			LogQueue queue(16, false, [&written](int, std::string_view) {
+				++written;
+			});
+			for (int i = 0; i < 10; ++i) {
+				queue.push(0, "message");
+			}
+		}
+		expect(eq(written, size_t { 10 }));
+	};
+};
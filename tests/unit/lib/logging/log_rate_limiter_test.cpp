@@ -0,0 +1,54 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2023 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "lib/logging/log_rate_limiter.hpp"
+
+using namespace boost::ut;
+
+suite<"lib"> logRateLimiterTest = [] {
+	using namespace std::chrono_literals;
+
+	test("LogRateLimiter lets everything through without a limit") = [] {
+		LogRateLimiter limiter;
+		const auto now = std::chrono::steady_clock::now();
+		uint64_t suppressed = 0;
+		for (int i = 0; i < 1000; ++i) {
+			expect(limiter.allow("site", suppressed, now));
+		}
+		expect(eq(suppressed, uint64_t { 0 }));
+	};
+
+	test("LogRateLimiter holds back a site over its limit and reports it") = [] {
+		static constexpr char site[] = "site";
+		static constexpr char other[] = "other";
+
+		LogRateLimiter limiter;
+		limiter.setLimit(2);
+		const auto now = std::chrono::steady_clock::now();
+		uint64_t suppressed = 0;
+
+		expect(limiter.allow(site, suppressed, now));
+		expect(limiter.allow(site, suppressed, now + 100ms));
+		expect(!limiter.allow(site, suppressed, now + 200ms));
+		expect(!limiter.allow(site, suppressed, now + 300ms));
+		expect(!limiter.allow(site, suppressed, now + 999ms));
+		// Other sites have limits of their own
+		expect(limiter.allow(other, suppressed, now + 999ms));
+		expect(eq(suppressed, uint64_t { 0 }));
+
+		// A new second starts for the site
+		expect(limiter.allow(site, suppressed, now + 1s));
+		expect(eq(suppressed, uint64_t { 3 }));
+		expect(limiter.allow(site, suppressed, now + 1s));
+		expect(eq(suppressed, uint64_t { 0 }));
+	};
+};
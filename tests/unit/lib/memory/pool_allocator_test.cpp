@@ -0,0 +1,88 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2023 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "lib/memory/pool_allocator.hpp"
+#include "lib/metrics/metrics.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	struct TestPool {
+		static constexpr std::string_view name = "test";
+	};
+
+	struct Pooled : std::enable_shared_from_this<Pooled> {
+		explicit Pooled(int value, int &destroyed) :
+			value(value), destroyed(destroyed) { }
+		~Pooled() {
+			++destroyed;
+		}
+
+		int value;
+		int &destroyed;
+	};
+
+	struct Large {
+		std::array<std::byte, 4096> bytes;
+	};
+}
+
+suite<"lib"> poolAllocatorTest = [] {
+	test("makePooled constructs and destroys the object") = [] {
+		int destroyed = 0;
+		auto object = makePooled<Pooled, TestPool>(7, destroyed);
+		expect(eq(object->value, 7));
+		expect(eq(object->shared_from_this().get(), object.get()));
+
+		std::weak_ptr<Pooled> weak = object;
+		object.reset();
+		expect(eq(destroyed, 1));
+		expect(weak.expired());
+	};
+
+	test("PoolArena reuses freed blocks") = [] {
+		auto &arena = PoolArena::get("test", 40);
+		expect(eq(&arena, &PoolArena::get("test", 48)));
+		expect(neq(&arena, &PoolArena::get("other", 48)));
+
+		void* first = arena.allocate();
+		void* second = arena.allocate();
+		expect(neq(first, second));
+		expect(eq(reinterpret_cast<uintptr_t>(first) % PoolArena::BLOCK_ALIGNMENT, uintptr_t { 0 }));
+
+		arena.deallocate(first);
+		expect(eq(arena.allocate(), first));
+		arena.deallocate(first);
+		arena.deallocate(second);
+	};
+
+	test("PoolArena exports its usage into a registry") = [] {
+		auto &arena = PoolArena::get("exported", 64);
+		void* block = arena.allocate();
+
+		Metrics metrics;
+		PoolArena::exportMetrics(metrics);
+		const Metrics::Labels labels { { "pool", "exported" }, { "size", "64" } };
+		expect(eq(metrics.counter("canary_pool_allocations_total", "", labels).get(), uint64_t { 1 }));
+		expect(eq(metrics.gauge("canary_pool_blocks", "", labels).get(), int64_t { 1 }));
+		expect(gt(metrics.gauge("canary_pool_reserved_bytes", "", labels).get(), int64_t { 0 }));
+
+		arena.deallocate(block);
+		PoolArena::exportMetrics(metrics);
+		expect(eq(metrics.gauge("canary_pool_blocks", "", labels).get(), int64_t { 0 }));
+	};
+
+	test("PoolAllocator leaves large objects to the heap") = [] {
+		auto object = makePooled<Large, TestPool>();
+		expect(object != nullptr);
+	};
+};
@@ -0,0 +1,52 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2023 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "lib/metrics/metrics.hpp"
+
+using namespace boost::ut;
+
+suite<"lib"> metricsTest = [] {
+	test("Metrics returns the registered metric for the same name and labels") = [] {
+		Metrics metrics;
+		auto &counter = metrics.counter("test_total", "Test counter", { { "kind", "a" } });
+		counter.add(2);
+
+		expect(eq(&counter, &metrics.counter("test_total", "Test counter", { { "kind", "a" } })));
+		expect(neq(&counter, &metrics.counter("test_total", "Test counter", { { "kind", "b" } })));
+		expect(throws([&metrics] { metrics.gauge("test_total", "Test gauge"); }));
+	};
+
+	test("Metrics writes the Prometheus text format") = [] {
+		Metrics metrics;
+		metrics.counter("test_total", "Test counter").add(3);
+		metrics.gauge("test_gauge", "Test gauge", { { "name", "a\"b" } }).set(-4);
+		auto &histogram = metrics.histogram("test_seconds", "Test histogram", { 0.1, 1 });
+		histogram.observe(0.05);
+		histogram.observe(0.5);
+		histogram.observe(5);
+
+		const std::string expected = "# HELP test_total Test counter\n"
+									 "# TYPE test_total counter\n"
+									 "test_total 3\n"
+									 "# HELP test_gauge Test gauge\n"
+									 "# TYPE test_gauge gauge\n"
+									 "test_gauge{name=\"a\\\"b\"} -4\n"
+									 "# HELP test_seconds Test histogram\n"
+									 "# TYPE test_seconds histogram\n"
+									 "test_seconds_bucket{le=\"0.1\"} 1\n"
+									 "test_seconds_bucket{le=\"1\"} 2\n"
+									 "test_seconds_bucket{le=\"+Inf\"} 3\n"
+									 "test_seconds_sum 5.55\n"
+									 "test_seconds_count 3\n";
+		expect(eq(expected, metrics.serialize()));
+	};
+};
@@ -0,0 +1,83 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2023 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "lua/scripts/lua_timer_wheel.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	uint32_t addTimer(LuaTimerWheel &wheel, int64_t now, int64_t delay, const std::string &scriptName = "test.lua") {
+		LuaTimerEventDesc timer;
+		timer.scriptName = scriptName;
+		timer.due = now + delay;
+		return wheel.add(std::move(timer), now);
+	}
+}
+
+suite<"lua"> luaTimerWheelTest = [] {
+	test("LuaTimerWheel fires timers once due, in due order") = [] {
+		LuaTimerWheel wheel;
+		const uint32_t late = addTimer(wheel, 1000, 300);
+		const uint32_t early = addTimer(wheel, 1000, 120);
+		const uint32_t sameTick = addTimer(wheel, 1000, 110);
+
+		std::vector<uint32_t> due;
+		wheel.advance(1100, due);
+		expect(due.empty());
+
+		// Due times round up to the next tick
+		wheel.advance(1149, due);
+		expect(due.empty());
+		wheel.advance(1150, due);
+		expect(due == std::vector<uint32_t> { sameTick, early });
+
+		due.clear();
+		wheel.advance(1299, due);
+		expect(due.empty());
+		wheel.advance(1300, due);
+		expect(due == std::vector<uint32_t> { late });
+	};
+
+	test("LuaTimerWheel keeps timers beyond one revolution") = [] {
+		LuaTimerWheel wheel;
+		const int64_t revolution = LuaTimerWheel::TICK_MS * LuaTimerWheel::SLOTS;
+		const uint32_t timerId = addTimer(wheel, 0, revolution + 100);
+
+		std::vector<uint32_t> due;
+		for (int64_t now = 0; now < revolution + 100; now += LuaTimerWheel::TICK_MS) {
+			wheel.advance(now, due);
+		}
+		expect(due.empty());
+
+		wheel.advance(revolution + 100, due);
+		expect(due == std::vector<uint32_t> { timerId });
+	};
+
+	test("LuaTimerWheel skips removed timers and counts timers by script") = [] {
+		LuaTimerWheel wheel;
+		const uint32_t stopped = addTimer(wheel, 0, 100, "a.lua");
+		const uint32_t kept = addTimer(wheel, 0, 100, "b.lua");
+		expect(eq(wheel.getScriptCounts().at("a.lua"), 1u));
+
+		expect(wheel.remove(stopped).has_value());
+		expect(!wheel.remove(stopped).has_value());
+		expect(eq(wheel.getScriptCounts().at("a.lua"), 0u));
+
+		std::vector<uint32_t> due;
+		wheel.advance(100, due);
+		expect(due == std::vector<uint32_t> { kept });
+
+		expect(wheel.remove(kept).has_value());
+		expect(wheel.empty());
+		expect(eq(wheel.getScriptCounts().at("b.lua"), 0u));
+	};
+};
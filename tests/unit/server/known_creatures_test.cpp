@@ -0,0 +1,56 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2023 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "server/network/protocol/known_creatures.hpp"
+
+using namespace boost::ut;
+
+suite<"server"> knownCreaturesTest = [] {
+	test("KnownCreatures forgets the least recently sent creature past the client limit") = [] {
+		KnownCreatures known;
+		const auto anyone = [](uint32_t) { return true; };
+
+		uint32_t forgotten = 0;
+		for (uint32_t id = 1; id <= KnownCreatures::CLIENT_LIMIT; ++id) {
+			expect(!known.add(id, forgotten, anyone));
+			expect(eq(forgotten, 0U));
+		}
+
+		// Sending the first creature again makes the second the least recently sent
+		expect(known.add(1, forgotten, anyone));
+		expect(!known.add(5000, forgotten, anyone));
+		expect(eq(forgotten, 2U));
+		expect(eq(known.size(), KnownCreatures::CLIENT_LIMIT));
+		expect(known.contains(1) && known.contains(5000) && !known.contains(2));
+	};
+
+	test("KnownCreatures keeps the creatures that may not be forgotten") = [] {
+		KnownCreatures known;
+		uint32_t forgotten = 0;
+		for (uint32_t id = 1; id <= KnownCreatures::CLIENT_LIMIT; ++id) {
+			known.add(id, forgotten, [](uint32_t) { return true; });
+		}
+
+		// The oldest ones are still on screen
+		const auto offScreen = [](uint32_t id) { return id > 10; };
+		known.add(5000, forgotten, offScreen);
+		expect(eq(forgotten, 11U));
+		known.add(5001, forgotten, offScreen);
+		expect(eq(forgotten, 12U));
+
+		// Nobody may be forgotten, the least recently sent still goes
+		known.add(5002, forgotten, [](uint32_t) { return false; });
+		expect(forgotten != 0 && forgotten != 5002);
+		expect(known.contains(5002));
+		expect(eq(known.size(), KnownCreatures::CLIENT_LIMIT));
+	};
+};
@@ -0,0 +1,48 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2023 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "utils/idtable.hpp"
+
+using namespace boost::ut;
+
+suite<"utils"> idTableTest = [] {
+	test("id_table finds only the ids that were given a value") = [] {
+		stdext::id_table<std::string> table;
+		expect(table.empty());
+		expect(table.find(0) == nullptr);
+		expect(table.find(65535) == nullptr);
+
+		table[2148] = "scripted";
+		expect(table.try_emplace(10, "first"));
+		expect(!table.try_emplace(10, "second"));
+
+		expect(eq(table.size(), 2U));
+		expect(!table.contains(2147) && !table.contains(2149) && !table.contains(70000));
+		expect(table.find(10) != nullptr && *table.find(10) == "first");
+		expect(table.find(2148) != nullptr && *table.find(2148) == "scripted");
+
+		table.clear();
+		expect(table.empty());
+		expect(!table.contains(10) && !table.contains(2148));
+	};
+
+	test("id_table operator[] keeps the value an id already has") = [] {
+		stdext::id_table<std::vector<int>> table;
+		table[5].emplace_back(1);
+		table[5].emplace_back(2);
+		table[3].emplace_back(3);
+
+		expect(table[5] == std::vector<int> { 1, 2 });
+		expect(table[3] == std::vector<int> { 3 });
+		expect(eq(table.size(), 2U));
+	};
+};